@@ -1,6 +1,17 @@
 option(ENABLE_TESTING "Should cmake build tests too?" ON)
 set(ENABLE_TESTING ${ENABLE_TESTING})
 
+set(EVE_SCRIPT_EXECUTION_MODE "JIT" CACHE STRING
+	"How the runtime executes scripts: JIT, AOT, FULL_AOT or LLVM_AOT")
+set(EVE_SCRIPT_EXECUTION_MODES JIT AOT FULL_AOT LLVM_AOT)
+set_property(CACHE EVE_SCRIPT_EXECUTION_MODE PROPERTY STRINGS
+	${EVE_SCRIPT_EXECUTION_MODES})
+
+if(NOT EVE_SCRIPT_EXECUTION_MODE IN_LIST EVE_SCRIPT_EXECUTION_MODES)
+	message(FATAL_ERROR "Unknown EVE_SCRIPT_EXECUTION_MODE \"${EVE_SCRIPT_EXECUTION_MODE}\", "
+		"expected one of: ${EVE_SCRIPT_EXECUTION_MODES}")
+endif()
+
 set(CMAKE_CXX_STANDARD 20)
 set(CMAKE_CXX_STANDARD_REQUIRED ON)
 set(CMAKE_CXX_EXTENSIONS OFF)
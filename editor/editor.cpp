@@ -4,6 +4,7 @@
 
 #include "core/entrypoint.h"
 #include "core/input.h"
+#include "physics/tile_collision.h"
 #include "project/project.h"
 #include "renderer/frame_buffer.h"
 #include "renderer/primitives/text.h"
@@ -29,6 +30,16 @@ void EditorApplication::_on_start() {}
 
 inline static bool s_default_title = true;
 
+// journal of every scene is kept in the cache of the project
+inline static fs::path get_autosave_path(const std::string& scene_path) {
+	const std::string relative_path = Project::get_relative_asset_path(
+			Project::get_asset_path(scene_path));
+
+	return Project::get_cache_directory(AssetType::SCENE) /
+			std::format("{:x}.ejournal",
+					std::hash<std::string>{}(relative_path));
+}
+
 void EditorApplication::_on_update(float dt) {
 	if (s_default_title && g_modify_info.modified) {
 		window->set_title(Project::get_name() + " *");
@@ -44,6 +55,14 @@ void EditorApplication::_on_update(float dt) {
 				editor_camera->update(dt);
 			}
 
+			// wait for the edit to finish so that dragging a value is
+			// recorded as a single change
+			if (editor_scene && !ImGui::IsAnyMouseDown() &&
+					!ImGui::IsAnyItemActive() &&
+					g_modify_info.consume_changes()) {
+				_record_changes();
+			}
+
 			if (Ref<Scene> scene = SceneManager::get_active(); scene) {
 				// bind entity selection beheaviour
 				if (viewport.is_focused()) {
@@ -141,6 +160,7 @@ void EditorApplication::_on_imgui_update(float dt) {
 	content_browser.render();
 	console.render();
 	stats.render();
+	script_profiler_panel.render();
 
 	project_settings.render();
 
@@ -165,10 +185,13 @@ void EditorApplication::_setup_menubar() {
 	const Menu edit_menu{
 		"Edit",
 		{
+				{ "Undo", "Ctrl+Z", BIND_FUNC(_undo) },
+				{ "Redo", "Ctrl+Y", BIND_FUNC(_redo) },
 				{
 						"Project Settings",
 						[this]() { project_settings.set_active(true); },
 				},
+				{ "Bake Tile Collision", BIND_FUNC(_bake_tile_collision) },
 		},
 	};
 	menubar.push_menu(edit_menu);
@@ -184,6 +207,8 @@ void EditorApplication::_setup_menubar() {
 						[this]() { content_browser.set_active(true); } },
 				{ "Console", [this]() { console.set_active(true); } },
 				{ "Stats", [this]() { stats.set_active(true); } },
+				{ "Script Profiler",
+						[this]() { script_profiler_panel.set_active(true); } },
 		},
 	};
 	menubar.push_menu(view_menu);
@@ -209,6 +234,123 @@ void EditorApplication::_on_viewport_resize() {
 	}
 }
 
+void EditorApplication::_bake_tile_collision() {
+	if (state != SceneState::EDIT || !editor_scene) {
+		return;
+	}
+
+	struct Tile {
+		Entity entity;
+		glm::vec2 min;
+	};
+
+	std::vector<Tile> tiles;
+	glm::vec2 tile_size(0.0f);
+	glm::vec2 grid_min(std::numeric_limits<float>::max());
+	glm::vec2 grid_max(std::numeric_limits<float>::lowest());
+
+	for (Entity entity : editor_scene->get_selected_entities()) {
+		if (!entity.has_component<BoxCollider2D>()) {
+			continue;
+		}
+
+		if (entity.has_component<Rigidbody2D>() &&
+				entity.get_component<Rigidbody2D>().type !=
+						Rigidbody2D::BodyType::STATIC) {
+			continue;
+		}
+
+		const Transform& transform = entity.get_transform();
+		const BoxCollider2D& box_collider =
+				entity.get_component<BoxCollider2D>();
+
+		// box collider sizes are half extents
+		const glm::vec2 size =
+				box_collider.size * 2.0f * glm::vec2(transform.get_scale());
+		const glm::vec2 center =
+				glm::vec2(transform.get_position()) + box_collider.offset;
+
+		// the grid is measured in tiles, empty or mirrored ones can't be placed
+		if (glm::any(glm::lessThanEqual(size, glm::vec2(0.0f)))) {
+			EVE_LOG_WARNING("Skipping tile '{}', its size must be positive.",
+					entity.get_name());
+			continue;
+		}
+
+		if (tiles.empty()) {
+			tile_size = size;
+		} else if (glm::any(glm::greaterThan(
+						   glm::abs(size - tile_size), glm::vec2(0.001f)))) {
+			EVE_LOG_WARNING("Skipping tile '{}', its size does not match the "
+							"rest of the selection.",
+					entity.get_name());
+			continue;
+		}
+
+		const glm::vec2 min = center - size * 0.5f;
+		grid_min = glm::min(grid_min, min);
+		grid_max = glm::max(grid_max, min + size);
+
+		tiles.push_back({ entity, min });
+	}
+
+	if (tiles.empty()) {
+		EVE_LOG_WARNING("Select static entities with BoxCollider2D components "
+						"to bake tile collision.");
+		return;
+	}
+
+	const glm::uvec2 grid_size =
+			glm::uvec2(glm::round((grid_max - grid_min) / tile_size));
+
+	TileGrid grid(grid_size.x, grid_size.y);
+	grid.origin = grid_min;
+	grid.tile_size = tile_size;
+
+	for (const Tile& tile : tiles) {
+		const glm::ivec2 cell =
+				glm::ivec2(glm::round((tile.min - grid_min) / tile_size));
+		grid.set_solid(cell.x, cell.y);
+	}
+
+	const auto outlines = tile_collision::build_outlines(grid);
+
+	Entity root = editor_scene->create("TileCollision");
+	for (size_t i = 0; i < outlines.size(); i++) {
+		Entity outline_entity = editor_scene->create(
+				std::format("Outline{}", i), root.get_uid());
+
+		outline_entity.add_component<Rigidbody2D>();
+
+		ChainCollider2D& chain_collider =
+				outline_entity.add_component<ChainCollider2D>();
+		chain_collider.points = outlines[i];
+
+		const BoxCollider2D& source_collider =
+				tiles.front().entity.get_component<BoxCollider2D>();
+		chain_collider.friction = source_collider.friction;
+		chain_collider.restitution = source_collider.restitution;
+		chain_collider.restitution_threshold =
+				source_collider.restitution_threshold;
+	}
+
+	// tiles are now covered by the baked outlines
+	for (Tile& tile : tiles) {
+		tile.entity.remove_component<BoxCollider2D>();
+		if (tile.entity.has_component<Rigidbody2D>()) {
+			tile.entity.remove_component<Rigidbody2D>();
+		}
+	}
+
+	// marks the tiles while they are still selected
+	g_modify_info.set_modified();
+
+	editor_scene->select_entity_only(root);
+
+	EVE_LOG_INFO("Baked {} tiles into {} collision outlines.", tiles.size(),
+			outlines.size());
+}
+
 void EditorApplication::_handle_entity_selection(
 		Ref<FrameBuffer> frame_buffer) {
 	auto [mx, my] = ImGui::GetMousePos();
@@ -259,6 +401,9 @@ void EditorApplication::_save_active_scene() {
 	}
 
 	if (!editor_scene->get_path().empty()) {
+		// pending edits belong to the saved state
+		_record_changes();
+
 		Scene::serialize(editor_scene, editor_scene->get_path());
 
 		_on_scene_save();
@@ -283,6 +428,9 @@ void EditorApplication::_save_active_scene_as() {
 
 	editor_scene->path = path;
 
+	_record_changes();
+	journal.set_autosave_path(get_autosave_path(path));
+
 	Scene::serialize(editor_scene, path);
 
 	_on_scene_save();
@@ -305,7 +453,7 @@ void EditorApplication::_open_project() {
 		EVE_ASSERT(
 				SceneManager::load_scene(Project::get_starting_scene_path()));
 
-		editor_scene = SceneManager::get_active();
+		_on_scene_open();
 		editor_scene->clear_selected_entities();
 
 		window->set_title(Project::get_name());
@@ -317,6 +465,8 @@ void EditorApplication::_on_scene_save() {
 	s_default_title = true;
 
 	g_modify_info.on_save();
+
+	journal.on_save();
 }
 
 void EditorApplication::_set_scene_state(SceneState _state) {
@@ -332,11 +482,76 @@ void EditorApplication::_create_scene() {
 	editor_scene = create_ref<Scene>();
 	SceneManager::set_active(editor_scene);
 
+	_reset_journal();
+
 	g_modify_info.set_modified();
 }
 
 void EditorApplication::_on_scene_open() {
 	editor_scene = SceneManager::get_active();
+
+	_reset_journal();
+}
+
+void EditorApplication::_reset_journal() {
+	// scenes without a path have nowhere to be recovered from
+	const fs::path autosave_path = !editor_scene->get_path().empty()
+			? get_autosave_path(editor_scene->get_path())
+			: fs::path();
+
+	journal.reset(editor_scene, autosave_path);
+	g_modify_info.dirty_ids.clear();
+
+	if (!journal.has_autosave()) {
+		return;
+	}
+
+	const int result = tinyfd_messageBox("Recover Scene",
+			"Unsaved changes of this scene were found, do you want to "
+			"recover them?",
+			"yesno", "question", 1);
+
+	if (result == 1 && journal.recover()) {
+		g_modify_info.set_modified();
+		// recovered changes are not part of the history
+		g_modify_info.consume_changes();
+	} else {
+		journal.on_save();
+	}
+}
+
+bool EditorApplication::_record_changes() {
+	for (const UID uid : g_modify_info.dirty_ids) {
+		journal.mark_dirty(uid);
+	}
+	g_modify_info.dirty_ids.clear();
+
+	return journal.record();
+}
+
+void EditorApplication::_undo() {
+	if (state != SceneState::EDIT || !editor_scene) {
+		return;
+	}
+
+	// edits which are not recorded yet are the first ones to undo
+	_record_changes();
+
+	if (journal.undo()) {
+		g_modify_info.set_modified();
+		g_modify_info.consume_changes();
+	}
+}
+
+void EditorApplication::_redo() {
+	if (state != SceneState::EDIT || !editor_scene) {
+		return;
+	}
+
+	if (journal.redo()) {
+		g_modify_info.set_modified();
+		g_modify_info.consume_changes();
+	}
 }
 
 void EditorApplication::_on_scene_play() {
@@ -378,6 +593,18 @@ void EditorApplication::_handle_shortcuts() {
 			}
 		}
 
+		if (Input::is_key_pressed_once(KeyCode::Z)) {
+			if (Input::is_key_pressed(KeyCode::LEFT_SHIFT)) {
+				_redo();
+			} else {
+				_undo();
+			}
+		}
+
+		if (Input::is_key_pressed_once(KeyCode::Y)) {
+			_redo();
+		}
+
 		if (Input::is_key_pressed(KeyCode::LEFT_SHIFT)) {
 			if (Input::is_key_pressed(KeyCode::S)) {
 				_save_active_scene_as();
@@ -427,9 +654,7 @@ void EditorApplication::_render_entity_bounds(Entity entity) {
 		renderer::draw_box(text_transform, COLOR_GREEN);
 	}
 
-	for (auto child : entity.get_children()) {
-		_render_entity_bounds(child);
-	}
+	entity.each_child([this](Entity child) { _render_entity_bounds(child); });
 }
 
 // Application entrypoint
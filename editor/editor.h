@@ -7,6 +7,7 @@
 #include "panels/hierarchy_panel.h"
 #include "panels/inspector_panel.h"
 #include "panels/project_settings.h"
+#include "panels/script_profiler_panel.h"
 #include "panels/stats_panel.h"
 #include "panels/toolbar_panel.h"
 #include "panels/viewport_panel.h"
@@ -14,6 +15,7 @@
 
 #include "core/application.h"
 #include "scene/editor_camera.h"
+#include "scene/scene_journal.h"
 #include "scene/scene_renderer.h"
 
 class EditorApplication : public Application {
@@ -53,6 +55,17 @@ private:
 
 	void _on_scene_open();
 
+	// starts a new history for the editor scene and offers recovering the
+	// unsaved changes of the last session
+	void _reset_journal();
+
+	// hands the entities marked by the edits to the journal and records them
+	bool _record_changes();
+
+	void _undo();
+
+	void _redo();
+
 	// scene controls
 	void _on_scene_play();
 
@@ -66,6 +79,9 @@ private:
 
 	void _handle_shortcuts();
 
+	// merges the selected static box collider tiles into chain outlines
+	void _bake_tile_collision();
+
 	// custom rendering beheaviours
 	void _handle_entity_selection(Ref<FrameBuffer> frame_buffer);
 
@@ -78,6 +94,8 @@ private:
 	Ref<Scene> editor_scene = nullptr;
 	SceneState state = SceneState::EDIT;
 
+	SceneJournal journal;
+
 	// panels and widgets
 	MenuBar menubar;
 	ToolbarPanel toolbar;
@@ -88,6 +106,7 @@ private:
 	AssetInspectorPanel asset_inspector;
 	ConsolePanel console;
 	StatsPanel stats;
+	ScriptProfilerPanel script_profiler_panel;
 
 	ProjectSettingsPanel project_settings;
 
@@ -4,10 +4,12 @@
 
 #include <imgui.h>
 #include <misc/cpp/imgui_stdlib.h>
+#include <tinyfiledialogs.h>
 
 #include "data/fonts/font_awesome.h"
 #include "scene/components.h"
 #include "scene/entity.h"
+#include "scene/prefab.h"
 #include "scene/scene_manager.h"
 
 HierarchyPanel::HierarchyPanel() {
@@ -232,12 +234,36 @@ void HierarchyPanel::_draw_entity_context_menu(Entity entity) {
 
 				g_modify_info.set_modified();
 			}
+
+			if (ImGui::MenuItem("Save As Prefab")) {
+				_save_as_prefab(entity);
+			}
 		}
 
 		ImGui::EndPopup();
 	}
 }
 
+void HierarchyPanel::_save_as_prefab(Entity entity) {
+	const char* filter_patterns[1] = { "*.eprf" };
+	const std::string default_path = entity.get_name() + PREFAB_EXTENSION;
+	const char* path = tinyfd_saveFileDialog("Save Prefab",
+			default_path.c_str(), 1, filter_patterns, "Eve Prefab Files");
+
+	if (!path) {
+		return;
+	}
+
+	Ref<Prefab> prefab = Prefab::create(entity);
+	if (!prefab || !Prefab::serialize(prefab, path)) {
+		EVE_LOG_ERROR("Unable to save prefab to \"{}\".", path);
+		return;
+	}
+
+	EVE_LOG_INFO("Saved {} entities as prefab \"{}\".",
+			prefab->get_entities().size(), path);
+}
+
 void HierarchyPanel::_draw_entity_drag_drop_src(Entity entity) {
 	if (ImGui::BeginDragDropSource()) {
 		ImGui::SetDragDropPayload(
@@ -259,6 +285,26 @@ void HierarchyPanel::_draw_entity_drag_drop_target(const Entity& new_parent) {
 					recv_entity) {
 				recv_entity.set_parent(new_parent);
 
+				g_modify_info.set_modified(recv_entity);
+			}
+		}
+
+		// prefabs loaded from the content browser are instantiated here
+		if (const ImGuiPayload* payload =
+						ImGui::AcceptDragDropPayload("DND_PAYLOAD_PREFAB")) {
+			const AssetHandle handle =
+					*static_cast<AssetHandle*>(payload->Data);
+
+			auto scene = SceneManager::get_active();
+			if (Ref<Prefab> prefab =
+							scene->get_asset_registry().get_asset<Prefab>(
+									handle);
+					prefab) {
+				const UID parent_id =
+						new_parent ? new_parent.get_uid() : INVALID_UID;
+				scene->select_entity_only(
+						scene->instantiate(*prefab, parent_id));
+
 				g_modify_info.set_modified();
 			}
 		}
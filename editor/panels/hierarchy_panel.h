@@ -26,6 +26,8 @@ private:
 
 	void _draw_entity_drag_drop_target(const Entity& new_parent);
 
+	void _save_as_prefab(Entity entity);
+
 private:
 	std::vector<Entity> entities_to_remove;
 };
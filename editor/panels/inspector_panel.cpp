@@ -20,6 +20,10 @@ static void draw_script_field(const std::string& name,
 static void draw_script_field_runtime(const std::string& name,
 		const ScriptField& field, Ref<ScriptInstance>& script_instance);
 
+// returns true if the points changed
+static bool draw_point_list(const char* id, std::vector<glm::vec2>& points,
+		size_t min_count = 0, size_t max_count = SIZE_MAX);
+
 template <typename T>
 inline static void display_add_component_entry(
 		Entity& selected_entity, const std::string& component_name) {
@@ -124,8 +128,6 @@ void InspectorPanel::_draw() {
 
 	// display entity header
 
-	auto& id_comp = selected_entity.get_component<IdComponent>();
-
 	const float padding = 5.0f;
 
 	const uint32_t plus_button_width = ImGui::CalcTextSize(ICON_FA_PLUS).x;
@@ -133,7 +135,10 @@ void InspectorPanel::_draw() {
 	ImGui::PushItemWidth(
 			ImGui::GetContentRegionMax().x - (plus_button_width + 3 * padding));
 
-	if (ImGui::InputText("##tag", &id_comp.tag)) {
+	// renamed through the entity so the name index stays in sync
+	std::string tag = selected_entity.get_name();
+	if (ImGui::InputText("##tag", &tag)) {
+		selected_entity.set_name(tag);
 		g_modify_info.set_modified();
 	}
 
@@ -158,6 +163,12 @@ void InspectorPanel::_draw() {
 				selected_entity, "BoxCollider2D");
 		display_add_component_entry<CircleCollider2D>(
 				selected_entity, "CircleCollider2D");
+		display_add_component_entry<PolygonCollider2D>(
+				selected_entity, "PolygonCollider2D");
+		display_add_component_entry<CapsuleCollider2D>(
+				selected_entity, "CapsuleCollider2D");
+		display_add_component_entry<ChainCollider2D>(
+				selected_entity, "ChainCollider2D");
 		display_add_component_entry<PostProcessVolume>(
 				selected_entity, "PostProcessVolume");
 		display_add_component_entry<ScriptComponent>(selected_entity, "Script");
@@ -662,6 +673,208 @@ void InspectorPanel::_draw() {
 				EVE_END_FIELD();
 			});
 
+	draw_component<PolygonCollider2D>("PolygonCollider2D", selected_entity,
+			[](PolygonCollider2D& polygon_collider) {
+				bool changed = false;
+
+				EVE_BEGIN_FIELD("Offset");
+				{
+					if (ImGui::DragFloat2("##PolygonColliderOffset",
+								glm::value_ptr(polygon_collider.offset))) {
+						changed = true;
+					}
+				}
+				EVE_END_FIELD();
+
+				// box2d polygons are limited to 8 vertices
+				changed |= draw_point_list(
+						"PolygonColliderPoints", polygon_collider.points, 3, 8);
+
+				EVE_BEGIN_FIELD("IsTrigger");
+				{
+					if (ImGui::Checkbox("##PolygonColliderIsTrigger",
+								&polygon_collider.is_trigger)) {
+						changed = true;
+					}
+				}
+				EVE_END_FIELD();
+
+				EVE_BEGIN_FIELD("Density");
+				{
+					if (ImGui::DragFloat("##PolygonColliderDensity",
+								&polygon_collider.density)) {
+						changed = true;
+					}
+				}
+				EVE_END_FIELD();
+
+				EVE_BEGIN_FIELD("Friction");
+				{
+					if (ImGui::DragFloat("##PolygonColliderFriction",
+								&polygon_collider.friction)) {
+						changed = true;
+					}
+				}
+				EVE_END_FIELD();
+
+				EVE_BEGIN_FIELD("Restitution");
+				{
+					if (ImGui::DragFloat("##PolygonColliderRestitution",
+								&polygon_collider.restitution)) {
+						changed = true;
+					}
+				}
+				EVE_END_FIELD();
+
+				EVE_BEGIN_FIELD("Threshold");
+				{
+					if (ImGui::DragFloat("##PolygonColliderRestitutionThreshold",
+								&polygon_collider.restitution_threshold)) {
+						changed = true;
+					}
+				}
+				EVE_END_FIELD();
+
+				// fixtures of running scenes are rebuilt from the new shape
+				if (changed) {
+					polygon_collider.runtime_dirty = true;
+					g_modify_info.set_modified();
+				}
+			});
+
+	draw_component<CapsuleCollider2D>("CapsuleCollider2D", selected_entity,
+			[](CapsuleCollider2D& capsule_collider) {
+				bool changed = false;
+
+				EVE_BEGIN_FIELD("Offset");
+				{
+					if (ImGui::DragFloat2("##CapsuleColliderOffset",
+								glm::value_ptr(capsule_collider.offset))) {
+						changed = true;
+					}
+				}
+				EVE_END_FIELD();
+
+				EVE_BEGIN_FIELD("Radius");
+				{
+					if (ImGui::DragFloat("##CapsuleColliderRadius",
+								&capsule_collider.radius, 0.01f, 0.0f)) {
+						changed = true;
+					}
+				}
+				EVE_END_FIELD();
+
+				EVE_BEGIN_FIELD("Height");
+				{
+					if (ImGui::DragFloat("##CapsuleColliderHeight",
+								&capsule_collider.height, 0.01f, 0.0f)) {
+						changed = true;
+					}
+				}
+				EVE_END_FIELD();
+
+				EVE_BEGIN_FIELD("IsTrigger");
+				{
+					if (ImGui::Checkbox("##CapsuleColliderIsTrigger",
+								&capsule_collider.is_trigger)) {
+						changed = true;
+					}
+				}
+				EVE_END_FIELD();
+
+				EVE_BEGIN_FIELD("Density");
+				{
+					if (ImGui::DragFloat("##CapsuleColliderDensity",
+								&capsule_collider.density)) {
+						changed = true;
+					}
+				}
+				EVE_END_FIELD();
+
+				EVE_BEGIN_FIELD("Friction");
+				{
+					if (ImGui::DragFloat("##CapsuleColliderFriction",
+								&capsule_collider.friction)) {
+						changed = true;
+					}
+				}
+				EVE_END_FIELD();
+
+				EVE_BEGIN_FIELD("Restitution");
+				{
+					if (ImGui::DragFloat("##CapsuleColliderRestitution",
+								&capsule_collider.restitution)) {
+						changed = true;
+					}
+				}
+				EVE_END_FIELD();
+
+				EVE_BEGIN_FIELD("Threshold");
+				{
+					if (ImGui::DragFloat("##CapsuleColliderRestitutionThreshold",
+								&capsule_collider.restitution_threshold)) {
+						changed = true;
+					}
+				}
+				EVE_END_FIELD();
+
+				// fixtures of running scenes are rebuilt from the new shape
+				if (changed) {
+					capsule_collider.runtime_dirty = true;
+					g_modify_info.set_modified();
+				}
+			});
+
+	draw_component<ChainCollider2D>("ChainCollider2D", selected_entity,
+			[](ChainCollider2D& chain_collider) {
+				bool changed = false;
+
+				changed |= draw_point_list(
+						"ChainColliderPoints", chain_collider.points);
+
+				EVE_BEGIN_FIELD("Is Loop");
+				{
+					if (ImGui::Checkbox("##ChainColliderIsLoop",
+								&chain_collider.is_loop)) {
+						changed = true;
+					}
+				}
+				EVE_END_FIELD();
+
+				EVE_BEGIN_FIELD("Friction");
+				{
+					if (ImGui::DragFloat("##ChainColliderFriction",
+								&chain_collider.friction)) {
+						changed = true;
+					}
+				}
+				EVE_END_FIELD();
+
+				EVE_BEGIN_FIELD("Restitution");
+				{
+					if (ImGui::DragFloat("##ChainColliderRestitution",
+								&chain_collider.restitution)) {
+						changed = true;
+					}
+				}
+				EVE_END_FIELD();
+
+				EVE_BEGIN_FIELD("Threshold");
+				{
+					if (ImGui::DragFloat("##ChainColliderRestitutionThreshold",
+								&chain_collider.restitution_threshold)) {
+						changed = true;
+					}
+				}
+				EVE_END_FIELD();
+
+				// fixtures of running scenes are rebuilt from the new shape
+				if (changed) {
+					chain_collider.runtime_dirty = true;
+					g_modify_info.set_modified();
+				}
+			});
+
 	draw_component<PostProcessVolume>("Post Processing Volume", selected_entity,
 			[](PostProcessVolume& volume) {
 				ImGui::Columns();
@@ -874,6 +1087,7 @@ void InspectorPanel::_draw() {
 								ScriptFieldInstance& script_field =
 										entity_fields[name];
 								script_field.field = field;
+								script_field.class_id = entity_class->get_id();
 
 								draw_script_field(name, script_field, true);
 							}
@@ -1084,27 +1298,27 @@ void draw_script_field_runtime(const std::string& name,
 		const ScriptField& field, Ref<ScriptInstance>& script_instance) {
 	switch (field.type) {
 		case ScriptFieldType::FLOAT: {
-			float data = script_instance->get_field_value<float>(name);
+			float data = script_instance->get_field_value<float>(field);
 			if (ImGui::DragFloat(name.c_str(), &data)) {
-				script_instance->set_field_value(name, data);
+				script_instance->set_field_value(field, data);
 
 				g_modify_info.set_modified();
 			}
 			break;
 		}
 		case ScriptFieldType::DOUBLE: {
-			double data = script_instance->get_field_value<double>(name);
+			double data = script_instance->get_field_value<double>(field);
 			if (ImGui::DragFloat(name.c_str(), (float*)&data)) {
-				script_instance->set_field_value(name, data);
+				script_instance->set_field_value(field, data);
 
 				g_modify_info.set_modified();
 			}
 			break;
 		}
 		case ScriptFieldType::BOOL: {
-			bool data = script_instance->get_field_value<bool>(name);
+			bool data = script_instance->get_field_value<bool>(field);
 			if (ImGui::Checkbox(name.c_str(), &data)) {
-				script_instance->set_field_value(name, data);
+				script_instance->set_field_value(field, data);
 
 				g_modify_info.set_modified();
 			}
@@ -1114,131 +1328,131 @@ void draw_script_field_runtime(const std::string& name,
 			break;
 		}
 		case ScriptFieldType::BYTE: {
-			int8_t data = script_instance->get_field_value<int8_t>(name);
+			int8_t data = script_instance->get_field_value<int8_t>(field);
 			if (ImGui::DragInt(name.c_str(), (int*)&data,
 						std::numeric_limits<int8_t>::min(),
 						std::numeric_limits<int8_t>::max())) {
-				script_instance->set_field_value(name, data);
+				script_instance->set_field_value(field, data);
 
 				g_modify_info.set_modified();
 			}
 			break;
 		}
 		case ScriptFieldType::SHORT: {
-			int16_t data = script_instance->get_field_value<int16_t>(name);
+			int16_t data = script_instance->get_field_value<int16_t>(field);
 			if (ImGui::DragInt(name.c_str(), (int*)&data, 1.0f,
 						std::numeric_limits<int16_t>::min(),
 						std::numeric_limits<int16_t>::max())) {
-				script_instance->set_field_value(name, data);
+				script_instance->set_field_value(field, data);
 
 				g_modify_info.set_modified();
 			}
 			break;
 		}
 		case ScriptFieldType::INT: {
-			int data = script_instance->get_field_value<int>(name);
+			int data = script_instance->get_field_value<int>(field);
 			if (ImGui::DragInt(name.c_str(), &data, 1.0f,
 						std::numeric_limits<int32_t>::min(),
 						std::numeric_limits<int32_t>::max())) {
-				script_instance->set_field_value(name, data);
+				script_instance->set_field_value(field, data);
 
 				g_modify_info.set_modified();
 			}
 			break;
 		}
 		case ScriptFieldType::LONG: {
-			int64_t data = script_instance->get_field_value<int64_t>(name);
+			int64_t data = script_instance->get_field_value<int64_t>(field);
 			if (ImGui::DragInt(name.c_str(), (int*)&data, 1.0f,
 						std::numeric_limits<int32_t>::min(),
 						std::numeric_limits<int32_t>::max())) {
-				script_instance->set_field_value(name, data);
+				script_instance->set_field_value(field, data);
 
 				g_modify_info.set_modified();
 			}
 			break;
 		}
 		case ScriptFieldType::UBYTE: {
-			uint8_t data = script_instance->get_field_value<uint8_t>(name);
+			uint8_t data = script_instance->get_field_value<uint8_t>(field);
 			if (ImGui::DragInt(name.c_str(), (int*)&data,
 						std::numeric_limits<int8_t>::min(),
 						std::numeric_limits<uint8_t>::max())) {
-				script_instance->set_field_value(name, data);
+				script_instance->set_field_value(field, data);
 
 				g_modify_info.set_modified();
 			}
 			break;
 		}
 		case ScriptFieldType::USHORT: {
-			uint16_t data = script_instance->get_field_value<uint16_t>(name);
+			uint16_t data = script_instance->get_field_value<uint16_t>(field);
 			if (ImGui::DragInt(name.c_str(), (int*)&data, 1.0f,
 						std::numeric_limits<uint16_t>::min(),
 						std::numeric_limits<uint16_t>::max())) {
-				script_instance->set_field_value(name, data);
+				script_instance->set_field_value(field, data);
 
 				g_modify_info.set_modified();
 			}
 			break;
 		}
 		case ScriptFieldType::UINT: {
-			uint32_t data = script_instance->get_field_value<uint32_t>(name);
+			uint32_t data = script_instance->get_field_value<uint32_t>(field);
 			if (ImGui::DragInt(name.c_str(), (int*)&data, 1.0f,
 						std::numeric_limits<uint32_t>::min(),
 						std::numeric_limits<uint32_t>::max())) {
-				script_instance->set_field_value(name, data);
+				script_instance->set_field_value(field, data);
 
 				g_modify_info.set_modified();
 			}
 			break;
 		}
 		case ScriptFieldType::ULONG: {
-			uint64_t data = script_instance->get_field_value<uint64_t>(name);
+			uint64_t data = script_instance->get_field_value<uint64_t>(field);
 			if (ImGui::DragInt(name.c_str(), (int*)&data, 1.0f,
 						std::numeric_limits<uint32_t>::min(),
 						std::numeric_limits<uint32_t>::max())) {
-				script_instance->set_field_value(name, data);
+				script_instance->set_field_value(field, data);
 
 				g_modify_info.set_modified();
 			}
 			break;
 		}
 		case ScriptFieldType::VECTOR2: {
-			glm::vec2 data = script_instance->get_field_value<glm::vec2>(name);
+			glm::vec2 data = script_instance->get_field_value<glm::vec2>(field);
 			if (ImGui::DragFloat2(name.c_str(), &data[0])) {
-				script_instance->set_field_value(name, data);
+				script_instance->set_field_value(field, data);
 
 				g_modify_info.set_modified();
 			}
 			break;
 		}
 		case ScriptFieldType::VECTOR3: {
-			glm::vec3 data = script_instance->get_field_value<glm::vec3>(name);
+			glm::vec3 data = script_instance->get_field_value<glm::vec3>(field);
 			if (ImGui::DragFloat3(name.c_str(), &data[0])) {
-				script_instance->set_field_value(name, data);
+				script_instance->set_field_value(field, data);
 
 				g_modify_info.set_modified();
 			}
 			break;
 		}
 		case ScriptFieldType::VECTOR4: {
-			glm::vec4 data = script_instance->get_field_value<glm::vec4>(name);
+			glm::vec4 data = script_instance->get_field_value<glm::vec4>(field);
 			if (ImGui::DragFloat4(name.c_str(), &data[0])) {
-				script_instance->set_field_value(name, data);
+				script_instance->set_field_value(field, data);
 
 				g_modify_info.set_modified();
 			}
 			break;
 		}
 		case ScriptFieldType::COLOR: {
-			Color color = script_instance->get_field_value<Color>(name);
+			Color color = script_instance->get_field_value<Color>(field);
 			if (ImGui::ColorEdit4(name.c_str(), &color.r)) {
-				script_instance->set_field_value(name, color);
+				script_instance->set_field_value(field, color);
 
 				g_modify_info.set_modified();
 			}
 			break;
 		}
 		case ScriptFieldType::ENTITY: {
-			UID uuid = script_instance->get_field_value<UID>(name);
+			UID uuid = script_instance->get_field_value<UID>(field);
 			Entity entity = SceneManager::get_active()->find_by_id(uuid);
 
 			{
@@ -1252,7 +1466,7 @@ void draw_script_field_runtime(const std::string& name,
 				if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload(
 							"DND_PAYLOAD_ENTITY")) {
 					UID recv_id = *(const UID*)payload->Data;
-					script_instance->set_field_value(name, recv_id);
+					script_instance->set_field_value(field, recv_id);
 
 					g_modify_info.set_modified();
 				}
@@ -1264,3 +1478,54 @@ void draw_script_field_runtime(const std::string& name,
 			break;
 	}
 }
+
+bool draw_point_list(const char* id, std::vector<glm::vec2>& points,
+		size_t min_count, size_t max_count) {
+	ImGui::PushID(id);
+
+	bool changed = false;
+
+	int remove_index = -1;
+	for (size_t i = 0; i < points.size(); i++) {
+		ImGui::PushID((int)i);
+
+		const std::string label = std::format("Point {}", i);
+		EVE_BEGIN_FIELD(label.c_str());
+		{
+			const bool can_remove = points.size() > min_count;
+			if (can_remove) {
+				ImGui::SetNextItemWidth(field_width -
+						ImGui::GetFrameHeight() -
+						ImGui::GetStyle().ItemSpacing.x);
+			}
+
+			if (ImGui::DragFloat2("##Point", glm::value_ptr(points[i]), 0.01f)) {
+				changed = true;
+			}
+
+			if (can_remove) {
+				ImGui::SameLine();
+				if (ImGui::Button(ICON_FA_MINUS)) {
+					remove_index = i;
+				}
+			}
+		}
+		EVE_END_FIELD();
+
+		ImGui::PopID();
+	}
+
+	if (remove_index != -1) {
+		points.erase(points.begin() + remove_index);
+		changed = true;
+	}
+
+	if (points.size() < max_count && ImGui::Button("Add Point")) {
+		points.push_back(points.empty() ? glm::vec2(0.0f) : points.back());
+		changed = true;
+	}
+
+	ImGui::PopID();
+
+	return changed;
+}
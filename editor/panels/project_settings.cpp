@@ -102,6 +102,42 @@ void ProjectSettingsPanel::_draw_input_settings() {
 
 void ProjectSettingsPanel::_draw_physics_settings() {
 	ImGui::SeparatorText("Physics Settings");
+
+	Ref<Project> project = Project::get_active();
+
+	// applied to the scenes loaded afterwards
+	auto& physics = project->config.physics;
+
+	EVE_BEGIN_FIELD("Gravity");
+	{ ImGui::DragFloat2("##Gravity", &physics.gravity.x, 0.1f); }
+	EVE_END_FIELD();
+
+	EVE_BEGIN_FIELD("Deterministic");
+	{ ImGui::Checkbox("##Deterministic", &physics.deterministic); }
+	EVE_END_FIELD();
+
+	if (physics.deterministic) {
+		EVE_BEGIN_FIELD("Fixed Time Step");
+		{
+			ImGui::DragFloat("##FixedTimeStep", &physics.fixed_time_step,
+					0.001f, PhysicsSettings::MIN_FIXED_TIME_STEP,
+					PhysicsSettings::MAX_FIXED_TIME_STEP, "%.4f",
+					ImGuiSliderFlags_AlwaysClamp);
+		}
+		EVE_END_FIELD();
+
+		EVE_BEGIN_FIELD("Max Steps Per Frame");
+		{
+			int max_steps = (int)physics.max_steps_per_frame;
+			if (ImGui::DragInt("##MaxStepsPerFrame", &max_steps, 1.0f,
+						(int)PhysicsSettings::MIN_STEPS_PER_FRAME,
+						(int)PhysicsSettings::MAX_STEPS_PER_FRAME, "%d",
+						ImGuiSliderFlags_AlwaysClamp)) {
+				physics.max_steps_per_frame = (uint32_t)max_steps;
+			}
+		}
+		EVE_END_FIELD();
+	}
 }
 
 void ProjectSettingsPanel::_draw_scripting_settings() {
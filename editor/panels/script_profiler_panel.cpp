@@ -0,0 +1,170 @@
+#include "panels/script_profiler_panel.h"
+
+#include "scene/scene_manager.h"
+#include "scripting/script_profiler.h"
+
+#include <imgui.h>
+#include <tinyfiledialogs.h>
+
+// profiles sorted by the total time of their callbacks, the most expensive
+// come first
+template <typename Key>
+inline static std::vector<std::pair<Key, const ScriptProfile*>> sort_profiles(
+		const std::unordered_map<Key, ScriptProfile>& profiles) {
+	std::vector<std::pair<Key, const ScriptProfile*>> sorted;
+	sorted.reserve(profiles.size());
+
+	for (const auto& [key, profile] : profiles) {
+		sorted.emplace_back(key, &profile);
+	}
+
+	std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+		return a.second->get_total_ms() > b.second->get_total_ms();
+	});
+
+	return sorted;
+}
+
+inline static void draw_columns(std::initializer_list<const char*> names) {
+	for (const char* name : names) {
+		ImGui::TextUnformatted(name);
+		ImGui::NextColumn();
+	}
+
+	ImGui::Separator();
+}
+
+inline static void draw_average(const ScriptCallStats& stats) {
+	if (stats.call_count) {
+		ImGui::Text("%.4f", stats.total_ms / stats.call_count);
+	} else {
+		ImGui::TextUnformatted("-");
+	}
+
+	ImGui::NextColumn();
+}
+
+ScriptProfilerPanel::ScriptProfilerPanel() : Panel(false) {}
+
+void ScriptProfilerPanel::_draw() {
+	bool enabled = script_profiler::is_enabled();
+	if (ImGui::Checkbox("Record", &enabled)) {
+		script_profiler::set_enabled(enabled);
+	}
+
+	ImGui::SameLine();
+
+	if (ImGui::Button("Reset")) {
+		script_profiler::reset();
+	}
+
+	ImGui::SameLine();
+
+	if (ImGui::Button("Export")) {
+		_export();
+	}
+
+	ImGui::Text("%llu frames recorded",
+			(unsigned long long)script_profiler::get_frame_count());
+
+	if (!script_profiler::is_counting_allocations()) {
+		ImGui::TextDisabled("Allocations are not counted.");
+	}
+
+	if (ImGui::CollapsingHeader("Classes", ImGuiTreeNodeFlags_DefaultOpen)) {
+		_draw_classes();
+	}
+
+	if (ImGui::CollapsingHeader("Entities", ImGuiTreeNodeFlags_DefaultOpen)) {
+		_draw_entities();
+	}
+}
+
+void ScriptProfilerPanel::_draw_classes() {
+	const uint64_t frame_count =
+			std::max<uint64_t>(script_profiler::get_frame_count(), 1);
+
+	ImGui::Columns(7, "ClassProfiles");
+	draw_columns({ "Class", "Total ms", "Update ms/frame", "OnCreate avg ms",
+			"OnUpdate avg ms", "OnDestroy avg ms", "Allocations" });
+
+	for (const auto& [name, profile] :
+			sort_profiles(script_profiler::get_class_profiles())) {
+		const ScriptCallStats& update = profile->get(ScriptCallback::ON_UPDATE);
+
+		ImGui::TextUnformatted(name.c_str());
+		ImGui::NextColumn();
+
+		ImGui::Text("%.3f", profile->get_total_ms());
+		ImGui::NextColumn();
+
+		ImGui::Text("%.4f", update.total_ms / frame_count);
+		ImGui::NextColumn();
+
+		draw_average(profile->get(ScriptCallback::ON_CREATE));
+		draw_average(update);
+		draw_average(profile->get(ScriptCallback::ON_DESTROY));
+
+		ImGui::Text("%llu", (unsigned long long)profile->allocation_count);
+		ImGui::NextColumn();
+	}
+
+	ImGui::Columns();
+}
+
+void ScriptProfilerPanel::_draw_entities() {
+	ImGui::SliderInt("Shown", &entity_count, 10, 500);
+
+	Ref<Scene> scene = SceneManager::get_active();
+
+	ImGui::Columns(6, "EntityProfiles");
+	draw_columns({ "Entity", "Class", "Total ms", "OnUpdate avg ms",
+			"OnUpdate max ms", "Allocations" });
+
+	const auto profiles = sort_profiles(script_profiler::get_entity_profiles());
+
+	for (size_t i = 0; i < std::min<size_t>(profiles.size(), entity_count);
+			i++) {
+		const auto& [entity_id, profile] = profiles[i];
+		const ScriptCallStats& update = profile->get(ScriptCallback::ON_UPDATE);
+
+		// destroyed entities keep their profile
+		Entity entity = scene ? scene->find_by_id(entity_id) : Entity();
+		if (entity) {
+			ImGui::TextUnformatted(entity.get_name().c_str());
+		} else {
+			ImGui::TextDisabled("%llu", (unsigned long long)entity_id);
+		}
+		ImGui::NextColumn();
+
+		ImGui::TextUnformatted(profile->class_name.c_str());
+		ImGui::NextColumn();
+
+		ImGui::Text("%.3f", profile->get_total_ms());
+		ImGui::NextColumn();
+
+		draw_average(update);
+
+		ImGui::Text("%.4f", update.max_ms);
+		ImGui::NextColumn();
+
+		ImGui::Text("%llu", (unsigned long long)profile->allocation_count);
+		ImGui::NextColumn();
+	}
+
+	ImGui::Columns();
+}
+
+void ScriptProfilerPanel::_export() {
+	const char* filter_patterns[1] = { "*.json" };
+	const char* path = tinyfd_saveFileDialog("Export Script Profile",
+			"script_profile.json", 1, filter_patterns, "JSON Files");
+
+	if (!path) {
+		return;
+	}
+
+	json_utils::write_file(path, script_profiler::serialize());
+
+	EVE_LOG_INFO("Exported script profile to \"{}\".", path);
+}
@@ -0,0 +1,29 @@
+#ifndef SCRIPT_PROFILER_PANEL_H
+#define SCRIPT_PROFILER_PANEL_H
+
+#include "panels/panel.h"
+
+// Shows the time the scripts spend in their callbacks per class and for the
+// most expensive entities.
+class ScriptProfilerPanel : public Panel {
+	EVE_IMPL_PANEL("Script Profiler")
+
+public:
+	ScriptProfilerPanel();
+	virtual ~ScriptProfilerPanel() = default;
+
+protected:
+	void _draw() override;
+
+private:
+	void _draw_classes();
+
+	void _draw_entities();
+
+	void _export();
+
+private:
+	int entity_count = 50;
+};
+
+#endif
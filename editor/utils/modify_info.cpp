@@ -0,0 +1,19 @@
+#include "utils/modify_info.h"
+
+#include "scene/scene_manager.h"
+
+void SceneModifyInfo::set_modified() {
+	modified = true;
+	has_changes = true;
+
+	if (Ref<Scene> scene = SceneManager::get_active(); scene) {
+		for (Entity entity : scene->get_selected_entities()) {
+			dirty_ids.push_back(entity.get_uid());
+		}
+	}
+}
+
+void SceneModifyInfo::set_modified(Entity entity) {
+	dirty_ids.push_back(entity.get_uid());
+	set_modified();
+}
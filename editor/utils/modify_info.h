@@ -1,11 +1,29 @@
 #ifndef MODIFY_INFO_H
 #define MODIFY_INFO_H
 
+#include "core/uid.h"
+
+class Entity;
+
 struct SceneModifyInfo {
 	bool modified;
+	// changes not recorded by the scene journal yet
+	bool has_changes;
+	// entities the changes were made to, the journal only compares these
+	std::vector<UID> dirty_ids;
+
+	// edits go through the selection so it is marked as well
+	void set_modified();
+
+	void set_modified(Entity entity);
 
-	inline void set_modified() { modified = true; }
 	inline void on_save() { modified = false; }
+
+	inline bool consume_changes() {
+		const bool result = has_changes;
+		has_changes = false;
+		return result;
+	}
 };
 
 inline SceneModifyInfo g_modify_info{};
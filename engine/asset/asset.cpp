@@ -8,6 +8,8 @@ std::string serialize_asset_type(const AssetType type) {
 			return "FONT";
 		case AssetType::SCENE:
 			return "SCENE";
+		case AssetType::PREFAB:
+			return "PREFAB";
 		default:
 			return "";
 	}
@@ -21,8 +23,10 @@ AssetType get_asset_type_from_extension(const std::string& extension) {
 		return AssetType::TEXTURE;
 	} else if (extension == ".ttf" || extension == ".otf") {
 		return AssetType::FONT;
-	} else if (extension == ".escn") {
+	} else if (extension == ".escn" || extension == ".escb") {
 		return AssetType::SCENE;
+	} else if (extension == ".eprf") {
+		return AssetType::PREFAB;
 	} else {
 		return AssetType::NONE;
 	}
@@ -15,7 +15,8 @@ enum class AssetType : uint8_t {
 	NONE = 0,
 	TEXTURE,
 	FONT,
-	SCENE
+	SCENE,
+	PREFAB
 };
 
 std::string serialize_asset_type(const AssetType type);
@@ -37,6 +38,7 @@ NLOHMANN_JSON_SERIALIZE_ENUM(AssetType,
 				{ AssetType::TEXTURE, "texture" },
 				{ AssetType::FONT, "font" },
 				{ AssetType::SCENE, "scene" },
+				{ AssetType::PREFAB, "prefab" },
 		});
 
 #endif
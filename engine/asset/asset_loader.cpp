@@ -4,6 +4,7 @@
 #include "renderer/font.h"
 #include "renderer/texture.h"
 #include "scene/entity.h"
+#include "scene/prefab.h"
 
 NLOHMANN_JSON_SERIALIZE_ENUM(TextureFilteringMode,
 		{
@@ -21,29 +22,27 @@ NLOHMANN_JSON_SERIALIZE_ENUM(TextureWrappingMode,
 
 namespace asset_loader {
 
-Ref<Texture2D> load_texture(const fs::path& path) {
-	EVE_PROFILE_FUNCTION();
-
+// reads the .meta file of the texture, creates one with the default
+// settings if it does not exist yet
+static bool read_texture_metadata(const fs::path& path, AssetHandle& handle,
+		std::string& asset_path, TextureMetadata& metadata) {
 	// Get .meta path
 	fs::path metadata_path = path;
 	metadata_path.replace_extension(path.extension().string() + ".meta");
 
-	const std::string metadata_path_rel = Project::get_relative_asset_path(metadata_path.string());
-
 	// Create .meta if it doesn't exist
 	if (!fs::exists(metadata_path)) {
-		Ref<Texture2D> texture = create_ref<Texture2D>(path);
-		texture->handle = AssetHandle();
-		texture->path = Project::get_relative_asset_path(path.string());
+		handle = AssetHandle();
+		asset_path = Project::get_relative_asset_path(path.string());
+		metadata = TextureMetadata{};
 
 		// Create and populate JSON data
 		Json json{};
-		json["uid"] = texture->handle;
-		json["path"] = texture->path;
+		json["uid"] = handle;
+		json["path"] = asset_path;
 		json["type"] = AssetType::TEXTURE;
 
 		Json& json_metadata = json["metadata"];
-		TextureMetadata metadata{};
 		json_metadata["min_filter"] = metadata.min_filter;
 		json_metadata["mag_filter"] = metadata.mag_filter;
 		json_metadata["wrap_s"] = metadata.wrap_s;
@@ -53,33 +52,46 @@ Ref<Texture2D> load_texture(const fs::path& path) {
 		// Write JSON data to file
 		json_utils::write_file(metadata_path, json);
 
-		return texture;
+		return true;
 	}
 
 	// Read JSON data from file
 	Json json{};
 	if (!json_utils::read_file(metadata_path, json)) {
 		EVE_LOG_ERROR("Failed to load texture file from: {}", path.string());
-		return nullptr;
+		return false;
 	}
 
 	EVE_ASSERT(json["type"].get<std::string>() == "texture");
 
-	const std::string asset_path = json["path"].get<std::string>();
+	asset_path = json["path"].get<std::string>();
+	handle = json["uid"].get<AssetHandle>();
 
 	// Extract metadata from JSON
-	const auto json_metadata = json["metadata"];
-	TextureMetadata metadata{};
+	const auto& json_metadata = json["metadata"];
 	metadata.min_filter = json_metadata["min_filter"].get<TextureFilteringMode>();
 	metadata.mag_filter = json_metadata["mag_filter"].get<TextureFilteringMode>();
 	metadata.wrap_s = json_metadata["wrap_s"].get<TextureWrappingMode>();
 	metadata.wrap_t = json_metadata["wrap_t"].get<TextureWrappingMode>();
 	metadata.generate_mipmaps = json_metadata["generate_mipmaps"].get<bool>();
 
+	return true;
+}
+
+Ref<Texture2D> load_texture(const fs::path& path) {
+	EVE_PROFILE_FUNCTION();
+
+	AssetHandle handle;
+	std::string asset_path;
+	TextureMetadata metadata{};
+	if (!read_texture_metadata(path, handle, asset_path, metadata)) {
+		return nullptr;
+	}
+
 	// Create and return texture
 
 	Ref<Texture2D> texture = create_ref<Texture2D>(Project::get_asset_path(asset_path), metadata);
-	texture->handle = json["uid"].get<AssetHandle>();
+	texture->handle = handle;
 	texture->path = asset_path;
 
 	return texture;
@@ -131,4 +143,155 @@ Ref<Font> load_font(const fs::path& path) {
 	return font;
 }
 
+Ref<Prefab> load_prefab(const fs::path& path) {
+	EVE_PROFILE_FUNCTION();
+
+	// Get .meta path
+	fs::path metadata_path = path;
+	metadata_path.replace_extension(path.extension().string() + ".meta");
+
+	AssetHandle handle;
+	std::string asset_path;
+
+	// Create .meta if it doesn't exist
+	if (!fs::exists(metadata_path)) {
+		handle = AssetHandle();
+		asset_path = Project::get_relative_asset_path(path.string());
+
+		Json json{};
+		json["uid"] = handle;
+		json["path"] = asset_path;
+		json["type"] = AssetType::PREFAB;
+
+		json_utils::write_file(metadata_path, json);
+	} else {
+		Json json{};
+		if (!json_utils::read_file(metadata_path, json)) {
+			EVE_LOG_ERROR(
+					"Failed to load prefab file from: {}", path.string());
+			return nullptr;
+		}
+
+		EVE_ASSERT(json["type"].get<std::string>() == "prefab");
+
+		asset_path = json["path"].get<std::string>();
+		handle = json["uid"].get<AssetHandle>();
+	}
+
+	Ref<Prefab> prefab =
+			Prefab::deserialize(Project::get_asset_path(asset_path));
+	if (!prefab) {
+		return nullptr;
+	}
+
+	prefab->handle = handle;
+	prefab->path = asset_path;
+
+	return prefab;
+}
+
+PreparedAsset prepare_asset(const AssetLoadRequest& request) {
+	EVE_PROFILE_FUNCTION();
+
+	PreparedAsset prepared;
+	prepared.type = request.type;
+	prepared.path = Project::get_asset_path(request.path);
+
+	switch (request.type) {
+		case AssetType::TEXTURE:
+			if (!read_texture_metadata(prepared.path, prepared.handle,
+						prepared.asset_path, prepared.metadata)) {
+				break;
+			}
+
+			prepared.is_valid = load_texture_image(
+					Project::get_asset_path(prepared.asset_path),
+					prepared.image);
+			break;
+		case AssetType::FONT:
+			// font atlases are generated with the renderer resources
+			prepared.is_valid = true;
+			break;
+		case AssetType::PREFAB:
+			prepared.asset = load_prefab(prepared.path);
+			prepared.is_valid = prepared.asset != nullptr;
+			break;
+		default:
+			break;
+	}
+
+	return prepared;
+}
+
+PendingAssetLoads prepare_assets_async(
+		const std::vector<AssetLoadRequest>& requests) {
+	EVE_PROFILE_FUNCTION();
+
+	std::vector<AssetLoadRequest> pending_requests;
+	for (const AssetLoadRequest& request : requests) {
+		if (!fs::exists(Project::get_asset_path(request.path))) {
+			continue;
+		}
+
+		pending_requests.push_back(request);
+	}
+
+	const size_t worker_count = std::min<size_t>(pending_requests.size(),
+			std::max(std::thread::hardware_concurrency(), 1u));
+
+	PendingAssetLoads loads;
+	for (size_t worker = 0; worker < worker_count; worker++) {
+		std::vector<AssetLoadRequest> worker_requests;
+		for (size_t i = worker; i < pending_requests.size();
+				i += worker_count) {
+			worker_requests.push_back(pending_requests[i]);
+		}
+
+		loads.push_back(std::async(std::launch::async,
+				[worker_requests = std::move(worker_requests)]() {
+					std::vector<PreparedAsset> prepared_assets;
+					prepared_assets.reserve(worker_requests.size());
+
+					for (const AssetLoadRequest& request : worker_requests) {
+						prepared_assets.push_back(prepare_asset(request));
+					}
+
+					return prepared_assets;
+				}));
+	}
+
+	return loads;
+}
+
+Ref<Asset> finish_asset(PreparedAsset& prepared) {
+	EVE_PROFILE_FUNCTION();
+
+	if (!prepared.is_valid) {
+		return nullptr;
+	}
+
+	switch (prepared.type) {
+		case AssetType::TEXTURE: {
+			TextureMetadata metadata = prepared.metadata;
+			metadata.format = prepared.image.format;
+
+			Ref<Texture2D> texture = create_ref<Texture2D>(
+					metadata, prepared.image.pixels.data(), prepared.image.size);
+			texture->handle = prepared.handle;
+			texture->path = prepared.asset_path;
+
+			// pixels are on the gpu now
+			prepared.image.pixels = {};
+
+			return texture;
+		}
+		case AssetType::FONT:
+			return load_font(prepared.path);
+		case AssetType::PREFAB:
+			return prepared.asset;
+		default:
+			return nullptr;
+	}
+}
+
 } //namespace asset_loader
@@ -1,16 +1,58 @@
 #ifndef ASSET_LOADER_H
 #define ASSET_LOADER_H
 
-class Texture2D;
+#include "asset/asset.h"
+#include "renderer/texture.h"
+
 class Font;
+class Prefab;
 class Scene;
 
+struct AssetLoadRequest {
+	std::string path;
+	AssetType type;
+	AssetHandle handle;
+};
+
+// The part of an asset load which does not need the renderer, created on
+// worker threads and turned into an asset on the main thread.
+struct PreparedAsset {
+	AssetType type = AssetType::NONE;
+	fs::path path;
+	bool is_valid = false;
+
+	// textures only
+	AssetHandle handle = INVALID_UID;
+	std::string asset_path;
+	TextureMetadata metadata;
+	TextureImage image;
+
+	// assets which need no renderer resources are created by the worker
+	Ref<Asset> asset = nullptr;
+};
+
+// every worker prepares a group of assets
+using PendingAssetLoads = std::vector<std::future<std::vector<PreparedAsset>>>;
+
 namespace asset_loader {
 
 Ref<Texture2D> load_texture(const fs::path& path);
 
 Ref<Font> load_font(const fs::path& path);
 
+Ref<Prefab> load_prefab(const fs::path& path);
+
+// thread safe, reads the metadata and decodes the asset file
+PreparedAsset prepare_asset(const AssetLoadRequest& request);
+
+// prepares the existing assets on worker threads, does not touch any asset
+// registry so it can be called from any thread
+PendingAssetLoads prepare_assets_async(
+		const std::vector<AssetLoadRequest>& requests);
+
+// creates the renderer resources, must be called from the main thread
+Ref<Asset> finish_asset(PreparedAsset& prepared);
+
 } //namespace asset_loader
 
 #endif
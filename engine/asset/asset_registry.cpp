@@ -106,6 +106,9 @@ AssetHandle AssetRegistry::load_asset(
 		case AssetType::FONT:
 			asset = asset_loader::load_font(path_abs);
 			break;
+		case AssetType::PREFAB:
+			asset = asset_loader::load_prefab(path_abs);
+			break;
 		default:
 			return INVALID_UID;
 	}
@@ -116,14 +119,46 @@ AssetHandle AssetRegistry::load_asset(
 		return INVALID_UID;
 	}
 
-	// unload if already has that id to reload
-	unload_asset(asset->handle);
-
-	assets[asset->handle] = asset;
+	_add_asset(asset);
 
 	return asset->handle;
 }
 
+PendingAssetLoads AssetRegistry::load_assets_async(
+		const std::vector<AssetLoadRequest>& requests) {
+	EVE_PROFILE_FUNCTION();
+
+	std::vector<AssetLoadRequest> pending_requests;
+	for (const AssetLoadRequest& request : requests) {
+		if (assets.find(request.handle) != assets.end()) {
+			continue;
+		}
+
+		pending_requests.push_back(request);
+	}
+
+	return asset_loader::prepare_assets_async(pending_requests);
+}
+
+void AssetRegistry::finish_asset_loads(PendingAssetLoads& loads) {
+	EVE_PROFILE_FUNCTION();
+
+	for (auto& load : loads) {
+		for (PreparedAsset& prepared : load.get()) {
+			Ref<Asset> asset = asset_loader::finish_asset(prepared);
+			if (!asset) {
+				EVE_LOG_ERROR("Unable to load asset from: {0}.",
+						prepared.path.string());
+				continue;
+			}
+
+			_add_asset(asset);
+		}
+	}
+
+	loads.clear();
+}
+
 void AssetRegistry::unload_asset(const AssetHandle& handle) {
 	const auto it = assets.find(handle);
 	if (it == assets.end()) {
@@ -217,6 +252,13 @@ void AssetRegistry::_on_asset_rename(
 	json_utils::write_file(asset_path_new, json);
 }
 
+void AssetRegistry::_add_asset(Ref<Asset> asset) {
+	// unload if already has that id to reload
+	unload_asset(asset->handle);
+
+	assets[asset->handle] = asset;
+}
+
 AssetPack& AssetRegistry::get_assets() { return assets; }
 
 AssetPack::iterator AssetRegistry::begin() { return assets.begin(); }
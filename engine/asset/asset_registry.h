@@ -2,6 +2,7 @@
 #define ASSET_REGISTRY_H
 
 #include "asset/asset.h"
+#include "asset/asset_loader.h"
 
 using AssetPack = std::unordered_map<AssetHandle, Ref<Asset>>;
 
@@ -23,11 +24,18 @@ public:
 		return std::static_pointer_cast<T>(asset);
 	}
 
-	// TODO make an async version
-
 	AssetHandle load_asset(const std::string& path, AssetType type,
 			AssetHandle handle = AssetHandle());
 
+	// decodes the assets on worker threads, they are added to the registry
+	// by finish_asset_loads
+	PendingAssetLoads load_assets_async(
+			const std::vector<AssetLoadRequest>& requests);
+
+	// waits for the workers and creates the renderer resources, must be
+	// called from the main thread
+	void finish_asset_loads(PendingAssetLoads& loads);
+
 	void unload_asset(const AssetHandle& handle);
 
 	void unload_asset(const std::string& path);
@@ -47,6 +55,8 @@ public:
 	AssetPack::const_iterator end() const;
 
 private:
+	void _add_asset(Ref<Asset> asset);
+
 	void _on_asset_rename(const fs::path& old_path, const fs::path& new_path);
 
 private:
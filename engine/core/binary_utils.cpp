@@ -0,0 +1,73 @@
+#include "core/binary_utils.h"
+
+void BinaryWriter::write_bytes(const void* data, size_t size) {
+	if (size == 0) {
+		return;
+	}
+
+	const uint8_t* bytes = static_cast<const uint8_t*>(data);
+	buffer.insert(buffer.end(), bytes, bytes + size);
+}
+
+void BinaryWriter::write_string(std::string_view string) {
+	write<uint32_t>(string.size());
+	write_bytes(string.data(), string.size());
+}
+
+void BinaryWriter::truncate(size_t size) {
+	EVE_ASSERT(size <= buffer.size());
+	buffer.resize(size);
+}
+
+size_t BinaryWriter::get_size() const { return buffer.size(); }
+
+const uint8_t* BinaryWriter::get_data() const { return buffer.data(); }
+
+void BinaryWriter::clear() { buffer.clear(); }
+
+BinaryReader::BinaryReader(const uint8_t* data, size_t size) :
+		data(data), size(size) {}
+
+bool BinaryReader::read_bytes(void* out, size_t count) {
+	if (failed || count > get_remaining()) {
+		failed = true;
+		return false;
+	}
+
+	if (count > 0) {
+		memcpy(out, data + position, count);
+		position += count;
+	}
+
+	return true;
+}
+
+bool BinaryReader::read_string(std::string_view& string) {
+	uint32_t length = 0;
+	if (!read(length) || length > get_remaining()) {
+		failed = true;
+		return false;
+	}
+
+	string = std::string_view((const char*)data + position, length);
+	position += length;
+
+	return true;
+}
+
+bool BinaryReader::skip(size_t count) {
+	if (failed || count > get_remaining()) {
+		failed = true;
+		return false;
+	}
+
+	position += count;
+
+	return true;
+}
+
+size_t BinaryReader::get_position() const { return position; }
+
+size_t BinaryReader::get_remaining() const { return size - position; }
+
+bool BinaryReader::is_valid() const { return !failed; }
@@ -0,0 +1,98 @@
+#ifndef BINARY_UTILS_H
+#define BINARY_UTILS_H
+
+// Appends little endian plain data to a growing byte buffer.
+class BinaryWriter {
+public:
+	template <typename T>
+	inline void write(const T& value) {
+		static_assert(std::is_trivially_copyable_v<T>,
+				"Type must be trivially copyable!");
+		write_bytes(&value, sizeof(T));
+	}
+
+	template <typename T>
+	inline void write_array(const std::vector<T>& values) {
+		static_assert(std::is_trivially_copyable_v<T>,
+				"Type must be trivially copyable!");
+		write<uint32_t>(values.size());
+		write_bytes(values.data(), values.size() * sizeof(T));
+	}
+
+	void write_bytes(const void* data, size_t size);
+
+	// length prefixed, not null terminated
+	void write_string(std::string_view string);
+
+	// overwrites already written bytes, used to patch sizes and counts
+	template <typename T>
+	inline void write_at(size_t offset, const T& value) {
+		static_assert(std::is_trivially_copyable_v<T>,
+				"Type must be trivially copyable!");
+		EVE_ASSERT(offset + sizeof(T) <= buffer.size());
+		memcpy(buffer.data() + offset, &value, sizeof(T));
+	}
+
+	// drops every byte written after the given size
+	void truncate(size_t size);
+
+	size_t get_size() const;
+
+	const uint8_t* get_data() const;
+
+	void clear();
+
+private:
+	std::vector<uint8_t> buffer;
+};
+
+// Reads plain data out of a byte range, every read after the first failed
+// one fails as well so callers can check the state once at the end.
+class BinaryReader {
+public:
+	BinaryReader(const uint8_t* data, size_t size);
+
+	template <typename T>
+	inline bool read(T& value) {
+		static_assert(std::is_trivially_copyable_v<T>,
+				"Type must be trivially copyable!");
+		return read_bytes(&value, sizeof(T));
+	}
+
+	template <typename T>
+	inline bool read_array(std::vector<T>& values) {
+		static_assert(std::is_trivially_copyable_v<T>,
+				"Type must be trivially copyable!");
+
+		uint32_t count = 0;
+		if (!read(count) || count * sizeof(T) > get_remaining()) {
+			failed = true;
+			return false;
+		}
+
+		values.resize(count);
+		return read_bytes(values.data(), count * sizeof(T));
+	}
+
+	bool read_bytes(void* data, size_t size);
+
+	// returned view points into the source data
+	bool read_string(std::string_view& string);
+
+	bool skip(size_t size);
+
+	// offset of the next read from the start of the data
+	size_t get_position() const;
+
+	size_t get_remaining() const;
+
+	bool is_valid() const;
+
+private:
+	const uint8_t* data;
+	size_t size;
+	size_t position = 0;
+	bool failed = false;
+};
+
+#endif
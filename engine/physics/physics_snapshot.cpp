@@ -0,0 +1,103 @@
+#include "physics/physics_snapshot.h"
+
+namespace physics_snapshot {
+
+// "EPSN" in little endian
+inline constexpr uint32_t SNAPSHOT_MAGIC = 0x4E535045;
+inline constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+struct SnapshotHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t step;
+	uint64_t body_count;
+};
+
+void serialize(const PhysicsSnapshot& snapshot, std::vector<uint8_t>& out) {
+	EVE_PROFILE_FUNCTION();
+
+	const SnapshotHeader header = {
+		SNAPSHOT_MAGIC,
+		SNAPSHOT_VERSION,
+		snapshot.step,
+		snapshot.bodies.size(),
+	};
+
+	const size_t bodies_size =
+			snapshot.bodies.size() * sizeof(PhysicsBodyState);
+
+	out.resize(sizeof(SnapshotHeader) + bodies_size);
+
+	memcpy(out.data(), &header, sizeof(SnapshotHeader));
+	if (bodies_size > 0) {
+		memcpy(out.data() + sizeof(SnapshotHeader), snapshot.bodies.data(),
+				bodies_size);
+	}
+}
+
+bool deserialize(const uint8_t* data, size_t size, PhysicsSnapshot& out) {
+	EVE_PROFILE_FUNCTION();
+
+	if (!data || size < sizeof(SnapshotHeader)) {
+		EVE_LOG_ERROR("Unable to read physics snapshot, data is too small.");
+		return false;
+	}
+
+	SnapshotHeader header;
+	memcpy(&header, data, sizeof(SnapshotHeader));
+
+	if (header.magic != SNAPSHOT_MAGIC ||
+			header.version != SNAPSHOT_VERSION) {
+		EVE_LOG_ERROR("Unable to read physics snapshot, unknown format.");
+		return false;
+	}
+
+	const size_t bodies_size = header.body_count * sizeof(PhysicsBodyState);
+	if (size - sizeof(SnapshotHeader) < bodies_size) {
+		EVE_LOG_ERROR("Unable to read physics snapshot, data is truncated.");
+		return false;
+	}
+
+	out.step = header.step;
+	out.bodies.resize(header.body_count);
+	if (bodies_size > 0) {
+		memcpy(out.bodies.data(), data + sizeof(SnapshotHeader), bodies_size);
+	}
+
+	return true;
+}
+
+inline constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+inline constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+template <typename T>
+inline static void hash_combine(uint64_t& hash, const T& value) {
+	const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+	for (size_t i = 0; i < sizeof(T); i++) {
+		hash ^= bytes[i];
+		hash *= FNV_PRIME;
+	}
+}
+
+uint64_t hash(const PhysicsSnapshot& snapshot) {
+	EVE_PROFILE_FUNCTION();
+
+	uint64_t hash = FNV_OFFSET_BASIS;
+	hash_combine(hash, snapshot.step);
+
+	// hash field by field so struct padding does not leak in
+	for (const PhysicsBodyState& state : snapshot.bodies) {
+		hash_combine(hash, state.entity_id);
+		hash_combine(hash, state.position.x);
+		hash_combine(hash, state.position.y);
+		hash_combine(hash, state.angle);
+		hash_combine(hash, state.linear_velocity.x);
+		hash_combine(hash, state.linear_velocity.y);
+		hash_combine(hash, state.angular_velocity);
+		hash_combine(hash, state.flags);
+	}
+
+	return hash;
+}
+
+} //namespace physics_snapshot
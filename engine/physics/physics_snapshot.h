@@ -0,0 +1,42 @@
+#ifndef PHYSICS_SNAPSHOT_H
+#define PHYSICS_SNAPSHOT_H
+
+enum PhysicsBodyStateFlags : uint32_t {
+	PHYSICS_BODY_STATE_FLAG_AWAKE = 1 << 0,
+	PHYSICS_BODY_STATE_FLAG_ENABLED = 1 << 1,
+};
+
+struct PhysicsBodyState {
+	uint64_t entity_id;
+	glm::vec2 position;
+	float angle;
+	glm::vec2 linear_velocity;
+	float angular_velocity;
+	uint32_t flags;
+	// snapshots are stored and compared byte by byte, the padding the
+	// compiler would add has to be zero
+	uint32_t _pad = 0;
+};
+
+static_assert(sizeof(PhysicsBodyState) == 40, "PhysicsBodyState has padding!");
+
+// State of every body of a physics world at a given step.
+struct PhysicsSnapshot {
+	uint64_t step = 0;
+	std::vector<PhysicsBodyState> bodies;
+};
+
+namespace physics_snapshot {
+
+// Writes the snapshot in a compact binary form, body states are stored as is
+// so the data is only portable between machines with the same endianness.
+void serialize(const PhysicsSnapshot& snapshot, std::vector<uint8_t>& out);
+
+bool deserialize(const uint8_t* data, size_t size, PhysicsSnapshot& out);
+
+// FNV-1a hash of the step and body states in the order they are stored
+uint64_t hash(const PhysicsSnapshot& snapshot);
+
+} //namespace physics_snapshot
+
+#endif
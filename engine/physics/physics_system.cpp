@@ -2,23 +2,74 @@
 
 #include "scene/components.h"
 #include "scene/entity.h"
+#include "scripting/script_events.h"
 
 #include <box2d/b2_body.h>
+#include <box2d/b2_chain_shape.h>
 #include <box2d/b2_circle_shape.h>
+#include <box2d/b2_collision.h>
 #include <box2d/b2_contact.h>
+#include <box2d/b2_distance.h>
 #include <box2d/b2_fixture.h>
 #include <box2d/b2_polygon_shape.h>
 #include <box2d/b2_world.h>
 
 struct FixtureUserData {
 	Entity entity = INVALID_ENTITY;
+	// bodies are destroyed after their entities, end contacts can not ask
+	// the entity for it
+	UID entity_id = INVALID_UID;
 	bool is_trigger = false;
 	CollisionTriggerFunction trigger_function = nullptr;
 };
 
 static std::vector<Scope<FixtureUserData>> s_fixture_user_datas{};
 
+// both entities get an event, as trigger events if one of them is a trigger
+inline static void push_contact_events(const FixtureUserData* user_data_a,
+		const FixtureUserData* user_data_b, bool is_begin) {
+	if (!script_events::is_enabled()) {
+		return;
+	}
+
+	const bool is_trigger = user_data_a->is_trigger || user_data_b->is_trigger;
+
+	ScriptEventType type;
+	if (is_trigger) {
+		type = is_begin ? ScriptEventType::TRIGGER_BEGIN
+						: ScriptEventType::TRIGGER_END;
+	} else {
+		type = is_begin ? ScriptEventType::COLLISION_BEGIN
+						: ScriptEventType::COLLISION_END;
+	}
+
+	script_events::push_contact(
+			type, user_data_a->entity_id, user_data_b->entity_id);
+	script_events::push_contact(
+			type, user_data_b->entity_id, user_data_a->entity_id);
+}
+
+// smaller entity id first, triggers are counted apart from the collisions
+using ContactPair = std::tuple<uint64_t, uint64_t, bool>;
+
+inline static ContactPair get_contact_pair(const FixtureUserData* user_data_a,
+		const FixtureUserData* user_data_b) {
+	const bool is_trigger = user_data_a->is_trigger || user_data_b->is_trigger;
+	const uint64_t id_a = user_data_a->entity_id;
+	const uint64_t id_b = user_data_b->entity_id;
+
+	return { std::min(id_a, id_b), std::max(id_a, id_b), is_trigger };
+}
+
+// Box2D reports a contact for every fixture and every chain edge, capsules
+// and chains touch with more than one of them at once. Touching contacts
+// are counted per entity pair so that the entities only get the first
+// begin and the last end.
 class Physics2DContactListener : public b2ContactListener {
+public:
+	inline void clear() { contact_counts.clear(); }
+
+private:
 	inline void BeginContact(b2Contact* contact) override {
 		b2Fixture* fixture_a = contact->GetFixtureA();
 		b2Fixture* fixture_b = contact->GetFixtureB();
@@ -30,14 +81,50 @@ class Physics2DContactListener : public b2ContactListener {
 			return;
 		}
 
-		if (user_data_a->is_trigger && user_data_a->trigger_function && user_data_b->entity) {
-			user_data_a->trigger_function(user_data_b->entity.get_uid());
+		uint32_t& count =
+				contact_counts[get_contact_pair(user_data_a, user_data_b)];
+		if (count++ > 0) {
+			return;
+		}
+
+		if (user_data_a->is_trigger && user_data_a->trigger_function &&
+				user_data_b->entity_id) {
+			user_data_a->trigger_function(user_data_b->entity_id);
+		}
+
+		if (user_data_b->is_trigger && user_data_b->trigger_function &&
+				user_data_a->entity_id) {
+			user_data_b->trigger_function(user_data_a->entity_id);
+		}
+
+		push_contact_events(user_data_a, user_data_b, true);
+	}
+
+	inline void EndContact(b2Contact* contact) override {
+		const FixtureUserData* user_data_a =
+				reinterpret_cast<const FixtureUserData*>(
+						contact->GetFixtureA()->GetUserData().pointer);
+		const FixtureUserData* user_data_b =
+				reinterpret_cast<const FixtureUserData*>(
+						contact->GetFixtureB()->GetUserData().pointer);
+
+		if (!user_data_a || !user_data_b) {
+			return;
 		}
 
-		if (user_data_b->is_trigger && user_data_b->trigger_function && user_data_a->entity) {
-			user_data_b->trigger_function(user_data_a->entity.get_uid());
+		const auto it =
+				contact_counts.find(get_contact_pair(user_data_a, user_data_b));
+		if (it == contact_counts.end() || --it->second > 0) {
+			return;
 		}
+
+		contact_counts.erase(it);
+
+		push_contact_events(user_data_a, user_data_b, false);
 	}
+
+private:
+	std::map<ContactPair, uint32_t> contact_counts;
 };
 
 inline static b2BodyType rigidbody2d_type_to_box2d_body(Rigidbody2D::BodyType bodyType) {
@@ -115,6 +202,7 @@ inline static b2Fixture* create_box_fixture(Entity entity, b2Body* body) {
 	// set user data
 	auto user_data = create_scope<FixtureUserData>();
 	user_data->entity = entity;
+	user_data->entity_id = entity.get_uid();
 	user_data->is_trigger = bc2d.is_trigger;
 	user_data->trigger_function = bc2d.trigger_function;
 
@@ -148,6 +236,7 @@ inline static b2Fixture* create_circle_fixture(Entity entity, b2Body* body) {
 	// set user data
 	auto user_data = create_scope<FixtureUserData>();
 	user_data->entity = entity;
+	user_data->entity_id = entity.get_uid();
 	user_data->is_trigger = cc2d.is_trigger;
 	user_data->trigger_function = cc2d.trigger_function;
 
@@ -164,16 +253,269 @@ inline static b2Fixture* create_circle_fixture(Entity entity, b2Body* body) {
 	return fixture;
 }
 
+inline static uintptr_t create_fixture_user_data(Entity entity, bool is_trigger,
+		CollisionTriggerFunction trigger_function) {
+	auto user_data = create_scope<FixtureUserData>();
+	user_data->entity = entity;
+	user_data->entity_id = entity.get_uid();
+	user_data->is_trigger = is_trigger;
+	user_data->trigger_function = trigger_function;
+
+	const uintptr_t pointer = reinterpret_cast<uintptr_t>(user_data.get());
+
+	s_fixture_user_datas.emplace_back(std::move(user_data));
+
+	return pointer;
+}
+
+// destroys every fixture of a collider, capsules are made out of up to
+// three fixtures sharing the same user data
+inline static void destroy_collider_fixtures(
+		b2Body* body, void*& runtime_fixture) {
+	b2Fixture* collider_fixture = (b2Fixture*)runtime_fixture;
+	if (!collider_fixture) {
+		return;
+	}
+
+	const uintptr_t user_data = collider_fixture->GetUserData().pointer;
+
+	b2Fixture* fixture = body->GetFixtureList();
+	while (fixture) {
+		b2Fixture* next = fixture->GetNext();
+		if (fixture->GetUserData().pointer == user_data) {
+			body->DestroyFixture(fixture);
+		}
+
+		fixture = next;
+	}
+
+	// erased after the fixtures, their end contacts still read it
+	std::erase_if(s_fixture_user_datas,
+			[user_data](const Scope<FixtureUserData>& fixture_user_data) {
+				return reinterpret_cast<uintptr_t>(fixture_user_data.get()) ==
+						user_data;
+			});
+
+	runtime_fixture = nullptr;
+}
+
+inline static b2Fixture* create_polygon_fixture(Entity entity, b2Body* body) {
+	auto& transform = entity.get_transform();
+	auto& pc2d = entity.get_component<PolygonCollider2D>();
+
+	// failed shapes are not retried until they change
+	pc2d.runtime_dirty = false;
+	pc2d.runtime_scale = glm::vec2(transform.get_scale());
+
+	if (pc2d.points.size() < 3 || pc2d.points.size() > b2_maxPolygonVertices) {
+		EVE_LOG_ERROR("PolygonCollider2D of {} needs between 3 and {} points.",
+				entity.get_name(), b2_maxPolygonVertices);
+		return nullptr;
+	}
+
+	const glm::vec2 scale = glm::vec2(transform.get_scale());
+
+	b2Vec2 vertices[b2_maxPolygonVertices];
+	for (size_t i = 0; i < pc2d.points.size(); i++) {
+		vertices[i] = vec2_to_b2Vec2(pc2d.points[i] * scale + pc2d.offset);
+	}
+
+	b2PolygonShape polygon_shape;
+	if (!polygon_shape.Set(vertices, (int32)pc2d.points.size())) {
+		EVE_LOG_ERROR("PolygonCollider2D of {} is not convex.",
+				entity.get_name());
+		return nullptr;
+	}
+
+	b2FixtureDef fixture_def;
+	fixture_def.shape = &polygon_shape;
+	fixture_def.density = pc2d.density;
+	fixture_def.friction = pc2d.friction;
+	fixture_def.restitution = pc2d.restitution;
+	fixture_def.restitutionThreshold = pc2d.restitution_threshold;
+	fixture_def.userData.pointer = create_fixture_user_data(
+			entity, pc2d.is_trigger, pc2d.trigger_function);
+
+	b2Fixture* fixture = body->CreateFixture(&fixture_def);
+	pc2d.runtime_fixture = fixture;
+
+	return fixture;
+}
+
+inline static b2Fixture* create_capsule_fixture(Entity entity, b2Body* body) {
+	auto& transform = entity.get_transform();
+	auto& cc2d = entity.get_component<CapsuleCollider2D>();
+
+	const glm::vec2 scale = glm::vec2(transform.get_scale());
+	cc2d.runtime_dirty = false;
+	cc2d.runtime_scale = scale;
+	const float radius = cc2d.radius * scale.x;
+	const float half_height = glm::max(cc2d.height * scale.y * 0.5f, radius);
+	// distance between the center and the cap centers
+	const float cap_distance = half_height - radius;
+
+	b2FixtureDef fixture_def;
+	fixture_def.density = cc2d.density;
+	fixture_def.friction = cc2d.friction;
+	fixture_def.restitution = cc2d.restitution;
+	fixture_def.restitutionThreshold = cc2d.restitution_threshold;
+	fixture_def.userData.pointer = create_fixture_user_data(
+			entity, cc2d.is_trigger, cc2d.trigger_function);
+
+	b2CircleShape cap_shape;
+	cap_shape.m_radius = radius;
+
+	cap_shape.m_p.Set(cc2d.offset.x, cc2d.offset.y + cap_distance);
+	fixture_def.shape = &cap_shape;
+	b2Fixture* fixture = body->CreateFixture(&fixture_def);
+
+	// degenerates into a circle if there is no room for the body
+	if (cap_distance > 0.0f) {
+		cap_shape.m_p.Set(cc2d.offset.x, cc2d.offset.y - cap_distance);
+		body->CreateFixture(&fixture_def);
+
+		b2PolygonShape body_shape;
+		body_shape.SetAsBox(radius, cap_distance,
+				vec2_to_b2Vec2(cc2d.offset), 0.0f);
+
+		fixture_def.shape = &body_shape;
+		body->CreateFixture(&fixture_def);
+	}
+
+	cc2d.runtime_fixture = fixture;
+
+	return fixture;
+}
+
+inline static b2Fixture* create_chain_fixture(Entity entity, b2Body* body) {
+	auto& transform = entity.get_transform();
+	auto& ch2d = entity.get_component<ChainCollider2D>();
+
+	ch2d.runtime_dirty = false;
+	ch2d.runtime_scale = glm::vec2(transform.get_scale());
+
+	const size_t min_points = ch2d.is_loop ? 3 : 2;
+	if (ch2d.points.size() < min_points) {
+		return nullptr;
+	}
+
+	const glm::vec2 scale = glm::vec2(transform.get_scale());
+
+	std::vector<b2Vec2> vertices(ch2d.points.size());
+	for (size_t i = 0; i < ch2d.points.size(); i++) {
+		vertices[i] = vec2_to_b2Vec2(ch2d.points[i] * scale);
+	}
+
+	b2ChainShape chain_shape;
+	if (ch2d.is_loop) {
+		chain_shape.CreateLoop(vertices.data(), (int32)vertices.size());
+	} else {
+		// extend the ghost vertices along the end segments
+		const b2Vec2 prev_vertex = vertices[0] + (vertices[0] - vertices[1]);
+		const b2Vec2 next_vertex = vertices.back() +
+				(vertices.back() - vertices[vertices.size() - 2]);
+
+		chain_shape.CreateChain(vertices.data(), (int32)vertices.size(),
+				prev_vertex, next_vertex);
+	}
+
+	b2FixtureDef fixture_def;
+	fixture_def.shape = &chain_shape;
+	fixture_def.friction = ch2d.friction;
+	fixture_def.restitution = ch2d.restitution;
+	fixture_def.restitutionThreshold = ch2d.restitution_threshold;
+	fixture_def.userData.pointer =
+			create_fixture_user_data(entity, false, nullptr);
+
+	b2Fixture* fixture = body->CreateFixture(&fixture_def);
+	ch2d.runtime_fixture = fixture;
+
+	return fixture;
+}
+
+// polygon, capsule and chain shapes are baked into their fixtures, they are
+// rebuilt when the collider is edited or the scale of the entity changes
+template <typename T>
+inline static bool is_shape_outdated(Entity entity, const T& collider) {
+	return collider.runtime_dirty ||
+			collider.runtime_scale !=
+			glm::vec2(entity.get_transform().get_scale());
+}
+
+inline static void sync_polygon_fixture(Entity entity, b2Body* body) {
+	auto& pc2d = entity.get_component<PolygonCollider2D>();
+	if (!is_shape_outdated(entity, pc2d)) {
+		return;
+	}
+
+	destroy_collider_fixtures(body, pc2d.runtime_fixture);
+	create_polygon_fixture(entity, body);
+}
+
+inline static void sync_capsule_fixture(Entity entity, b2Body* body) {
+	auto& cc2d = entity.get_component<CapsuleCollider2D>();
+	if (!is_shape_outdated(entity, cc2d)) {
+		return;
+	}
+
+	destroy_collider_fixtures(body, cc2d.runtime_fixture);
+	create_capsule_fixture(entity, body);
+}
+
+inline static void sync_chain_fixture(Entity entity, b2Body* body) {
+	auto& ch2d = entity.get_component<ChainCollider2D>();
+	if (!is_shape_outdated(entity, ch2d)) {
+		return;
+	}
+
+	destroy_collider_fixtures(body, ch2d.runtime_fixture);
+	create_chain_fixture(entity, body);
+}
+
+inline static b2Body* create_body_with_fixtures(Entity entity, b2World* world) {
+	b2Body* body = create_body(entity, world);
+
+	if (entity.has_component<BoxCollider2D>()) {
+		create_box_fixture(entity, body);
+	}
+
+	if (entity.has_component<CircleCollider2D>()) {
+		create_circle_fixture(entity, body);
+	}
+
+	if (entity.has_component<PolygonCollider2D>()) {
+		create_polygon_fixture(entity, body);
+	}
+
+	if (entity.has_component<CapsuleCollider2D>()) {
+		create_capsule_fixture(entity, body);
+	}
+
+	if (entity.has_component<ChainCollider2D>()) {
+		create_chain_fixture(entity, body);
+	}
+
+	return body;
+}
+
+inline static void sort_by_uid(std::vector<Entity>& entities) {
+	std::sort(entities.begin(), entities.end(),
+			[](const Entity& lhs, const Entity& rhs) {
+				return (uint64_t)lhs.get_uid() < (uint64_t)rhs.get_uid();
+			});
+}
+
 PhysicsSystem::PhysicsSystem(Scene* scene, const PhysicsSettings& settings) :
 		scene(scene), settings(settings) {
 	world2d = new b2World({ settings.gravity.x, settings.gravity.y });
 
-	static Physics2DContactListener s_contact_listener2d{};
-	world2d->SetContactListener(&s_contact_listener2d);
+	contact_listener = new Physics2DContactListener();
+	world2d->SetContactListener(contact_listener);
 }
 
 PhysicsSystem::~PhysicsSystem() {
 	delete world2d;
+	delete contact_listener;
 }
 
 void PhysicsSystem::start() {
@@ -181,18 +523,28 @@ void PhysicsSystem::start() {
 
 	world2d->SetGravity({ settings.gravity.x, settings.gravity.y });
 
-	for (auto entity_id : scene->view<Rigidbody2D>()) {
-		Entity entity{ entity_id, scene };
-
-		b2Body* body = create_body(entity, world2d);
+	time_accumulator = 0.0f;
+	step_count = 0;
 
-		if (entity.has_component<BoxCollider2D>()) {
-			create_box_fixture(entity, body);
+	if (!settings.deterministic) {
+		for (auto entity_id : scene->view<Rigidbody2D>()) {
+			create_body_with_fixtures({ entity_id, scene }, world2d);
 		}
 
-		if (entity.has_component<CircleCollider2D>()) {
-			create_circle_fixture(entity, body);
-		}
+		return;
+	}
+
+	// registry order depends on the history of the scene, box2d results
+	// depend on the order bodies are created
+	std::vector<Entity> entities;
+	for (auto entity_id : scene->view<Rigidbody2D>()) {
+		entities.push_back({ entity_id, scene });
+	}
+
+	sort_by_uid(entities);
+
+	for (Entity entity : entities) {
+		create_body_with_fixtures(entity, world2d);
 	}
 }
 
@@ -204,6 +556,7 @@ void PhysicsSystem::stop() {
 	world2d = nullptr;
 	scene = nullptr;
 
+	contact_listener->clear();
 	s_fixture_user_datas.clear();
 }
 
@@ -215,6 +568,31 @@ void PhysicsSystem::update(float dt) {
 
 	EVE_PROFILE_FUNCTION();
 
+	if (!settings.deterministic) {
+		_step(dt);
+		return;
+	}
+
+	time_accumulator += dt;
+
+	uint32_t steps = 0;
+	while (time_accumulator >= settings.fixed_time_step &&
+			steps < settings.max_steps_per_frame) {
+		_step(settings.fixed_time_step);
+
+		time_accumulator -= settings.fixed_time_step;
+		steps++;
+	}
+
+	// drop the time we could not catch up with instead of spiraling
+	if (steps == settings.max_steps_per_frame) {
+		time_accumulator = 0.0f;
+	}
+}
+
+void PhysicsSystem::_step(float dt) {
+	EVE_PROFILE_FUNCTION();
+
 	{
 		for (auto body : bodies_to_remove) {
 			world2d->DestroyBody(body);
@@ -223,19 +601,49 @@ void PhysicsSystem::update(float dt) {
 		bodies_to_remove.clear();
 	}
 
+	// bodies added since the last step are created in uid order, the loop
+	// below creates them in registry order otherwise
+	if (settings.deterministic) {
+		std::vector<Entity> new_entities;
+		for (auto e : scene->view<Rigidbody2D>(
+					entt::exclude<InactiveComponent>)) {
+			Entity entity = { e, scene };
+			if (!entity.get_component<Rigidbody2D>().runtime_body) {
+				new_entities.push_back(entity);
+			}
+		}
+
+		sort_by_uid(new_entities);
+
+		for (Entity entity : new_entities) {
+			create_body_with_fixtures(entity, world2d);
+		}
+	}
+
 	constexpr int velocity_iters = 6;
 	constexpr int position_iters = 2;
 
 	world2d->Step(dt, velocity_iters, position_iters);
+	step_count++;
 
-	// Retrieve transform from Box2D
-	for (auto e : scene->view<Rigidbody2D>()) {
+	// entities destroyed by the contact callbacks
+	for (auto body : bodies_to_remove) {
+		world2d->DestroyBody(body);
+	}
+
+	bodies_to_remove.clear();
+
+	// Retrieve transform from Box2D, pooled entities keep their disabled
+	// bodies as they are
+	for (auto e :
+			scene->view<Rigidbody2D>(entt::exclude<InactiveComponent>)) {
 		Entity entity = { e, scene };
 
 		auto& transform = entity.get_transform();
 		auto& rb2d = entity.get_component<Rigidbody2D>();
 
 		b2Body* body = (b2Body*)rb2d.runtime_body;
+
 		if (!body) {
 			body = create_body(entity, world2d);
 		}
@@ -286,6 +694,18 @@ void PhysicsSystem::update(float dt) {
 			fixture->SetRestitutionThreshold(cc2d.restitution_threshold);
 		}
 
+		if (entity.has_component<PolygonCollider2D>()) {
+			sync_polygon_fixture(entity, body);
+		}
+
+		if (entity.has_component<CapsuleCollider2D>()) {
+			sync_capsule_fixture(entity, body);
+		}
+
+		if (entity.has_component<ChainCollider2D>()) {
+			sync_chain_fixture(entity, body);
+		}
+
 		{
 			for (const auto force : rb2d.forces) {
 				switch (force.mode) {
@@ -342,9 +762,518 @@ void PhysicsSystem::mark_deleted(Entity entity) {
 
 	b2Body* body = (b2Body*)rb2d.runtime_body;
 
-	bodies_to_remove.push_back(body);
+	// queries of the next frame must not find the body, it is only kept
+	// until the step if the world is locked
+	if (world2d->IsLocked()) {
+		bodies_to_remove.push_back(body);
+		return;
+	}
+
+	world2d->DestroyBody(body);
+}
+
+void PhysicsSystem::set_body_enabled(Entity entity, bool enabled) {
+	if (!entity.has_component<Rigidbody2D>()) {
+		return;
+	}
+
+	auto& rb2d = entity.get_component<Rigidbody2D>();
+
+	// forces given before the release should not carry over
+	rb2d.forces.clear();
+	rb2d.torque = 0.0f;
+	rb2d.angular_impulse = 0.0f;
+
+	// bodies are created on the next step if there is none yet
+	b2Body* body = (b2Body*)rb2d.runtime_body;
+	if (!body) {
+		return;
+	}
+
+	if (enabled) {
+		const Transform& transform = entity.get_transform();
+
+		body->SetTransform(
+				{ transform.get_position().x, transform.get_position().y },
+				glm::radians(transform.get_rotation().z));
+		body->SetLinearVelocity({ 0.0f, 0.0f });
+		body->SetAngularVelocity(0.0f);
+		body->SetAwake(true);
+	}
+
+	body->SetEnabled(enabled);
 }
 
 PhysicsSettings& PhysicsSystem::get_settings() {
 	return settings;
 }
+
+PhysicsStats PhysicsSystem::get_stats() const {
+	PhysicsStats stats{};
+	if (!world2d) {
+		return stats;
+	}
+
+	stats.body_count = world2d->GetBodyCount();
+	stats.contact_count = world2d->GetContactCount();
+
+	for (const b2Body* body = world2d->GetBodyList(); body;
+			body = body->GetNext()) {
+		if (body->IsAwake()) {
+			stats.awake_body_count++;
+		}
+	}
+
+	return stats;
+}
+
+uint64_t PhysicsSystem::get_step_count() const { return step_count; }
+
+uint64_t PhysicsSystem::compute_state_hash() const {
+	EVE_PROFILE_FUNCTION();
+
+	PhysicsSnapshot snapshot;
+	capture_snapshot(snapshot);
+
+	return physics_snapshot::hash(snapshot);
+}
+
+void PhysicsSystem::capture_snapshot(PhysicsSnapshot& out) const {
+	EVE_PROFILE_FUNCTION();
+
+	out.step = step_count;
+	out.bodies.clear();
+
+	if (!scene || !world2d) {
+		return;
+	}
+
+	for (auto e : scene->view<Rigidbody2D>()) {
+		Entity entity = { e, scene };
+
+		const auto& rb2d = entity.get_component<Rigidbody2D>();
+		const b2Body* body = (const b2Body*)rb2d.runtime_body;
+		if (!body) {
+			continue;
+		}
+
+		uint32_t flags = 0;
+		if (body->IsAwake()) {
+			flags |= PHYSICS_BODY_STATE_FLAG_AWAKE;
+		}
+		if (body->IsEnabled()) {
+			flags |= PHYSICS_BODY_STATE_FLAG_ENABLED;
+		}
+
+		out.bodies.push_back({
+				entity.get_uid(),
+				b2Vec2_to_vec2(body->GetPosition()),
+				body->GetAngle(),
+				b2Vec2_to_vec2(body->GetLinearVelocity()),
+				body->GetAngularVelocity(),
+				flags,
+		});
+	}
+
+	// keep snapshots independent from the registry order
+	std::sort(out.bodies.begin(), out.bodies.end(),
+			[](const PhysicsBodyState& lhs, const PhysicsBodyState& rhs) {
+				return lhs.entity_id < rhs.entity_id;
+			});
+}
+
+bool PhysicsSystem::restore_snapshot(const PhysicsSnapshot& snapshot) {
+	EVE_PROFILE_FUNCTION();
+
+	if (!scene || !world2d) {
+		return false;
+	}
+
+	// disabling every body destroys its contacts, enabling them back after
+	// the poses are set creates the broadphase proxies at the right place
+	std::vector<b2Body*> enabled_bodies;
+	enabled_bodies.reserve(world2d->GetBodyCount());
+
+	for (b2Body* body = world2d->GetBodyList(); body; body = body->GetNext()) {
+		if (body->IsEnabled()) {
+			body->SetEnabled(false);
+			enabled_bodies.push_back(body);
+		}
+	}
+
+	world2d->ClearForces();
+
+	bool restored_all = true;
+
+	for (const PhysicsBodyState& state : snapshot.bodies) {
+		Entity entity = scene->find_by_id(state.entity_id);
+		if (!entity || !entity.has_component<Rigidbody2D>()) {
+			restored_all = false;
+			continue;
+		}
+
+		auto& rb2d = entity.get_component<Rigidbody2D>();
+
+		b2Body* body = (b2Body*)rb2d.runtime_body;
+		if (!body) {
+			restored_all = false;
+			continue;
+		}
+
+		body->SetTransform(vec2_to_b2Vec2(state.position), state.angle);
+		body->SetLinearVelocity(vec2_to_b2Vec2(state.linear_velocity));
+		body->SetAngularVelocity(state.angular_velocity);
+
+		// pending forces belong to the discarded timeline
+		rb2d.forces.clear();
+		rb2d.torque = 0.0f;
+		rb2d.angular_impulse = 0.0f;
+
+		auto& transform = entity.get_transform();
+		transform.local_position.x = state.position.x;
+		transform.local_position.y = state.position.y;
+		transform.local_rotation.z = glm::degrees(state.angle);
+	}
+
+	for (b2Body* body : enabled_bodies) {
+		body->SetEnabled(true);
+	}
+
+	for (const PhysicsBodyState& state : snapshot.bodies) {
+		Entity entity = scene->find_by_id(state.entity_id);
+		if (!entity || !entity.has_component<Rigidbody2D>()) {
+			continue;
+		}
+
+		b2Body* body =
+				(b2Body*)entity.get_component<Rigidbody2D>().runtime_body;
+		if (!body) {
+			continue;
+		}
+
+		body->SetEnabled(state.flags & PHYSICS_BODY_STATE_FLAG_ENABLED);
+		body->SetAwake(state.flags & PHYSICS_BODY_STATE_FLAG_AWAKE);
+	}
+
+	step_count = snapshot.step;
+
+	return restored_all;
+}
+
+class RaycastClosestCallback : public b2RayCastCallback {
+public:
+	RaycastHit2D hit{};
+	bool has_hit = false;
+
+	inline float ReportFixture(b2Fixture* fixture, const b2Vec2& point,
+			const b2Vec2& normal, float fraction) override {
+		const auto* user_data =
+				reinterpret_cast<FixtureUserData*>(fixture->GetUserData().pointer);
+		if (!user_data || !user_data->entity_id) {
+			return -1.0f;
+		}
+
+		hit.entity_id = user_data->entity_id;
+		hit.point = b2Vec2_to_vec2(point);
+		hit.normal = b2Vec2_to_vec2(normal);
+		hit.fraction = fraction;
+		has_hit = true;
+
+		// clip the ray so that only closer hits are reported
+		return fraction;
+	}
+};
+
+class RaycastAllCallback : public b2RayCastCallback {
+public:
+	RaycastHit2D* hits = nullptr;
+	uint32_t max_hits = 0;
+	uint32_t hit_count = 0;
+
+	inline float ReportFixture(b2Fixture* fixture, const b2Vec2& point,
+			const b2Vec2& normal, float fraction) override {
+		const auto* user_data =
+				reinterpret_cast<FixtureUserData*>(fixture->GetUserData().pointer);
+		if (!user_data || !user_data->entity_id) {
+			return -1.0f;
+		}
+
+		hits[hit_count++] = { user_data->entity_id,
+			b2Vec2_to_vec2(point), b2Vec2_to_vec2(normal), fraction };
+
+		// stop as soon as the buffer is full
+		return hit_count < max_hits ? 1.0f : 0.0f;
+	}
+};
+
+class OverlapCallback : public b2QueryCallback {
+public:
+	const b2Shape* shape = nullptr;
+	b2Transform transform;
+
+	uint64_t* entities = nullptr;
+	uint32_t max_entities = 0;
+	uint32_t entity_count = 0;
+
+	inline bool ReportFixture(b2Fixture* fixture) override {
+		const auto* user_data =
+				reinterpret_cast<FixtureUserData*>(fixture->GetUserData().pointer);
+		if (!user_data || !user_data->entity_id) {
+			return true;
+		}
+
+		const uint64_t entity_id = user_data->entity_id;
+
+		// entities with multiple fixtures are reported once
+		for (uint32_t i = 0; i < entity_count; i++) {
+			if (entities[i] == entity_id) {
+				return true;
+			}
+		}
+
+		// the broadphase only tests bounding boxes
+		const b2Shape* fixture_shape = fixture->GetShape();
+		const b2Transform& fixture_transform = fixture->GetBody()->GetTransform();
+
+		bool overlaps = false;
+		for (int32 child = 0; child < fixture_shape->GetChildCount(); child++) {
+			if (b2TestOverlap(shape, 0, fixture_shape, child, transform,
+						fixture_transform)) {
+				overlaps = true;
+				break;
+			}
+		}
+
+		if (overlaps) {
+			entities[entity_count++] = entity_id;
+		}
+
+		return entity_count < max_entities;
+	}
+};
+
+class ShapeCastCallback : public b2QueryCallback {
+public:
+	const b2Shape* shape = nullptr;
+	b2Transform transform;
+	b2Vec2 translation;
+
+	RaycastHit2D hit{};
+	bool has_hit = false;
+
+	inline bool ReportFixture(b2Fixture* fixture) override {
+		const auto* user_data =
+				reinterpret_cast<FixtureUserData*>(fixture->GetUserData().pointer);
+		if (!user_data || !user_data->entity_id) {
+			return true;
+		}
+
+		const b2Shape* fixture_shape = fixture->GetShape();
+
+		b2ShapeCastInput input;
+		input.proxyA.Set(fixture_shape, 0);
+		input.proxyB.Set(shape, 0);
+		input.transformA = fixture->GetBody()->GetTransform();
+		input.transformB = transform;
+		input.translationB = translation;
+
+		for (int32 child = 0; child < fixture_shape->GetChildCount(); child++) {
+			input.proxyA.Set(fixture_shape, child);
+
+			b2ShapeCastOutput output;
+			if (!b2ShapeCast(&output, &input)) {
+				continue;
+			}
+
+			if (!has_hit || output.lambda < hit.fraction) {
+				hit.entity_id = user_data->entity_id;
+				hit.point = b2Vec2_to_vec2(output.point);
+				hit.normal = b2Vec2_to_vec2(output.normal);
+				hit.fraction = output.lambda;
+				has_hit = true;
+			}
+		}
+
+		return true;
+	}
+};
+
+bool PhysicsSystem::raycast(const glm::vec2& origin,
+		const glm::vec2& direction, float distance,
+		RaycastHit2D* out_hit) const {
+	EVE_PROFILE_FUNCTION();
+
+	if (!world2d || distance <= 0.0f ||
+			glm::length(direction) <= b2_epsilon) {
+		return false;
+	}
+
+	const glm::vec2 end = origin + glm::normalize(direction) * distance;
+
+	RaycastClosestCallback callback;
+	world2d->RayCast(&callback, vec2_to_b2Vec2(origin), vec2_to_b2Vec2(end));
+
+	if (out_hit) {
+		*out_hit = callback.hit;
+	}
+
+	return callback.has_hit;
+}
+
+uint32_t PhysicsSystem::raycast_all(const glm::vec2& origin,
+		const glm::vec2& direction, float distance, RaycastHit2D* out_hits,
+		uint32_t max_hits) const {
+	EVE_PROFILE_FUNCTION();
+
+	if (!world2d || !out_hits || max_hits == 0 || distance <= 0.0f ||
+			glm::length(direction) <= b2_epsilon) {
+		return 0;
+	}
+
+	const glm::vec2 end = origin + glm::normalize(direction) * distance;
+
+	RaycastAllCallback callback;
+	callback.hits = out_hits;
+	callback.max_hits = max_hits;
+
+	world2d->RayCast(&callback, vec2_to_b2Vec2(origin), vec2_to_b2Vec2(end));
+
+	// box2d reports fixtures in no particular order
+	std::sort(out_hits, out_hits + callback.hit_count,
+			[](const RaycastHit2D& lhs, const RaycastHit2D& rhs) {
+				return lhs.fraction < rhs.fraction;
+			});
+
+	return callback.hit_count;
+}
+
+uint32_t PhysicsSystem::raycast_batch(const RaycastQuery2D* queries,
+		uint32_t count, RaycastHit2D* out_hits) const {
+	EVE_PROFILE_FUNCTION();
+
+	uint32_t hit_count = 0;
+	for (uint32_t i = 0; i < count; i++) {
+		const RaycastQuery2D& query = queries[i];
+
+		out_hits[i] = {};
+		if (raycast(query.origin, query.direction, query.distance,
+					&out_hits[i])) {
+			hit_count++;
+		}
+	}
+
+	return hit_count;
+}
+
+uint32_t PhysicsSystem::overlap_box(const glm::vec2& center,
+		const glm::vec2& half_size, float angle, uint64_t* out_entities,
+		uint32_t max_entities) const {
+	EVE_PROFILE_FUNCTION();
+
+	if (!world2d || !out_entities || max_entities == 0) {
+		return 0;
+	}
+
+	b2PolygonShape box_shape;
+	box_shape.SetAsBox(half_size.x, half_size.y);
+
+	OverlapCallback callback;
+	callback.shape = &box_shape;
+	callback.transform.Set(vec2_to_b2Vec2(center), glm::radians(angle));
+	callback.entities = out_entities;
+	callback.max_entities = max_entities;
+
+	b2AABB aabb;
+	box_shape.ComputeAABB(&aabb, callback.transform, 0);
+
+	world2d->QueryAABB(&callback, aabb);
+
+	return callback.entity_count;
+}
+
+uint32_t PhysicsSystem::overlap_circle(const glm::vec2& center, float radius,
+		uint64_t* out_entities, uint32_t max_entities) const {
+	EVE_PROFILE_FUNCTION();
+
+	if (!world2d || !out_entities || max_entities == 0) {
+		return 0;
+	}
+
+	b2CircleShape circle_shape;
+	circle_shape.m_radius = radius;
+
+	OverlapCallback callback;
+	callback.shape = &circle_shape;
+	callback.transform.Set(vec2_to_b2Vec2(center), 0.0f);
+	callback.entities = out_entities;
+	callback.max_entities = max_entities;
+
+	b2AABB aabb;
+	circle_shape.ComputeAABB(&aabb, callback.transform, 0);
+
+	world2d->QueryAABB(&callback, aabb);
+
+	return callback.entity_count;
+}
+
+inline static bool shape_cast(b2World* world, const b2Shape& shape,
+		const b2Transform& transform, const glm::vec2& direction,
+		float distance, RaycastHit2D* out_hit) {
+	if (!world || distance <= 0.0f || glm::length(direction) <= b2_epsilon) {
+		return false;
+	}
+
+	ShapeCastCallback callback;
+	callback.shape = &shape;
+	callback.transform = transform;
+	callback.translation =
+			vec2_to_b2Vec2(glm::normalize(direction) * distance);
+
+	// query everything the shape may touch along the sweep
+	b2AABB start_aabb;
+	shape.ComputeAABB(&start_aabb, transform, 0);
+
+	b2AABB end_aabb = start_aabb;
+	end_aabb.lowerBound += callback.translation;
+	end_aabb.upperBound += callback.translation;
+
+	b2AABB sweep_aabb;
+	sweep_aabb.Combine(start_aabb, end_aabb);
+
+	world->QueryAABB(&callback, sweep_aabb);
+
+	if (out_hit) {
+		*out_hit = callback.hit;
+	}
+
+	return callback.has_hit;
+}
+
+bool PhysicsSystem::shape_cast_box(const glm::vec2& center,
+		const glm::vec2& half_size, float angle, const glm::vec2& direction,
+		float distance, RaycastHit2D* out_hit) const {
+	EVE_PROFILE_FUNCTION();
+
+	b2PolygonShape box_shape;
+	box_shape.SetAsBox(half_size.x, half_size.y);
+
+	const b2Transform transform(
+			vec2_to_b2Vec2(center), b2Rot(glm::radians(angle)));
+
+	return shape_cast(
+			world2d, box_shape, transform, direction, distance, out_hit);
+}
+
+bool PhysicsSystem::shape_cast_circle(const glm::vec2& center, float radius,
+		const glm::vec2& direction, float distance,
+		RaycastHit2D* out_hit) const {
+	EVE_PROFILE_FUNCTION();
+
+	b2CircleShape circle_shape;
+	circle_shape.m_radius = radius;
+
+	const b2Transform transform(vec2_to_b2Vec2(center), b2Rot(0.0f));
+
+	return shape_cast(
+			world2d, circle_shape, transform, direction, distance, out_hit);
+}
@@ -1,14 +1,52 @@
 #ifndef PHYSICS_SYSTEM_H
 #define PHYSICS_SYSTEM_H
 
+#include "physics/physics_snapshot.h"
+
 class Entity;
 class Scene;
 
 class b2World;
 class b2Body;
 
+class Physics2DContactListener;
+
+struct RaycastHit2D {
+	// id of the hit entity, zero if nothing is hit
+	uint64_t entity_id = 0;
+	glm::vec2 point = { 0.0f, 0.0f };
+	glm::vec2 normal = { 0.0f, 0.0f };
+	// hit distance along the query in [0, 1]
+	float fraction = 0.0f;
+};
+
+struct RaycastQuery2D {
+	glm::vec2 origin;
+	glm::vec2 direction;
+	float distance;
+};
+
+struct PhysicsStats {
+	uint32_t body_count = 0;
+	uint32_t awake_body_count = 0;
+	uint32_t contact_count = 0;
+};
+
 struct PhysicsSettings {
+	// limits of the settings, loaded values are clamped to them as well
+	static constexpr float MIN_FIXED_TIME_STEP = 0.001f;
+	static constexpr float MAX_FIXED_TIME_STEP = 0.1f;
+	static constexpr uint32_t MIN_STEPS_PER_FRAME = 1;
+	static constexpr uint32_t MAX_STEPS_PER_FRAME = 64;
+
 	glm::vec2 gravity = { 0.0f, -9.81f };
+
+	// steps the world with a fixed time step and creates bodies in uid
+	// order so that runs with the same inputs give the same results
+	bool deterministic = false;
+	float fixed_time_step = 1.0f / 60.0f;
+	// upper limit of the steps taken in one update to catch up with dt
+	uint32_t max_steps_per_frame = 8;
 };
 
 class PhysicsSystem {
@@ -24,16 +62,78 @@ public:
 
 	void mark_deleted(Entity entity);
 
+	// keeps the body of a pooled entity in the world without simulating
+	// it, enabling moves it to the transform with zero velocity as if it
+	// was just created
+	void set_body_enabled(Entity entity, bool enabled);
+
 	PhysicsSettings& get_settings();
 
+	PhysicsStats get_stats() const;
+
+	// number of steps taken since start
+	uint64_t get_step_count() const;
+
+	// hash of the state of every body, equal hashes mean equal worlds
+	uint64_t compute_state_hash() const;
+
+	// captures pose, velocities and sleep state of every body, the snapshot
+	// can be reused to avoid reallocating it every frame
+	void capture_snapshot(PhysicsSnapshot& out) const;
+
+	// restores the bodies that still exist, cached contacts are dropped so
+	// stepping after a restore does not depend on the state before it.
+	// returns false if some bodies of the snapshot could not be found.
+	bool restore_snapshot(const PhysicsSnapshot& snapshot);
+
+	// queries, results are written into caller owned buffers so that no
+	// allocation happens per hit
+
+	// returns the closest hit along the ray
+	bool raycast(const glm::vec2& origin, const glm::vec2& direction,
+			float distance, RaycastHit2D* out_hit) const;
+
+	// returns every hit along the ray sorted by distance, up to max_hits
+	uint32_t raycast_all(const glm::vec2& origin, const glm::vec2& direction,
+			float distance, RaycastHit2D* out_hits, uint32_t max_hits) const;
+
+	// writes the closest hit of each query into out_hits[i]
+	uint32_t raycast_batch(const RaycastQuery2D* queries, uint32_t count,
+			RaycastHit2D* out_hits) const;
+
+	// returns the ids of the entities overlapping with the shape
+	uint32_t overlap_box(const glm::vec2& center, const glm::vec2& half_size,
+			float angle, uint64_t* out_entities, uint32_t max_entities) const;
+
+	uint32_t overlap_circle(const glm::vec2& center, float radius,
+			uint64_t* out_entities, uint32_t max_entities) const;
+
+	// sweeps the shape along the direction and returns the first hit
+	bool shape_cast_box(const glm::vec2& center, const glm::vec2& half_size,
+			float angle, const glm::vec2& direction, float distance,
+			RaycastHit2D* out_hit) const;
+
+	bool shape_cast_circle(const glm::vec2& center, float radius,
+			const glm::vec2& direction, float distance,
+			RaycastHit2D* out_hit) const;
+
 private:
 	Scene* scene = nullptr;
 
 	b2World* world2d = nullptr;
+	// contacts are counted per world, entities of copied scenes share ids
+	Physics2DContactListener* contact_listener = nullptr;
 
 	std::vector<b2Body*> bodies_to_remove;
 
+	uint64_t step_count = 0;
+
 	PhysicsSettings settings{};
+
+	float time_accumulator = 0.0f;
+
+private:
+	void _step(float dt);
 };
 
 #endif
@@ -0,0 +1,192 @@
+#include "physics/tile_collision.h"
+
+TileGrid::TileGrid(uint32_t width, uint32_t height) :
+		width(width), height(height), cells(width * height, 0) {}
+
+bool TileGrid::is_solid(int32_t x, int32_t y) const {
+	if (x < 0 || y < 0 || x >= (int32_t)width || y >= (int32_t)height) {
+		return false;
+	}
+
+	return cells[y * width + x] != 0;
+}
+
+void TileGrid::set_solid(int32_t x, int32_t y, bool solid) {
+	EVE_ASSERT(x >= 0 && y >= 0 && x < (int32_t)width && y < (int32_t)height);
+	cells[y * width + x] = solid ? 1 : 0;
+}
+
+namespace tile_collision {
+
+struct OutlineEdge {
+	glm::ivec2 from;
+	glm::ivec2 to;
+	bool used = false;
+};
+
+std::vector<std::vector<glm::vec2>> build_outlines(const TileGrid& grid) {
+	EVE_PROFILE_FUNCTION();
+
+	const uint32_t vertex_stride = grid.width + 1;
+	const auto vertex_index = [&](const glm::ivec2& v) -> uint32_t {
+		return v.y * vertex_stride + v.x;
+	};
+
+	// every grid vertex can have at most two outgoing boundary edges
+	// (when two solid tiles only touch each other diagonally)
+	std::vector<std::array<int32_t, 2>> outgoing_edges(
+			vertex_stride * (grid.height + 1), { -1, -1 });
+
+	std::vector<OutlineEdge> edges;
+
+	const auto add_edge = [&](glm::ivec2 from, glm::ivec2 to) {
+		auto& slots = outgoing_edges[vertex_index(from)];
+		slots[slots[0] == -1 ? 0 : 1] = (int32_t)edges.size();
+
+		edges.push_back({ from, to });
+	};
+
+	// emit boundary edges with the solid tile on their left side
+	for (int32_t y = 0; y < (int32_t)grid.height; y++) {
+		for (int32_t x = 0; x < (int32_t)grid.width; x++) {
+			if (!grid.is_solid(x, y)) {
+				continue;
+			}
+
+			if (!grid.is_solid(x, y - 1)) {
+				add_edge({ x, y }, { x + 1, y });
+			}
+			if (!grid.is_solid(x + 1, y)) {
+				add_edge({ x + 1, y }, { x + 1, y + 1 });
+			}
+			if (!grid.is_solid(x, y + 1)) {
+				add_edge({ x + 1, y + 1 }, { x, y + 1 });
+			}
+			if (!grid.is_solid(x - 1, y)) {
+				add_edge({ x, y + 1 }, { x, y });
+			}
+		}
+	}
+
+	std::vector<std::vector<glm::vec2>> outlines;
+
+	std::vector<glm::ivec2> loop;
+	for (uint32_t start = 0; start < edges.size(); start++) {
+		if (edges[start].used) {
+			continue;
+		}
+
+		loop.clear();
+
+		int32_t current = start;
+		while (current != -1 && !edges[current].used) {
+			OutlineEdge& edge = edges[current];
+			edge.used = true;
+
+			loop.push_back(edge.from);
+
+			const glm::ivec2 direction = edge.to - edge.from;
+			const auto& candidates = outgoing_edges[vertex_index(edge.to)];
+
+			// prefer turning left on diagonal junctions so that tiles
+			// touching only at a corner end up in separate outlines
+			int32_t next = -1;
+			for (const int32_t candidate : candidates) {
+				if (candidate == -1 || edges[candidate].used) {
+					continue;
+				}
+
+				const glm::ivec2 next_direction =
+						edges[candidate].to - edges[candidate].from;
+				const int32_t cross = direction.x * next_direction.y -
+						direction.y * next_direction.x;
+
+				if (next == -1 || cross > 0) {
+					next = candidate;
+				}
+			}
+
+			current = next;
+		}
+
+		// drop vertices laying on a straight line
+		std::vector<glm::vec2> outline;
+		const size_t count = loop.size();
+		for (size_t i = 0; i < count; i++) {
+			const glm::ivec2& prev = loop[(i + count - 1) % count];
+			const glm::ivec2& point = loop[i];
+			const glm::ivec2& next = loop[(i + 1) % count];
+
+			const glm::ivec2 in = point - prev;
+			const glm::ivec2 out = next - point;
+			if (in.x * out.y - in.y * out.x == 0) {
+				continue;
+			}
+
+			outline.push_back(grid.origin + glm::vec2(point) * grid.tile_size);
+		}
+
+		if (outline.size() >= 3) {
+			outlines.push_back(std::move(outline));
+		}
+	}
+
+	return outlines;
+}
+
+std::vector<TileRect> build_rects(const TileGrid& grid) {
+	EVE_PROFILE_FUNCTION();
+
+	std::vector<uint8_t> visited(grid.cells.size(), 0);
+
+	const auto is_free = [&](int32_t x, int32_t y) -> bool {
+		return grid.is_solid(x, y) && !visited[y * grid.width + x];
+	};
+
+	std::vector<TileRect> rects;
+
+	for (int32_t y = 0; y < (int32_t)grid.height; y++) {
+		for (int32_t x = 0; x < (int32_t)grid.width; x++) {
+			if (!is_free(x, y)) {
+				continue;
+			}
+
+			int32_t width = 1;
+			while (is_free(x + width, y)) {
+				width++;
+			}
+
+			int32_t height = 1;
+			while (y + height < (int32_t)grid.height) {
+				bool row_free = true;
+				for (int32_t i = 0; i < width; i++) {
+					if (!is_free(x + i, y + height)) {
+						row_free = false;
+						break;
+					}
+				}
+
+				if (!row_free) {
+					break;
+				}
+
+				height++;
+			}
+
+			for (int32_t j = 0; j < height; j++) {
+				for (int32_t i = 0; i < width; i++) {
+					visited[(y + j) * grid.width + (x + i)] = 1;
+				}
+			}
+
+			const glm::vec2 min = grid.origin + glm::vec2(x, y) * grid.tile_size;
+			const glm::vec2 max = min + glm::vec2(width, height) * grid.tile_size;
+
+			rects.push_back({ min, max });
+		}
+	}
+
+	return rects;
+}
+
+} //namespace tile_collision
@@ -0,0 +1,42 @@
+#ifndef TILE_COLLISION_H
+#define TILE_COLLISION_H
+
+// Grid of solid/empty tiles, cell (0, 0) is the bottom left one.
+struct TileGrid {
+	uint32_t width = 0;
+	uint32_t height = 0;
+
+	// world position of the bottom left corner of cell (0, 0)
+	glm::vec2 origin = { 0.0f, 0.0f };
+	glm::vec2 tile_size = { 1.0f, 1.0f };
+
+	std::vector<uint8_t> cells;
+
+	TileGrid() = default;
+	TileGrid(uint32_t width, uint32_t height);
+
+	bool is_solid(int32_t x, int32_t y) const;
+
+	void set_solid(int32_t x, int32_t y, bool solid = true);
+};
+
+struct TileRect {
+	glm::vec2 min;
+	glm::vec2 max;
+};
+
+namespace tile_collision {
+
+// Traces the outlines of every connected group of solid tiles.
+// Outer outlines are counter clockwise and holes are clockwise so that the
+// solid side is always on the left, which is what one sided chain shapes
+// expect. Collinear vertices are merged.
+std::vector<std::vector<glm::vec2>> build_outlines(const TileGrid& grid);
+
+// Greedily merges solid tiles into as few axis aligned rectangles as
+// possible, for the cases where two sided polygon fixtures are needed.
+std::vector<TileRect> build_rects(const TileGrid& grid);
+
+} //namespace tile_collision
+
+#endif
@@ -11,6 +11,14 @@ void ProjectConfig::serialize(const ProjectConfig& config, const fs::path& path)
 		{ "asset_directory", config.asset_directory },
 		{ "script_dll", config.script_dll },
 		{ "starting_scene", config.starting_scene },
+		{ "physics",
+				{
+						{ "gravity", config.physics.gravity },
+						{ "deterministic", config.physics.deterministic },
+						{ "fixed_time_step", config.physics.fixed_time_step },
+						{ "max_steps_per_frame",
+								config.physics.max_steps_per_frame },
+				} },
 	};
 
 	json_utils::write_file(path, out);
@@ -28,6 +36,26 @@ bool ProjectConfig::deserialize(ProjectConfig& config, const fs::path& path) {
 	config.script_dll = json["script_dll"].get<std::string>();
 	config.starting_scene = json["starting_scene"].get<std::string>();
 
+	// older projects do not have physics settings
+	if (json.contains("physics")) {
+		const Json& physics_json = json["physics"];
+		PhysicsSettings& physics = config.physics;
+
+		physics.gravity = physics_json.value("gravity", physics.gravity);
+		physics.deterministic =
+				physics_json.value("deterministic", physics.deterministic);
+		// hand edited values could stall or never step the world
+		physics.fixed_time_step = glm::clamp(
+				physics_json.value("fixed_time_step", physics.fixed_time_step),
+				PhysicsSettings::MIN_FIXED_TIME_STEP,
+				PhysicsSettings::MAX_FIXED_TIME_STEP);
+		physics.max_steps_per_frame = glm::clamp(
+				physics_json.value(
+						"max_steps_per_frame", physics.max_steps_per_frame),
+				PhysicsSettings::MIN_STEPS_PER_FRAME,
+				PhysicsSettings::MAX_STEPS_PER_FRAME);
+	}
+
 	return true;
 }
 
@@ -92,6 +120,12 @@ fs::path Project::get_script_dll_path() {
 	return s_active_project->get_project_directory() / s_active_project->config.script_dll;
 }
 
+const PhysicsSettings& Project::get_physics_settings() {
+	EVE_ASSERT(s_active_project);
+
+	return s_active_project->config.physics;
+}
+
 fs::path Project::get_asset_path(const std::string& path) {
 	EVE_PROFILE_FUNCTION();
 
@@ -2,12 +2,15 @@
 #define PROJECT_H
 
 #include "asset/asset.h"
+#include "physics/physics_system.h"
 
 struct ProjectConfig {
 	std::string name;
 	std::string asset_directory;
 	std::string script_dll;
 	std::string starting_scene;
+	// every scene of the project starts with these
+	PhysicsSettings physics;
 
 	static void serialize(const ProjectConfig& config, const fs::path& path);
 
@@ -33,6 +36,8 @@ public:
 
 	static fs::path get_script_dll_path();
 
+	static const PhysicsSettings& get_physics_settings();
+
 	static fs::path get_asset_path(const std::string& path);
 
 	static std::string get_relative_asset_path(const fs::path& path);
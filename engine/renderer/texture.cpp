@@ -69,6 +69,30 @@ inline static TextureFormat get_texture_format_from_channels(
 	return TextureFormat::RED;
 }
 
+bool load_texture_image(
+		const fs::path& path, TextureImage& image, bool flip_on_load) {
+	EVE_PROFILE_FUNCTION();
+
+	// the global flip setting is shared between threads
+	stbi_set_flip_vertically_on_load_thread(flip_on_load);
+
+	int channels;
+	stbi_uc* data = stbi_load(
+			path.string().c_str(), &image.size.x, &image.size.y, &channels, 0);
+
+	if (!data) {
+		EVE_LOG_ERROR("Unable to load texture from: {}", path.string());
+		return false;
+	}
+
+	image.format = get_texture_format_from_channels(channels);
+	image.pixels.assign(data, data + image.size.x * image.size.y * channels);
+
+	stbi_image_free(data);
+
+	return true;
+}
+
 bool is_texture_filtering_mode_valid(const char* mode) {
 	if (std::strcmp(mode, "nearest") == 0) {
 		return true;
@@ -38,6 +38,17 @@ struct TextureMetadata final {
 	bool generate_mipmaps = true;
 };
 
+// Pixels decoded on the cpu without touching the renderer, so images can be
+// loaded on worker threads and uploaded with Texture2D on the main thread.
+struct TextureImage final {
+	glm::ivec2 size = { 0, 0 };
+	TextureFormat format = TextureFormat::RGBA;
+	std::vector<uint8_t> pixels;
+};
+
+bool load_texture_image(
+		const fs::path& path, TextureImage& image, bool flip_on_load = true);
+
 class Texture2D final : public Asset {
 public:
 	EVE_IMPL_ASSET(AssetType::TEXTURE)
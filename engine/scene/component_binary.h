@@ -0,0 +1,291 @@
+#ifndef COMPONENT_BINARY_H
+#define COMPONENT_BINARY_H
+
+#include "core/binary_utils.h"
+#include "scene/component_reflection.h"
+#include "scene/components.h"
+#include "scene/entity.h"
+#include "scripting/script_engine.h"
+
+// Plain binary encoding of the components, shared by the cooked scenes and
+// the scene journal. Strings are handed to the given string writer/reader so
+// that cooked scenes can reference a string table while journal entries keep
+// them inline.
+
+// stored in the files, only append new values
+enum class ComponentColumnId : uint32_t {
+	TRANSFORM = 1,
+	CAMERA,
+	SPRITE_RENDERER,
+	TEXT_RENDERER,
+	RIGIDBODY2D,
+	BOX_COLLIDER2D,
+	CIRCLE_COLLIDER2D,
+	POLYGON_COLLIDER2D,
+	CAPSULE_COLLIDER2D,
+	CHAIN_COLLIDER2D,
+	POST_PROCESS_VOLUME,
+	SCRIPT,
+};
+
+inline constexpr uint32_t COMPONENT_COLUMN_MAX =
+		(uint32_t)ComponentColumnId::SCRIPT;
+
+template <typename T>
+struct ComponentColumn;
+
+#define COMPONENT_COLUMN(Type, Id)                                             \
+	template <>                                                                \
+	struct ComponentColumn<Type> {                                             \
+		static constexpr ComponentColumnId ID = ComponentColumnId::Id;         \
+	}
+
+COMPONENT_COLUMN(Transform, TRANSFORM);
+COMPONENT_COLUMN(CameraComponent, CAMERA);
+COMPONENT_COLUMN(SpriteRenderer, SPRITE_RENDERER);
+COMPONENT_COLUMN(TextRenderer, TEXT_RENDERER);
+COMPONENT_COLUMN(Rigidbody2D, RIGIDBODY2D);
+COMPONENT_COLUMN(BoxCollider2D, BOX_COLLIDER2D);
+COMPONENT_COLUMN(CircleCollider2D, CIRCLE_COLLIDER2D);
+COMPONENT_COLUMN(PolygonCollider2D, POLYGON_COLLIDER2D);
+COMPONENT_COLUMN(CapsuleCollider2D, CAPSULE_COLLIDER2D);
+COMPONENT_COLUMN(ChainCollider2D, CHAIN_COLLIDER2D);
+COMPONENT_COLUMN(PostProcessVolume, POST_PROCESS_VOLUME);
+COMPONENT_COLUMN(ScriptComponent, SCRIPT);
+
+#undef COMPONENT_COLUMN
+
+// raw storage of a script field value
+struct ScriptFieldData {
+	uint8_t bytes[16];
+};
+
+// strings written next to the values
+struct InlineStrings {
+	inline void write_string(BinaryWriter& writer, const std::string& string) {
+		writer.write_string(string);
+	}
+
+	inline bool read_string(BinaryReader& reader, std::string& string) const {
+		std::string_view view;
+		if (!reader.read_string(view)) {
+			return false;
+		}
+
+		string = view;
+		return true;
+	}
+};
+
+template <typename T>
+struct IsVector : std::false_type {};
+
+template <typename T>
+struct IsVector<std::vector<T>> : std::true_type {};
+
+namespace component_binary {
+
+// fields are written in their reflection order without any names
+template <typename Strings, typename T>
+inline void write_value(
+		BinaryWriter& writer, Strings& strings, const T& value) {
+	if constexpr (Reflected<T>) {
+		reflection::for_each_field<T>([&](const auto& field) {
+			write_value(writer, strings, value.*field.member);
+		});
+	} else if constexpr (std::is_same_v<T, std::string>) {
+		strings.write_string(writer, value);
+	} else if constexpr (std::is_same_v<T, UID>) {
+		writer.write<uint64_t>(value);
+	} else if constexpr (std::is_enum_v<T>) {
+		writer.write<uint32_t>((uint32_t)value);
+	} else if constexpr (IsVector<T>::value) {
+		writer.write_array(value);
+	} else {
+		writer.write(value);
+	}
+}
+
+template <typename Strings, typename T>
+inline bool read_value(
+		BinaryReader& reader, const Strings& strings, T& value) {
+	if constexpr (Reflected<T>) {
+		bool result = true;
+		reflection::for_each_field<T>([&](const auto& field) {
+			result = result &&
+					read_value(reader, strings, value.*field.member);
+		});
+		return result;
+	} else if constexpr (std::is_same_v<T, std::string>) {
+		return strings.read_string(reader, value);
+	} else if constexpr (std::is_same_v<T, UID>) {
+		uint64_t id = 0;
+		reader.read(id);
+		value = id;
+		return reader.is_valid();
+	} else if constexpr (std::is_enum_v<T>) {
+		uint32_t raw_value = 0;
+		reader.read(raw_value);
+		value = (T)raw_value;
+		return reader.is_valid();
+	} else if constexpr (IsVector<T>::value) {
+		return reader.read_array(value);
+	} else {
+		return reader.read(value);
+	}
+}
+
+template <typename Strings, Reflected T>
+inline void write_component(BinaryWriter& writer, Strings& strings,
+		Entity entity, const T& component) {
+	write_value(writer, strings, component);
+}
+
+template <typename Strings, Reflected T>
+inline bool read_component(BinaryReader& reader, const Strings& strings,
+		Entity entity, T& component) {
+	return read_value(reader, strings, component);
+}
+
+// script field values are owned by the script engine
+template <typename Strings>
+inline void write_component(BinaryWriter& writer, Strings& strings,
+		Entity entity, const ScriptComponent& sc) {
+	write_value(writer, strings, sc);
+
+	// field values only exist while the script runtime is alive
+	Ref<ScriptClass> entity_class = ScriptEngine::is_initialized()
+			? ScriptEngine::get_entity_class(sc.class_name)
+			: nullptr;
+	if (!entity_class) {
+		writer.write<uint32_t>(0);
+		return;
+	}
+
+	const size_t count_offset = writer.get_size();
+	writer.write<uint32_t>(0);
+
+	uint32_t field_count = 0;
+
+	auto& entity_fields = ScriptEngine::get_script_field_map(entity);
+	for (const auto& [name, field] : entity_class->get_fields()) {
+		const auto it = entity_fields.find(name);
+		if (it == entity_fields.end()) {
+			continue;
+		}
+
+		strings.write_string(writer, name);
+		writer.write<uint32_t>((uint32_t)field.type);
+		writer.write(it->second.get_value<ScriptFieldData>());
+
+		field_count++;
+	}
+
+	writer.write_at(count_offset, field_count);
+}
+
+template <typename Strings>
+inline bool read_component(BinaryReader& reader, const Strings& strings,
+		Entity entity, ScriptComponent& sc) {
+	if (!read_value(reader, strings, sc)) {
+		return false;
+	}
+
+	uint32_t field_count = 0;
+	reader.read(field_count);
+
+	Ref<ScriptClass> entity_class = ScriptEngine::is_initialized()
+			? ScriptEngine::get_entity_class(sc.class_name)
+			: nullptr;
+
+	for (uint32_t i = 0; i < field_count; i++) {
+		std::string name;
+		if (!strings.read_string(reader, name)) {
+			return false;
+		}
+
+		uint32_t type = 0;
+		ScriptFieldData data;
+		reader.read(type);
+		reader.read(data);
+
+		if (!reader.is_valid()) {
+			return false;
+		}
+
+		if (!entity_class) {
+			continue;
+		}
+
+		const auto& fields = entity_class->get_fields();
+
+		const auto field_it = fields.find(name);
+		if (field_it == fields.end() ||
+				field_it->second.type != (ScriptFieldType)type) {
+			continue;
+		}
+
+		auto& entity_fields = ScriptEngine::get_script_field_map(entity);
+
+		ScriptFieldInstance& field_instance = entity_fields[field_it->first];
+		field_instance.field = field_it->second;
+		field_instance.class_id = entity_class->get_id();
+		field_instance.set_value(data);
+	}
+
+	return reader.is_valid();
+}
+
+// writes every component the entity has as
+// [uint32_t column id][uint32_t size][component]
+template <typename Strings, typename... Component>
+inline void write_components(ComponentGroup<Component...>,
+		BinaryWriter& writer, Strings& strings, Entity entity) {
+	(
+			[&]() {
+				if (!entity.has_component<Component>()) {
+					return;
+				}
+
+				writer.write((uint32_t)ComponentColumn<Component>::ID);
+
+				const size_t size_offset = writer.get_size();
+				writer.write<uint32_t>(0);
+
+				write_component(writer, strings, entity,
+						entity.get_component<Component>());
+
+				writer.write_at(size_offset,
+						(uint32_t)(writer.get_size() - size_offset -
+								sizeof(uint32_t)));
+			}(),
+			...);
+}
+
+// reads a component written by write_components into the entity, the
+// component is added if the entity does not have it yet
+template <typename Strings, typename... Component>
+inline bool read_component_slot(ComponentGroup<Component...>, uint32_t id,
+		BinaryReader& reader, const Strings& strings, Entity entity) {
+	bool result = false;
+
+	(
+			[&]() {
+				if (id != (uint32_t)ComponentColumn<Component>::ID) {
+					return;
+				}
+
+				Component& component = entity.has_component<Component>()
+						? entity.get_component<Component>()
+						: entity.add_component<Component>();
+
+				result = read_component(reader, strings, entity, component);
+			}(),
+			...);
+
+	return result;
+}
+
+} //namespace component_binary
+
+#endif
@@ -0,0 +1,349 @@
+#ifndef COMPONENT_REFLECTION_H
+#define COMPONENT_REFLECTION_H
+
+#include "core/json_utils.h"
+#include "scene/components.h"
+
+// Compile time field lists of the serializable components, json and binary
+// serializers, copy and diff routines are generated out of them. Fields
+// which only exist at runtime (physics handles, forces etc.) are left out.
+
+template <typename Class, typename T>
+struct ReflectedField {
+	using ValueType = T;
+
+	const char* name;
+	T Class::*member;
+};
+
+template <typename Class, typename T>
+constexpr ReflectedField<Class, T> reflect_field(
+		const char* name, T Class::*member) {
+	return { name, member };
+}
+
+// every serializable type specializes this with a FIELDS tuple, components
+// also define the json key they are stored with as NAME
+template <typename T>
+struct Reflection;
+
+template <typename T>
+concept Reflected = requires { Reflection<T>::FIELDS; };
+
+#define EVE_REFLECT(Class, Field) reflect_field(#Field, &Class::Field)
+
+NLOHMANN_JSON_SERIALIZE_ENUM(Rigidbody2D::BodyType,
+		{
+				{ Rigidbody2D::BodyType::STATIC, "static" },
+				{ Rigidbody2D::BodyType::DYNAMIC, "dynamic" },
+				{ Rigidbody2D::BodyType::KINEMATIC, "kinematic" },
+		})
+
+template <>
+struct Reflection<Transform> {
+	static constexpr const char* NAME = "transform_component";
+	static constexpr auto FIELDS = std::make_tuple(
+			EVE_REFLECT(Transform, local_position),
+			EVE_REFLECT(Transform, local_rotation),
+			EVE_REFLECT(Transform, local_scale));
+};
+
+template <>
+struct Reflection<OrthographicCamera> {
+	static constexpr auto FIELDS = std::make_tuple(
+			EVE_REFLECT(OrthographicCamera, aspect_ratio),
+			EVE_REFLECT(OrthographicCamera, zoom_level),
+			EVE_REFLECT(OrthographicCamera, near_clip),
+			EVE_REFLECT(OrthographicCamera, far_clip));
+};
+
+template <>
+struct Reflection<CameraComponent> {
+	static constexpr const char* NAME = "camera_component";
+	static constexpr auto FIELDS = std::make_tuple(
+			EVE_REFLECT(CameraComponent, camera),
+			EVE_REFLECT(CameraComponent, is_primary),
+			EVE_REFLECT(CameraComponent, is_fixed_aspect_ratio));
+};
+
+template <>
+struct Reflection<SpriteRenderer> {
+	static constexpr const char* NAME = "sprite_renderer_component";
+	static constexpr auto FIELDS = std::make_tuple(
+			EVE_REFLECT(SpriteRenderer, texture),
+			EVE_REFLECT(SpriteRenderer, color),
+			EVE_REFLECT(SpriteRenderer, tex_tiling),
+			EVE_REFLECT(SpriteRenderer, is_atlas),
+			EVE_REFLECT(SpriteRenderer, block_size),
+			EVE_REFLECT(SpriteRenderer, index));
+};
+
+template <>
+struct Reflection<TextRenderer> {
+	static constexpr const char* NAME = "text_renderer_component";
+	static constexpr auto FIELDS = std::make_tuple(
+			EVE_REFLECT(TextRenderer, text), EVE_REFLECT(TextRenderer, font),
+			EVE_REFLECT(TextRenderer, fg_color),
+			EVE_REFLECT(TextRenderer, bg_color),
+			EVE_REFLECT(TextRenderer, kerning),
+			EVE_REFLECT(TextRenderer, line_spacing),
+			EVE_REFLECT(TextRenderer, is_screen_space));
+};
+
+template <>
+struct Reflection<Rigidbody2D> {
+	static constexpr const char* NAME = "rigidbody2d_component";
+	static constexpr auto FIELDS =
+			std::make_tuple(EVE_REFLECT(Rigidbody2D, type),
+					EVE_REFLECT(Rigidbody2D, fixed_rotation));
+};
+
+template <>
+struct Reflection<BoxCollider2D> {
+	static constexpr const char* NAME = "box_collider";
+	static constexpr auto FIELDS = std::make_tuple(
+			EVE_REFLECT(BoxCollider2D, offset),
+			EVE_REFLECT(BoxCollider2D, size),
+			EVE_REFLECT(BoxCollider2D, is_trigger),
+			EVE_REFLECT(BoxCollider2D, density),
+			EVE_REFLECT(BoxCollider2D, friction),
+			EVE_REFLECT(BoxCollider2D, restitution),
+			EVE_REFLECT(BoxCollider2D, restitution_threshold));
+};
+
+template <>
+struct Reflection<CircleCollider2D> {
+	static constexpr const char* NAME = "circle_collider";
+	static constexpr auto FIELDS = std::make_tuple(
+			EVE_REFLECT(CircleCollider2D, offset),
+			EVE_REFLECT(CircleCollider2D, radius),
+			EVE_REFLECT(CircleCollider2D, is_trigger),
+			EVE_REFLECT(CircleCollider2D, density),
+			EVE_REFLECT(CircleCollider2D, friction),
+			EVE_REFLECT(CircleCollider2D, restitution),
+			EVE_REFLECT(CircleCollider2D, restitution_threshold));
+};
+
+template <>
+struct Reflection<PolygonCollider2D> {
+	static constexpr const char* NAME = "polygon_collider";
+	static constexpr auto FIELDS = std::make_tuple(
+			EVE_REFLECT(PolygonCollider2D, offset),
+			EVE_REFLECT(PolygonCollider2D, points),
+			EVE_REFLECT(PolygonCollider2D, is_trigger),
+			EVE_REFLECT(PolygonCollider2D, density),
+			EVE_REFLECT(PolygonCollider2D, friction),
+			EVE_REFLECT(PolygonCollider2D, restitution),
+			EVE_REFLECT(PolygonCollider2D, restitution_threshold));
+};
+
+template <>
+struct Reflection<CapsuleCollider2D> {
+	static constexpr const char* NAME = "capsule_collider";
+	static constexpr auto FIELDS = std::make_tuple(
+			EVE_REFLECT(CapsuleCollider2D, offset),
+			EVE_REFLECT(CapsuleCollider2D, radius),
+			EVE_REFLECT(CapsuleCollider2D, height),
+			EVE_REFLECT(CapsuleCollider2D, is_trigger),
+			EVE_REFLECT(CapsuleCollider2D, density),
+			EVE_REFLECT(CapsuleCollider2D, friction),
+			EVE_REFLECT(CapsuleCollider2D, restitution),
+			EVE_REFLECT(CapsuleCollider2D, restitution_threshold));
+};
+
+template <>
+struct Reflection<ChainCollider2D> {
+	static constexpr const char* NAME = "chain_collider";
+	static constexpr auto FIELDS = std::make_tuple(
+			EVE_REFLECT(ChainCollider2D, points),
+			EVE_REFLECT(ChainCollider2D, is_loop),
+			EVE_REFLECT(ChainCollider2D, friction),
+			EVE_REFLECT(ChainCollider2D, restitution),
+			EVE_REFLECT(ChainCollider2D, restitution_threshold));
+};
+
+template <>
+struct Reflection<PostProcessVolume::GrayScaleSettings> {
+	static constexpr auto FIELDS = std::make_tuple(
+			EVE_REFLECT(PostProcessVolume::GrayScaleSettings, enabled));
+};
+
+template <>
+struct Reflection<PostProcessVolume::ChromaticAberrationSettings> {
+	static constexpr auto FIELDS = std::make_tuple(
+			EVE_REFLECT(PostProcessVolume::ChromaticAberrationSettings,
+					enabled),
+			EVE_REFLECT(
+					PostProcessVolume::ChromaticAberrationSettings, offset));
+};
+
+template <>
+struct Reflection<PostProcessVolume::BlurSettings> {
+	static constexpr auto FIELDS = std::make_tuple(
+			EVE_REFLECT(PostProcessVolume::BlurSettings, enabled),
+			EVE_REFLECT(PostProcessVolume::BlurSettings, size),
+			EVE_REFLECT(PostProcessVolume::BlurSettings, seperation));
+};
+
+template <>
+struct Reflection<PostProcessVolume::SharpenSettings> {
+	static constexpr auto FIELDS = std::make_tuple(
+			EVE_REFLECT(PostProcessVolume::SharpenSettings, enabled),
+			EVE_REFLECT(PostProcessVolume::SharpenSettings, amount));
+};
+
+template <>
+struct Reflection<PostProcessVolume::VignetteSettings> {
+	static constexpr auto FIELDS = std::make_tuple(
+			EVE_REFLECT(PostProcessVolume::VignetteSettings, enabled),
+			EVE_REFLECT(PostProcessVolume::VignetteSettings, inner),
+			EVE_REFLECT(PostProcessVolume::VignetteSettings, outer),
+			EVE_REFLECT(PostProcessVolume::VignetteSettings, strength),
+			EVE_REFLECT(PostProcessVolume::VignetteSettings, curvature));
+};
+
+template <>
+struct Reflection<PostProcessVolume> {
+	static constexpr const char* NAME = "post_process_volume";
+	static constexpr auto FIELDS = std::make_tuple(
+			EVE_REFLECT(PostProcessVolume, is_global),
+			EVE_REFLECT(PostProcessVolume, gray_scale),
+			EVE_REFLECT(PostProcessVolume, chromatic_aberration),
+			EVE_REFLECT(PostProcessVolume, blur),
+			EVE_REFLECT(PostProcessVolume, sharpen),
+			EVE_REFLECT(PostProcessVolume, vignette));
+};
+
+// script field values live in the script engine and are serialized
+// separately by the scene
+template <>
+struct Reflection<ScriptComponent> {
+	static constexpr const char* NAME = "script_component";
+	static constexpr auto FIELDS =
+			std::make_tuple(EVE_REFLECT(ScriptComponent, class_name));
+};
+
+#undef EVE_REFLECT
+
+namespace reflection {
+
+template <Reflected T, typename Func>
+constexpr void for_each_field(Func&& func) {
+	std::apply([&](const auto&... field) { (func(field), ...); },
+			Reflection<T>::FIELDS);
+}
+
+template <typename T>
+inline bool is_value_equal(const T& lhs, const T& rhs) {
+	if constexpr (Reflected<T>) {
+		bool equal = true;
+		for_each_field<T>([&](const auto& field) {
+			equal = equal &&
+					is_value_equal(lhs.*field.member, rhs.*field.member);
+		});
+		return equal;
+	} else if constexpr (std::equality_comparable<T>) {
+		return lhs == rhs;
+	} else {
+		static_assert(std::is_trivially_copyable_v<T>,
+				"Field type is not comparable!");
+		return memcmp(&lhs, &rhs, sizeof(T)) == 0;
+	}
+}
+
+// copies only the reflected fields, runtime storage of dst is kept
+template <Reflected T>
+inline void copy(T& dst, const T& src) {
+	for_each_field<T>([&](const auto& field) {
+		dst.*field.member = src.*field.member;
+	});
+}
+
+// fields are written in declaration order so the key being looked for is
+// almost always the one after the previous match, the cursor is checked
+// first before falling back to a search
+inline Json::const_iterator find_key(
+		const Json& json, Json::const_iterator& cursor, const char* key) {
+	if (cursor != json.end() && cursor.key() == key) {
+		return cursor++;
+	}
+
+	const auto it = json.find(key);
+	if (it != json.end()) {
+		cursor = std::next(it);
+	}
+
+	return it;
+}
+
+template <Reflected T>
+inline void write_json(Json& json, const T& value) {
+	for_each_field<T>([&](const auto& field) {
+		using FieldType = typename std::decay_t<decltype(field)>::ValueType;
+
+		if constexpr (Reflected<FieldType>) {
+			Json field_json = Json::object();
+			write_json(field_json, value.*field.member);
+			json[field.name] = std::move(field_json);
+		} else {
+			json[field.name] = value.*field.member;
+		}
+	});
+}
+
+// missing keys keep their current values, so read_json also applies the
+// patches created with diff_json
+template <Reflected T>
+inline void read_json(const Json& json, T& value) {
+	if (!json.is_object()) {
+		return;
+	}
+
+	auto cursor = json.begin();
+
+	for_each_field<T>([&](const auto& field) {
+		using FieldType = typename std::decay_t<decltype(field)>::ValueType;
+
+		const auto it = find_key(json, cursor, field.name);
+		if (it == json.end() || it->is_null()) {
+			return;
+		}
+
+		if constexpr (Reflected<FieldType>) {
+			read_json(*it, value.*field.member);
+		} else {
+			it->get_to(value.*field.member);
+		}
+	});
+}
+
+// writes the fields of value which differ from base, nested structs only
+// contain their changed fields. returns false if nothing has changed.
+template <Reflected T>
+inline bool diff_json(const T& base, const T& value, Json& out) {
+	bool changed = false;
+
+	for_each_field<T>([&](const auto& field) {
+		using FieldType = typename std::decay_t<decltype(field)>::ValueType;
+
+		const FieldType& base_field = base.*field.member;
+		const FieldType& value_field = value.*field.member;
+
+		if constexpr (Reflected<FieldType>) {
+			Json field_json = Json::object();
+			if (diff_json(base_field, value_field, field_json)) {
+				out[field.name] = std::move(field_json);
+				changed = true;
+			}
+		} else if (!is_value_equal(base_field, value_field)) {
+			out[field.name] = value_field;
+			changed = true;
+		}
+	});
+
+	return changed;
+}
+
+} //namespace reflection
+
+#endif
@@ -106,14 +106,103 @@ struct CircleCollider2D {
 	void* runtime_fixture = nullptr;
 };
 
+// Convex polygon, Box2D limits the vertex count to 8.
+struct PolygonCollider2D {
+	// not scaled by the transform, same as the other colliders
+	glm::vec2 offset = { 0.0f, 0.0f };
+	std::vector<glm::vec2> points = {
+		{ -0.5f, -0.5f },
+		{ 0.5f, -0.5f },
+		{ 0.0f, 0.5f },
+	};
+
+	bool is_trigger = false;
+
+	// function which will be triggered uppon trigger event
+	// will be setted from script
+	CollisionTriggerFunction trigger_function = nullptr;
+
+	float density = 1.0f;
+	float friction = 0.5f;
+	float restitution = 0.0f;
+	float restitution_threshold = 0.5f;
+
+	// Storage for runtime
+	void* runtime_fixture = nullptr;
+	// set by the edits of the collider, the fixtures are rebuilt on the next
+	// step along with scale changes
+	bool runtime_dirty = false;
+	glm::vec2 runtime_scale = { 1.0f, 1.0f };
+};
+
+// Vertical capsule made out of a box and two circles.
+struct CapsuleCollider2D {
+	glm::vec2 offset = { 0.0f, 0.0f };
+	float radius = 0.25f;
+	// total height including the caps
+	float height = 1.0f;
+
+	bool is_trigger = false;
+
+	// function which will be triggered uppon trigger event
+	// will be setted from script
+	CollisionTriggerFunction trigger_function = nullptr;
+
+	float density = 1.0f;
+	float friction = 0.5f;
+	float restitution = 0.0f;
+	float restitution_threshold = 0.5f;
+
+	// Storage for runtime
+	void* runtime_fixture = nullptr;
+	// set by the edits of the collider, the fixtures are rebuilt on the next
+	// step along with scale changes
+	bool runtime_dirty = false;
+	glm::vec2 runtime_scale = { 1.0f, 1.0f };
+};
+
+// One sided edge chain mostly used for static level geometry, collides
+// from the right side of each segment.
+struct ChainCollider2D {
+	std::vector<glm::vec2> points;
+	bool is_loop = true;
+
+	float friction = 0.5f;
+	float restitution = 0.0f;
+	float restitution_threshold = 0.5f;
+
+	// Storage for runtime
+	void* runtime_fixture = nullptr;
+	// set by the edits of the collider, the fixtures are rebuilt on the next
+	// step along with scale changes
+	bool runtime_dirty = false;
+	glm::vec2 runtime_scale = { 1.0f, 1.0f };
+};
+
 struct ScriptComponent {
 	std::string class_name;
 };
 
+// Runtime only tags, they are neither serialized nor copied.
+
+// entity is sitting in a pool, scripts, physics and rendering skip it
+struct InactiveComponent {};
+
+// root of an instance spawned through Scene::spawn, released instances
+// return to the pool of the prefab
+struct PooledComponent {
+	AssetHandle prefab = 0;
+};
+
 template <typename... Component> struct ComponentGroup {};
 
 using AllComponents = ComponentGroup<Transform, CameraComponent, SpriteRenderer,
 		TextRenderer, Rigidbody2D, BoxCollider2D, CircleCollider2D,
+		PolygonCollider2D, CapsuleCollider2D, ChainCollider2D,
 		PostProcessVolume, ScriptComponent>;
 
+// components scripts can read and write in place, their layout is mirrored
+// by the blittable structs of script_core
+using ScriptDataComponents = ComponentGroup<Transform, SpriteRenderer>;
+
 #endif
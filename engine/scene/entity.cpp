@@ -12,12 +12,12 @@ const RelationComponent& Entity::get_relation() const {
 }
 
 Entity Entity::get_parent() const {
-	const auto parent_id = get_relation().parent_id;
-	if (!parent_id) {
+	const entt::entity parent = get_relation().parent;
+	if (parent == entt::null) {
 		return INVALID_ENTITY;
 	}
 
-	return scene->find_by_id(parent_id);
+	return { parent, scene };
 }
 
 void Entity::set_parent(Entity parent) {
@@ -38,12 +38,25 @@ void Entity::set_parent(Entity parent) {
 	}
 
 	RelationComponent& parent_relation = parent.get_relation();
-	auto& parent_children_ids = parent_relation.children_ids;
 
-	// Setup relations between components
+	// Setup relations between components, append to the end of the children
 	RelationComponent& relation = get_relation();
 	relation.parent_id = parent.get_uid();
-	parent_children_ids.push_back(get_uid());
+	relation.parent = parent;
+	relation.prev_sibling = parent_relation.last_child;
+	relation.next_sibling = entt::null;
+
+	if (parent_relation.last_child != entt::null) {
+		scene->get_component<RelationComponent>(parent_relation.last_child)
+				.next_sibling = handle;
+	} else {
+		parent_relation.first_child = handle;
+	}
+
+	parent_relation.last_child = handle;
+	parent_relation.child_count++;
+
+	_set_depth(parent_relation.depth + 1);
 
 	// Make transform values relative to the new parent.
 	Transform& transform = get_transform();
@@ -59,11 +72,11 @@ void Entity::set_parent(Entity parent) {
 }
 
 bool Entity::is_parent() const {
-	return get_relation().children_ids.size() > 0;
+	return get_relation().first_child != entt::null;
 }
 
 bool Entity::is_child() const {
-	return get_relation().parent_id != INVALID_UID;
+	return get_relation().parent != entt::null;
 }
 
 std::vector<Entity> Entity::get_children() const {
@@ -71,44 +84,32 @@ std::vector<Entity> Entity::get_children() const {
 		return {};
 	}
 
-	const std::vector<UID>& children_ids = get_relation().children_ids;
-
 	std::vector<Entity> children;
+	children.reserve(get_relation().child_count);
 
-	std::transform(children_ids.begin(), children_ids.end(), std::back_inserter(children), [&](const auto& child_id) {
-		Entity entity = scene->find_by_id(child_id);
-		return entity;
-	});
-
-	// remove entities that are not found
-	children.erase(std::remove_if(children.begin(), children.end(), [](const Entity& entity) { return !entity; }), children.end());
+	each_child([&](Entity child) { children.push_back(child); });
 
 	return children;
 }
 
 bool Entity::remove_child(Entity child) {
-	auto& children_ids = get_relation().children_ids;
-
-	const auto it =
-			std::find(children_ids.begin(), children_ids.end(), child.get_uid());
+	if (!child || child.get_relation().parent != handle) {
+		return false;
+	}
 
-	if (it != children_ids.end()) {
-		// Set local positions as the world position
-		Transform& child_transform = child.get_transform();
-		child_transform.local_position = child_transform.get_position();
-		child_transform.local_rotation = child_transform.get_rotation();
-		child_transform.local_scale = child_transform.get_scale();
+	// Set local positions as the world position
+	Transform& child_transform = child.get_transform();
+	child_transform.local_position = child_transform.get_position();
+	child_transform.local_rotation = child_transform.get_rotation();
+	child_transform.local_scale = child_transform.get_scale();
 
-		child_transform.parent = nullptr;
+	child_transform.parent = nullptr;
 
-		// move child to top level
-		child.get_relation().parent_id = INVALID_UID;
-		children_ids.erase(it);
+	// move child to top level
+	child._detach();
+	child._set_depth(0);
 
-		return true;
-	}
-
-	return false;
+	return true;
 }
 
 bool Entity::is_parent_of(Entity parent, Entity child) {
@@ -141,10 +142,66 @@ const std::string& Entity::get_name() {
 	return get_component<IdComponent>().tag;
 }
 
+void Entity::set_name(const std::string& name) {
+	IdComponent& id = get_component<IdComponent>();
+	if (id.tag == name) {
+		return;
+	}
+
+	scene->name_index.remove(id.tag, handle);
+	id.tag = name;
+	scene->name_index.add(id.tag, handle);
+}
+
 Transform& Entity::get_transform() {
 	return get_component<Transform>();
 }
 
+void Entity::_detach() {
+	RelationComponent& relation = get_relation();
+	if (relation.parent == entt::null) {
+		return;
+	}
+
+	RelationComponent& parent_relation =
+			scene->get_component<RelationComponent>(relation.parent);
+
+	if (relation.prev_sibling != entt::null) {
+		scene->get_component<RelationComponent>(relation.prev_sibling)
+				.next_sibling = relation.next_sibling;
+	} else {
+		parent_relation.first_child = relation.next_sibling;
+	}
+
+	if (relation.next_sibling != entt::null) {
+		scene->get_component<RelationComponent>(relation.next_sibling)
+				.prev_sibling = relation.prev_sibling;
+	} else {
+		parent_relation.last_child = relation.prev_sibling;
+	}
+
+	parent_relation.child_count--;
+
+	relation.parent_id = INVALID_UID;
+	relation.parent = entt::null;
+	relation.prev_sibling = entt::null;
+	relation.next_sibling = entt::null;
+}
+
+void Entity::_set_depth(uint32_t depth) {
+	RelationComponent& relation = get_relation();
+	if (relation.depth == depth) {
+		return;
+	}
+
+	const int32_t offset = (int32_t)depth - (int32_t)relation.depth;
+	relation.depth = depth;
+
+	each_descendant([offset](Entity descendant) {
+		descendant.get_relation().depth += offset;
+	});
+}
+
 Entity::operator bool() const {
 	return handle != entt::null && scene != nullptr;
 }
@@ -11,9 +11,22 @@ struct IdComponent {
 	std::string tag;
 };
 
+// Hierarchy is stored as links between the entity handles so that it can be
+// walked without any id lookups or allocations. Children of an entity form a
+// doubly linked list in the order they were added.
 struct RelationComponent {
+	// kept for serialization, handles are not stable between scenes
 	UID parent_id = 0;
-	std::vector<UID> children_ids{};
+
+	entt::entity parent = entt::null;
+	entt::entity first_child = entt::null;
+	entt::entity last_child = entt::null;
+	entt::entity prev_sibling = entt::null;
+	entt::entity next_sibling = entt::null;
+
+	uint32_t child_count = 0;
+	// zero for the top level entities
+	uint32_t depth = 0;
 };
 
 class Entity {
@@ -67,8 +80,51 @@ public:
 
 	bool is_child() const;
 
+	// allocates, prefer each_child for traversals
 	std::vector<Entity> get_children() const;
 
+	// the next sibling is fetched before calling func, so func is allowed to
+	// reparent or destroy the given child
+	template <typename Func>
+	inline void each_child(Func&& func) const {
+		entt::entity child = get_relation().first_child;
+		while (child != entt::null) {
+			const entt::entity next =
+					scene->get_component<RelationComponent>(child).next_sibling;
+			func(Entity{ child, scene });
+			child = next;
+		}
+	}
+
+	// visits every entity under this one depth first, parents before their
+	// children. func must not change the hierarchy.
+	template <typename Func>
+	inline void each_descendant(Func&& func) const {
+		entt::entity current = get_relation().first_child;
+		while (current != entt::null) {
+			func(Entity{ current, scene });
+
+			const RelationComponent* relation =
+					&scene->get_component<RelationComponent>(current);
+			if (relation->first_child != entt::null) {
+				current = relation->first_child;
+				continue;
+			}
+
+			// climb up until an entity with a next sibling is found
+			while (relation->next_sibling == entt::null) {
+				current = relation->parent;
+				if (current == handle) {
+					return;
+				}
+
+				relation = &scene->get_component<RelationComponent>(current);
+			}
+
+			current = relation->next_sibling;
+		}
+	}
+
 	bool remove_child(Entity child);
 
 	static bool is_parent_of(Entity parent, Entity child);
@@ -77,6 +133,9 @@ public:
 
 	const std::string& get_name();
 
+	// renames through the scene so that the name index stays in sync
+	void set_name(const std::string& name);
+
 	Transform& get_transform();
 
 	operator bool() const;
@@ -89,10 +148,18 @@ public:
 
 	bool operator!=(const Entity& other) const;
 
+private:
+	// unlinks from the parent without touching the transform
+	void _detach();
+
+	// updates the depth of the entity and its descendants
+	void _set_depth(uint32_t depth);
+
 private:
 	entt::entity handle;
 	Scene* scene = nullptr;
 
+	friend class Scene;
 	friend class HierarchyPanel;
 };
 
@@ -0,0 +1,113 @@
+#include "scene/name_index.h"
+
+NameIndex::NameIndex(const NameIndex& other) :
+		names(other.names),
+		positions(other.positions),
+		next_sequence(other.next_sequence) {
+	for (const auto& [name, entry] : names) {
+		sorted_names.insert(name);
+	}
+}
+
+NameIndex& NameIndex::operator=(const NameIndex& other) {
+	if (this == &other) {
+		return *this;
+	}
+
+	names = other.names;
+	positions = other.positions;
+	next_sequence = other.next_sequence;
+
+	sorted_names.clear();
+	for (const auto& [name, entry] : names) {
+		sorted_names.insert(name);
+	}
+
+	return *this;
+}
+
+void NameIndex::add(std::string_view name, entt::entity entity) {
+	auto it = names.find(name);
+	if (it == names.end()) {
+		it = names.emplace(std::string(name), NameEntry()).first;
+		sorted_names.insert(it->first);
+	}
+
+	NameEntry& entry = it->second;
+	if (entry.entities.empty()) {
+		entry.oldest = entity;
+	}
+
+	positions[entity] = (uint32_t)entry.entities.size();
+
+	entry.entities.push_back(entity);
+	entry.sequences.push_back(next_sequence++);
+}
+
+void NameIndex::remove(std::string_view name, entt::entity entity) {
+	const auto it = names.find(name);
+	const auto position_it = positions.find(entity);
+	if (it == names.end() || position_it == positions.end()) {
+		return;
+	}
+
+	NameEntry& entry = it->second;
+
+	const uint32_t index = position_it->second;
+	if (index >= entry.entities.size() || entry.entities[index] != entity) {
+		return;
+	}
+
+	// the last entity takes the place of the removed one
+	const entt::entity last = entry.entities.back();
+	entry.entities[index] = last;
+	entry.sequences[index] = entry.sequences.back();
+	positions[last] = index;
+
+	entry.entities.pop_back();
+	entry.sequences.pop_back();
+	positions.erase(entity);
+
+	if (entry.entities.empty()) {
+		sorted_names.erase(it->first);
+		names.erase(it);
+		return;
+	}
+
+	// only removing the oldest entity requires a search for the next one
+	if (entry.oldest == entity) {
+		const auto min_it = std::min_element(
+				entry.sequences.begin(), entry.sequences.end());
+		entry.oldest = entry.entities[min_it - entry.sequences.begin()];
+	}
+}
+
+void NameIndex::clear() {
+	sorted_names.clear();
+	names.clear();
+	positions.clear();
+	next_sequence = 0;
+}
+
+entt::entity NameIndex::find(std::string_view name) const {
+	const auto it = names.find(name);
+	if (it == names.end()) {
+		return entt::null;
+	}
+
+	return it->second.oldest;
+}
+
+const std::vector<entt::entity>& NameIndex::find_all(
+		std::string_view name) const {
+	static const std::vector<entt::entity> s_empty;
+
+	const auto it = names.find(name);
+	if (it == names.end()) {
+		return s_empty;
+	}
+
+	return it->second.entities;
+}
+
+size_t NameIndex::get_name_count() const { return names.size(); }
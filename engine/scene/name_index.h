@@ -0,0 +1,75 @@
+#ifndef NAME_INDEX_H
+#define NAME_INDEX_H
+
+#include <entt/entt.hpp>
+
+// Maps the entity names to the entities that have them. Every distinct name
+// is stored once, lookups go through a string_view so they do not allocate,
+// and a sorted view of the names answers prefix queries. Entities are removed
+// in constant time through their position, a sequence number remembers which
+// one was added first.
+class NameIndex {
+public:
+	NameIndex() = default;
+
+	// sorted names point into the copied map, so they are rebuilt
+	NameIndex(const NameIndex& other);
+	NameIndex& operator=(const NameIndex& other);
+
+	NameIndex(NameIndex&& other) = default;
+	NameIndex& operator=(NameIndex&& other) = default;
+
+	void add(std::string_view name, entt::entity entity);
+
+	void remove(std::string_view name, entt::entity entity);
+
+	void clear();
+
+	// first entity added with the name, entt::null if there is none
+	entt::entity find(std::string_view name) const;
+
+	// every entity with the name in no particular order
+	const std::vector<entt::entity>& find_all(std::string_view name) const;
+
+	// calls func with every entity whose name starts with prefix, names are
+	// visited in lexicographical order
+	template <typename Func>
+	inline void each_with_prefix(std::string_view prefix, Func&& func) const {
+		for (auto it = sorted_names.lower_bound(prefix);
+				it != sorted_names.end() && it->starts_with(prefix); it++) {
+			for (const entt::entity entity : names.find(*it)->second.entities) {
+				func(entity);
+			}
+		}
+	}
+
+	size_t get_name_count() const;
+
+private:
+	struct NameHash {
+		using is_transparent = void;
+
+		inline size_t operator()(std::string_view name) const {
+			return std::hash<std::string_view>{}(name);
+		}
+	};
+
+	struct NameEntry {
+		std::vector<entt::entity> entities;
+		// order the entities were added in, parallel to entities
+		std::vector<uint64_t> sequences;
+		entt::entity oldest = entt::null;
+	};
+
+	std::unordered_map<std::string, NameEntry, NameHash, std::equal_to<>>
+			names;
+
+	// index of every entity in the entities of its name
+	std::unordered_map<entt::entity, uint32_t> positions;
+	uint64_t next_sequence = 0;
+
+	// views of the keys of names, which keep their address
+	std::set<std::string_view> sorted_names;
+};
+
+#endif
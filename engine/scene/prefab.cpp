@@ -0,0 +1,503 @@
+#include "scene/prefab.h"
+
+#include "core/binary_utils.h"
+#include "scene/component_binary.h"
+#include "scene/components.h"
+#include "scripting/script_engine.h"
+#include "scripting/script_events.h"
+
+// "EPRF" in little endian
+inline constexpr uint32_t PREFAB_MAGIC = 0x46525045;
+inline constexpr uint32_t PREFAB_VERSION = 1;
+
+struct PrefabHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t entity_count;
+	uint32_t data_size;
+};
+
+const std::vector<PrefabEntity>& Prefab::get_entities() const {
+	return entities;
+}
+
+const std::vector<uint8_t>& Prefab::get_data() const { return data; }
+
+Ref<Prefab> Prefab::create(Entity root) {
+	EVE_PROFILE_FUNCTION();
+
+	if (!root) {
+		return nullptr;
+	}
+
+	Ref<Prefab> prefab = create_ref<Prefab>();
+
+	std::unordered_map<entt::entity, uint32_t> indices;
+
+	BinaryWriter writer;
+	InlineStrings strings;
+
+	const auto add_entity = [&](Entity entity) {
+		const uint32_t index = prefab->entities.size();
+		indices[entity] = index;
+
+		PrefabEntity prefab_entity;
+		prefab_entity.uid = entity.get_uid();
+		prefab_entity.name = entity.get_name();
+		prefab_entity.parent = entity == root
+				? PREFAB_ROOT_PARENT
+				: indices.at(entity.get_relation().parent);
+		prefab_entity.offset = writer.get_size();
+
+		component_binary::write_components(
+				AllComponents{}, writer, strings, entity);
+
+		prefab_entity.size = writer.get_size() - prefab_entity.offset;
+
+		prefab->entities.push_back(std::move(prefab_entity));
+	};
+
+	// depth first so that parents come before their children
+	add_entity(root);
+	root.each_descendant(add_entity);
+
+	prefab->data.assign(
+			writer.get_data(), writer.get_data() + writer.get_size());
+
+	return prefab;
+}
+
+bool Prefab::serialize(const Ref<Prefab>& prefab, const fs::path& path) {
+	EVE_PROFILE_FUNCTION();
+
+	PrefabHeader header = {};
+	header.magic = PREFAB_MAGIC;
+	header.version = PREFAB_VERSION;
+	header.entity_count = prefab->entities.size();
+	header.data_size = prefab->data.size();
+
+	BinaryWriter writer;
+	writer.write(header);
+
+	for (const PrefabEntity& entity : prefab->entities) {
+		writer.write<uint64_t>(entity.uid);
+		writer.write_string(entity.name);
+		writer.write(entity.parent);
+		writer.write(entity.offset);
+		writer.write(entity.size);
+	}
+
+	writer.write_bytes(prefab->data.data(), prefab->data.size());
+
+	std::ofstream file(path, std::ios::binary);
+	if (!file.is_open()) {
+		EVE_LOG_ERROR("Unable to open prefab file at \"{}\".", path.string());
+		return false;
+	}
+
+	file.write((const char*)writer.get_data(), writer.get_size());
+
+	return true;
+}
+
+Ref<Prefab> Prefab::deserialize(const fs::path& path) {
+	EVE_PROFILE_FUNCTION();
+
+	std::ifstream file(path, std::ios::binary);
+	if (!file.is_open()) {
+		EVE_LOG_ERROR("Failed to load prefab file at '{}'", path.string());
+		return nullptr;
+	}
+
+	const std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)),
+			std::istreambuf_iterator<char>());
+
+	const auto fail = [&]() -> Ref<Prefab> {
+		EVE_LOG_ERROR("Unable to read prefab '{}', file is corrupted.",
+				path.string());
+		return nullptr;
+	};
+
+	BinaryReader reader(bytes.data(), bytes.size());
+
+	PrefabHeader header;
+	if (!reader.read(header) || header.magic != PREFAB_MAGIC ||
+			header.version != PREFAB_VERSION) {
+		return fail();
+	}
+
+	Ref<Prefab> prefab = create_ref<Prefab>();
+	prefab->entities.reserve(header.entity_count);
+
+	for (uint32_t i = 0; i < header.entity_count; i++) {
+		PrefabEntity entity;
+
+		uint64_t uid = 0;
+		std::string_view name;
+		reader.read(uid);
+		reader.read_string(name);
+		reader.read(entity.parent);
+		reader.read(entity.offset);
+		reader.read(entity.size);
+
+		if (!reader.is_valid() ||
+				(uint64_t)entity.offset + entity.size > header.data_size) {
+			return fail();
+		}
+
+		// only the root is allowed to have no parent
+		if ((i == 0) != (entity.parent == PREFAB_ROOT_PARENT) ||
+				(i > 0 && entity.parent >= i)) {
+			return fail();
+		}
+
+		entity.uid = uid;
+		entity.name = name;
+
+		prefab->entities.push_back(std::move(entity));
+	}
+
+	if (prefab->entities.empty() ||
+			reader.get_remaining() != header.data_size) {
+		return fail();
+	}
+
+	prefab->data.resize(header.data_size);
+	reader.read_bytes(prefab->data.data(), header.data_size);
+
+	return prefab;
+}
+
+inline static void read_components(const PrefabEntity& prefab_entity,
+		const std::vector<uint8_t>& data, const InlineStrings& strings,
+		Entity entity) {
+	const uint8_t* entity_data = data.data() + prefab_entity.offset;
+	BinaryReader reader(entity_data, prefab_entity.size);
+
+	uint32_t id = 0;
+	uint32_t size = 0;
+	while (reader.get_remaining() > 0 && reader.read(id) &&
+			reader.read(size) && size <= reader.get_remaining()) {
+		BinaryReader component_reader(
+				entity_data + reader.get_position(), size);
+		reader.skip(size);
+
+		if (!component_binary::read_component_slot(AllComponents{}, id,
+					component_reader, strings, entity)) {
+			EVE_LOG_WARNING("Skipping component {} of prefab entity '{}'.",
+					id, prefab_entity.name);
+		}
+	}
+}
+
+// script fields referencing entities of the prefab are pointed to the same
+// entities of the instance
+inline static void remap_entity_fields(
+		const std::vector<PrefabEntity>& prefab_entities,
+		const Entity* instance) {
+	for (size_t i = 0; i < prefab_entities.size(); i++) {
+		Entity entity = instance[i];
+		if (!entity.has_component<ScriptComponent>()) {
+			continue;
+		}
+
+		for (auto& [name, field] : ScriptEngine::get_script_field_map(entity)) {
+			if (field.field.type != ScriptFieldType::ENTITY) {
+				continue;
+			}
+
+			const uint64_t target = field.get_value<uint64_t>();
+			for (size_t j = 0; j < prefab_entities.size(); j++) {
+				if (prefab_entities[j].uid == target) {
+					field.set_value<uint64_t>(instance[j].get_uid());
+					break;
+				}
+			}
+		}
+	}
+}
+
+Entity Scene::instantiate(
+		const Prefab& prefab, UID parent_id, const glm::vec3* position) {
+	std::vector<Entity> roots;
+	instantiate(prefab, 1, roots, parent_id, position);
+
+	return roots.empty() ? INVALID_ENTITY : roots.front();
+}
+
+void Scene::instantiate(const Prefab& prefab, uint32_t count,
+		std::vector<Entity>& roots, UID parent_id,
+		const glm::vec3* positions) {
+	EVE_PROFILE_FUNCTION();
+
+	const std::vector<PrefabEntity>& prefab_entities = prefab.get_entities();
+	const std::vector<uint8_t>& data = prefab.get_data();
+
+	if (prefab_entities.empty() || count == 0) {
+		return;
+	}
+
+	const Entity parent = find_by_id(parent_id);
+
+	const size_t entity_count = prefab_entities.size() * count;
+	entity_map.reserve(entity_map.size() + entity_count);
+	roots.reserve(roots.size() + count);
+
+	// scripts are started once every instance exists
+	std::vector<Entity> created;
+	created.reserve(entity_count);
+
+	const bool has_scripts = ScriptEngine::is_initialized();
+	bool has_script_components = false;
+
+	InlineStrings strings;
+
+	for (uint32_t instance = 0; instance < count; instance++) {
+		const size_t first = created.size();
+
+		for (const PrefabEntity& prefab_entity : prefab_entities) {
+			Entity entity = create(prefab_entity.name);
+
+			const Entity entity_parent =
+					prefab_entity.parent == PREFAB_ROOT_PARENT
+					? parent
+					: created[first + prefab_entity.parent];
+			if (entity_parent) {
+				entity.set_parent(entity_parent);
+			}
+
+			created.push_back(entity);
+		}
+
+		// parents are linked before the transforms are assigned so local
+		// values are not converted
+		for (size_t i = 0; i < prefab_entities.size(); i++) {
+			const PrefabEntity& prefab_entity = prefab_entities[i];
+			Entity entity = created[first + i];
+
+			read_components(prefab_entity, data, strings, entity);
+
+			has_script_components |= entity.has_component<ScriptComponent>();
+		}
+
+		Entity root = created[first];
+		if (positions) {
+			root.get_transform().local_position = positions[instance];
+		}
+
+		roots.push_back(root);
+
+		if (has_scripts && has_script_components) {
+			remap_entity_fields(prefab_entities, created.data() + first);
+		}
+	}
+
+	if (!is_running() || !has_scripts || !has_script_components) {
+		return;
+	}
+
+	// same as start, entity fields may reference other new entities
+	for (Entity entity : created) {
+		if (entity.has_component<ScriptComponent>()) {
+			ScriptEngine::create_entity_instance(entity);
+		}
+	}
+
+	for (Entity entity : created) {
+		if (entity.has_component<ScriptComponent>()) {
+			ScriptEngine::set_entity_managed_field_values(entity);
+			ScriptEngine::invoke_on_create_entity(entity);
+		}
+	}
+}
+
+Entity Scene::spawn(
+		const Prefab& prefab, UID parent_id, const glm::vec3* position) {
+	EVE_PROFILE_FUNCTION();
+
+	std::vector<Entity>& pool = entity_pools[prefab.handle];
+	while (!pool.empty()) {
+		const Entity root = pool.back();
+		pool.pop_back();
+
+		// pooled instances go away with the scripts or parents destroying them
+		if (!registry.valid(root) || !root.has_component<InactiveComponent>()) {
+			continue;
+		}
+
+		if (_reuse_instance(prefab, root, parent_id, position)) {
+			return root;
+		}
+
+		destroy(root);
+	}
+
+	Entity root = instantiate(prefab, parent_id, position);
+	if (root) {
+		root.add_component<PooledComponent>(prefab.handle);
+	}
+
+	return root;
+}
+
+void Scene::release(Entity root) {
+	if (!root) {
+		return;
+	}
+
+	if (!root.has_component<PooledComponent>()) {
+		queue_destroy(root);
+		return;
+	}
+
+	if (!is_running()) {
+		_release_instance(root);
+		return;
+	}
+
+	release_queue.push_back(root.get_uid());
+}
+
+void Scene::clear_pools() {
+	EVE_PROFILE_FUNCTION();
+
+	for (auto& [prefab, pool] : entity_pools) {
+		for (Entity root : pool) {
+			if (registry.valid(root) &&
+					root.has_component<InactiveComponent>()) {
+				destroy(root);
+			}
+		}
+	}
+
+	entity_pools.clear();
+}
+
+void Scene::_release_instance(Entity root) {
+	// released more than once in the same frame
+	if (root.has_component<InactiveComponent>()) {
+		return;
+	}
+
+	EVE_PROFILE_FUNCTION();
+
+	// pools only hold top level entities so that destroying the old parent
+	// does not take them along
+	root.set_parent(INVALID_ENTITY);
+
+	const bool has_scripts = is_running() && ScriptEngine::is_initialized();
+
+	const auto deactivate = [&](Entity entity) {
+		if (has_scripts && entity.has_component<ScriptComponent>()) {
+			ScriptEngine::invoke_on_destroy_entity(entity);
+		}
+
+		if (is_running()) {
+			physics_system.set_body_enabled(entity, false);
+
+			// handlers subscribed in OnCreate would be added again on reuse
+			script_events::push_entity_destroyed(entity.get_uid());
+		}
+
+		if (is_entity_selected(entity)) {
+			unselect_entity(entity);
+		}
+
+		// inactive entities should not be found by the scripts
+		name_index.remove(entity.get_name(), entity);
+
+		entity.add_component<InactiveComponent>();
+	};
+
+	deactivate(root);
+	root.each_descendant(deactivate);
+
+	entity_pools[root.get_component<PooledComponent>().prefab].push_back(root);
+}
+
+bool Scene::_reuse_instance(const Prefab& prefab, Entity root, UID parent_id,
+		const glm::vec3* position) {
+	const std::vector<PrefabEntity>& prefab_entities = prefab.get_entities();
+
+	// OnCreate of the instance might spawn again, so the entities are not
+	// shared between calls
+	std::vector<Entity> instance;
+	instance.reserve(prefab_entities.size());
+
+	instance.push_back(root);
+	root.each_descendant([&](Entity entity) { instance.push_back(entity); });
+
+	// children might have been added or destroyed while it was in use
+	if (instance.size() != prefab_entities.size()) {
+		return false;
+	}
+
+	for (size_t i = 1; i < instance.size(); i++) {
+		const entt::entity expected = instance[prefab_entities[i].parent];
+		if (instance[i].get_relation().parent != expected) {
+			return false;
+		}
+	}
+
+	const Entity parent = find_by_id(parent_id);
+	if (parent) {
+		root.set_parent(parent);
+	}
+
+	// same as instantiate, the parent is linked before the transforms are
+	// assigned
+	InlineStrings strings;
+	bool has_script_components = false;
+
+	for (size_t i = 0; i < prefab_entities.size(); i++) {
+		const PrefabEntity& prefab_entity = prefab_entities[i];
+		Entity entity = instance[i];
+
+		entity.get_component<IdComponent>().tag = prefab_entity.name;
+		name_index.add(prefab_entity.name, entity);
+
+		registry.remove<InactiveComponent>(entity);
+
+		read_components(prefab_entity, prefab.get_data(), strings, entity);
+
+		has_script_components |= entity.has_component<ScriptComponent>();
+	}
+
+	if (position) {
+		root.get_transform().local_position = *position;
+	}
+
+	const bool has_scripts =
+			ScriptEngine::is_initialized() && has_script_components;
+	if (has_scripts) {
+		remap_entity_fields(prefab_entities, instance.data());
+	}
+
+	if (!is_running()) {
+		return true;
+	}
+
+	for (Entity entity : instance) {
+		physics_system.set_body_enabled(entity, true);
+	}
+
+	if (!has_scripts) {
+		return true;
+	}
+
+	// existing instances only get their field values back
+	for (Entity entity : instance) {
+		if (entity.has_component<ScriptComponent>()) {
+			ScriptEngine::reset_entity_instance(entity);
+		}
+	}
+
+	for (Entity entity : instance) {
+		if (entity.has_component<ScriptComponent>()) {
+			ScriptEngine::set_entity_managed_field_values(entity);
+			ScriptEngine::invoke_on_create_entity(entity);
+		}
+	}
+
+	return true;
+}
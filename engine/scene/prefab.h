@@ -0,0 +1,57 @@
+#ifndef PREFAB_H
+#define PREFAB_H
+
+#include "asset/asset.h"
+#include "scene/entity.h"
+
+inline constexpr const char* PREFAB_EXTENSION = ".eprf";
+
+// parent index of the root entity
+inline constexpr uint32_t PREFAB_ROOT_PARENT = UINT32_MAX;
+
+struct PrefabEntity {
+	// id of the entity the prefab was baked from, instances get new ones
+	UID uid;
+	std::string name;
+	// index of the parent in the prefab, parents come before their children
+	uint32_t parent;
+
+	// range of the components in the prefab data
+	uint32_t offset;
+	uint32_t size;
+};
+
+// Entity hierarchy baked into the binary component encoding of the cooked
+// scenes. The file is read once, so instantiating only decodes the
+// components into the new entities without going through any json.
+//
+// File layout:
+//
+//  PrefabHeader
+//  entity table, uid, name, parent, offset and size of every entity
+//  component data, written by component_binary::write_components
+class Prefab final : public Asset {
+public:
+	EVE_IMPL_ASSET(AssetType::PREFAB)
+
+	virtual ~Prefab() = default;
+
+	const std::vector<PrefabEntity>& get_entities() const;
+
+	const std::vector<uint8_t>& get_data() const;
+
+	// bakes the entity and its descendants, the root keeps its local
+	// transform
+	static Ref<Prefab> create(Entity root);
+
+	static bool serialize(const Ref<Prefab>& prefab, const fs::path& path);
+
+	// returns null if the file is not a valid prefab
+	static Ref<Prefab> deserialize(const fs::path& path);
+
+private:
+	std::vector<PrefabEntity> entities;
+	std::vector<uint8_t> data;
+};
+
+#endif
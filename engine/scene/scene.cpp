@@ -4,19 +4,57 @@
 #include "core/uid.h"
 #include "physics/physics_system.h"
 #include "project/project.h"
+#include "scene/component_reflection.h"
 #include "scene/components.h"
 #include "scene/entity.h"
+#include "scene/scene_load_data.h"
 #include "scene/transform.h"
 #include "scripting/script_engine.h"
+#include "scripting/script_events.h"
+#include "scripting/script_jobs.h"
 
-Scene::Scene(const std::string& name) : name(name), physics_system(this) {}
+// one per storage, shared by every scene. see Scene::get_storage_generation
+template <typename T> static uint32_t s_storage_generation = 0;
+
+template <typename T>
+inline static void on_storage_changed(entt::registry&, entt::entity) {
+	s_storage_generation<T>++;
+}
+
+// adding or removing a component may move the others of the storage
+template <typename... Component>
+inline static void connect_storage_signals(
+		ComponentGroup<Component...>, entt::registry& registry) {
+	(
+			[&]() {
+				registry.on_construct<Component>()
+						.template connect<&on_storage_changed<Component>>();
+				registry.on_destroy<Component>()
+						.template connect<&on_storage_changed<Component>>();
+			}(),
+			...);
+}
+
+template <typename... Component>
+inline static void invalidate_storages(ComponentGroup<Component...>) {
+	(s_storage_generation<Component>++, ...);
+}
+
+Scene::Scene(const std::string& name) :
+		name(name),
+		physics_system(this,
+				Project::get_active() ? Project::get_physics_settings()
+									  : PhysicsSettings{}) {
+	connect_storage_signals(ScriptDataComponents{}, registry);
+}
 
 void Scene::start() {
 	EVE_PROFILE_FUNCTION();
 
 	running = true;
 
-	{
+	// headless tools run scenes without a script runtime
+	if (ScriptEngine::is_initialized()) {
 		ScriptEngine::on_runtime_start(this);
 
 		const auto script_view = view<ScriptComponent>();
@@ -51,12 +89,17 @@ void Scene::update(float dt) {
 
 	EVE_PROFILE_FUNCTION();
 
-	for (auto entity_id : view<ScriptComponent>()) {
-		Entity entity = { entity_id, this };
-		ScriptEngine::invoke_on_update_entity(entity, dt);
+	// pooled entities are not part of the update batches
+	if (ScriptEngine::is_initialized()) {
+		ScriptEngine::update_entities(dt);
+
+		// jobs left by the scripts finish before physics moves the bodies
+		script_jobs::complete_scheduled();
 	}
 
 	physics_system.update(dt);
+
+	flush_pending();
 }
 
 void Scene::stop() {
@@ -64,14 +107,25 @@ void Scene::stop() {
 
 	running = false;
 
-	for (auto entity_id : view<ScriptComponent>()) {
-		Entity entity = { entity_id, this };
-		ScriptEngine::invoke_on_destroy_entity(entity);
-	}
+	// pooled entities got their destroy callbacks when they were released
+	if (ScriptEngine::is_initialized()) {
+		for (auto entity_id :
+				view<ScriptComponent>(entt::exclude<InactiveComponent>)) {
+			Entity entity = { entity_id, this };
+			ScriptEngine::invoke_on_destroy_entity(entity);
+		}
 
-	ScriptEngine::on_runtime_stop();
+		ScriptEngine::on_runtime_stop();
+	}
 
 	physics_system.stop();
+
+	// pointers kept by the scripts must not outlive the run
+	invalidate_storages(ScriptDataComponents{});
+
+	destroy_queue.clear();
+	release_queue.clear();
+	entity_pools.clear();
 }
 
 void Scene::set_paused(bool _paused) { paused = _paused; }
@@ -101,17 +155,92 @@ Entity Scene::create(UID uid, const std::string& name, UID parent_id) {
 	}
 
 	entity_map[uid] = entity;
+	name_index.add(name, entity);
 
 	return entity;
 }
 
 void Scene::destroy(Entity entity) {
-	for (auto child : entity.get_children()) {
-		destroy(child);
+	// descends to the deepest first child every time so that children are
+	// destroyed before their parents without collecting them
+	Entity current = entity;
+	while (true) {
+		for (entt::entity child = current.get_relation().first_child;
+				child != entt::null;
+				child = current.get_relation().first_child) {
+			current = Entity{ child, this };
+		}
+
+		const Entity parent = current.get_parent();
+
+		_destroy_entity(current);
+
+		if (current == entity) {
+			break;
+		}
+
+		current = parent;
 	}
+}
 
+void Scene::destroy(UID uid) {
+	Entity entity = find_by_id(uid);
+	if (!entity) {
+		return;
+	}
+
+	destroy(entity);
+}
+
+void Scene::queue_destroy(Entity entity) {
+	if (!entity) {
+		return;
+	}
+
+	if (!is_running()) {
+		destroy(entity);
+		return;
+	}
+
+	destroy_queue.push_back(entity.get_uid());
+}
+
+void Scene::flush_pending() {
+	if (destroy_queue.empty() && release_queue.empty()) {
+		return;
+	}
+
+	EVE_PROFILE_FUNCTION();
+
+	// destroy callbacks may queue more entities, the queues are indexed
+	// since they can grow while being processed
+	while (!destroy_queue.empty() || !release_queue.empty()) {
+		for (size_t i = 0; i < destroy_queue.size(); i++) {
+			destroy(destroy_queue[i]);
+		}
+
+		destroy_queue.clear();
+
+		for (size_t i = 0; i < release_queue.size(); i++) {
+			Entity root = find_by_id(release_queue[i]);
+			if (root) {
+				_release_instance(root);
+			}
+		}
+
+		release_queue.clear();
+	}
+}
+
+void Scene::_destroy_entity(Entity entity) {
+	// released entities already got their destroy callback
 	if (is_running()) {
-		ScriptEngine::invoke_on_destroy_entity(entity);
+		if (ScriptEngine::is_initialized() &&
+				!entity.has_component<InactiveComponent>()) {
+			ScriptEngine::invoke_on_destroy_entity(entity);
+		}
+
+		script_events::push_entity_destroyed(entity.get_uid());
 
 		physics_system.mark_deleted(entity);
 	}
@@ -121,17 +250,20 @@ void Scene::destroy(Entity entity) {
 		unselect_entity(entity);
 	}
 
+	entity._detach();
+
 	entity_map.erase(entity.get_uid());
+	name_index.remove(entity.get_name(), entity);
 	registry.destroy(entity);
 }
 
-void Scene::destroy(UID uid) {
-	Entity entity = find_by_id(uid);
-	if (!entity) {
-		return;
-	}
+void Scene::sort_by_depth() {
+	EVE_PROFILE_FUNCTION();
 
-	destroy(entity);
+	registry.sort<RelationComponent>(
+			[](const RelationComponent& lhs, const RelationComponent& rhs) {
+				return lhs.depth < rhs.depth;
+			});
 }
 
 bool Scene::exists(Entity entity) const {
@@ -153,18 +285,43 @@ Entity Scene::find_by_id(UID uid) {
 	return {};
 }
 
-Entity Scene::find_by_name(const std::string& name) {
-	const auto view = registry.view<IdComponent>();
-	const auto entity_it =
-			std::find_if(view.begin(), view.end(), [&](const auto& entity) {
-				return get_component<IdComponent>(entity).tag == name;
-			});
+Entity Scene::find_by_handle(entt::entity handle, UID uid) {
+	if (!registry.valid(handle) ||
+			registry.get<IdComponent>(handle).id != uid) {
+		return {};
+	}
 
-	if (entity_it != view.end()) {
-		return { *entity_it, this };
-	} else {
-		return {}; // Return an empty entity if not found
+	return { handle, this };
+}
+
+Entity Scene::find_by_name(std::string_view name) {
+	const entt::entity entity = name_index.find(name);
+	if (entity == entt::null) {
+		return {};
 	}
+
+	return { entity, this };
+}
+
+size_t Scene::find_all_by_name(
+		std::string_view name, std::vector<Entity>& entities) {
+	const std::vector<entt::entity>& found = name_index.find_all(name);
+	for (const entt::entity entity : found) {
+		entities.push_back({ entity, this });
+	}
+
+	return found.size();
+}
+
+size_t Scene::find_all_by_prefix(
+		std::string_view prefix, std::vector<Entity>& entities) {
+	const size_t count = entities.size();
+
+	name_index.each_with_prefix(prefix, [&](entt::entity entity) {
+		entities.push_back({ entity, this });
+	});
+
+	return entities.size() - count;
 }
 
 void Scene::toggle_entity_selection(Entity entity) {
@@ -214,32 +371,43 @@ const std::string& Scene::get_path() { return path; }
 
 AssetRegistry& Scene::get_asset_registry() { return asset_registry; }
 
+PhysicsSystem& Scene::get_physics_system() { return physics_system; }
+
+template <typename T> const uint32_t* Scene::get_storage_generation() {
+	return &s_storage_generation<T>;
+}
+
+template const uint32_t* Scene::get_storage_generation<Transform>();
+template const uint32_t* Scene::get_storage_generation<SpriteRenderer>();
+
 const std::vector<Entity>& Scene::get_selected_entities() const {
 	return selected_entities;
 }
 
+// Copies the whole storage of every component into the registry with the
+// same entity handles, storages are walked in reverse so the packed order of
+// the copy matches the source.
 template <typename... Component>
-inline static void copy_component(entt::registry& dst, entt::registry& src,
-		const std::unordered_map<UID, entt::entity>& entt_map) {
+inline static void copy_storage(entt::registry& dst, entt::registry& src) {
 	(
 			[&]() {
-				for (const entt::entity src_entity : src.view<Component>()) {
-					const entt::entity dst_entity =
-							entt_map.at(src.get<IdComponent>(src_entity).id);
-
-					const auto& src_component = src.get<Component>(src_entity);
-					dst.emplace_or_replace<Component>(
-							dst_entity, src_component);
+				auto& src_storage = src.storage<Component>();
+				if (src_storage.empty()) {
+					return;
 				}
+
+				const entt::sparse_set& src_entities = src_storage;
+				dst.storage<Component>().reserve(src_storage.size());
+				dst.insert<Component>(src_entities.rbegin(),
+						src_entities.rend(), src_storage.rbegin());
 			}(),
 			...);
 }
 
 template <typename... Component>
-inline static void copy_component(ComponentGroup<Component...>,
-		entt::registry& dst, entt::registry& src,
-		const std::unordered_map<UID, entt::entity>& entt_map) {
-	copy_component<Component...>(dst, src, entt_map);
+inline static void copy_storage(ComponentGroup<Component...>,
+		entt::registry& dst, entt::registry& src) {
+	copy_storage<Component...>(dst, src);
 }
 
 template <typename... Component>
@@ -269,41 +437,34 @@ Ref<Scene> Scene::copy(Ref<Scene> src) {
 
 	auto& src_registry = src->registry;
 	auto& dst_registry = dst->registry;
-	std::unordered_map<UID, entt::entity> entt_map;
-
-	// Create entities in new scene
-	for (auto entity_id : src_registry.view<IdComponent>()) {
-		const auto& id_comp = src->get_component<IdComponent>(entity_id);
-
-		const UID& uid = id_comp.id;
-		const auto& name = id_comp.tag;
 
-		Entity new_entity = dst->create(uid, name);
+	// Create entities with the same handles so that the storages can be
+	// copied as is, no need to go through the entity map.
+	const auto id_view = src_registry.view<IdComponent>();
+	for (auto it = id_view.rbegin(); it != id_view.rend(); it++) {
+		const entt::entity entity_id = dst_registry.create(*it);
+		EVE_ASSERT(entity_id == *it);
+	}
 
-		// set parent id but do not set children vectors
-		const auto& relation = src->get_component<RelationComponent>(entity_id);
-		new_entity.get_relation().parent_id = relation.parent_id;
+	copy_storage<IdComponent, RelationComponent>(dst_registry, src_registry);
+	copy_storage(AllComponents{}, dst_registry, src_registry);
 
-		entt_map[uid] = (entt::entity)new_entity;
+	dst->entity_map = src->entity_map;
+	dst->name_index = src->name_index;
+	for (auto& [uid, entity] : dst->entity_map) {
+		entity = Entity{ (entt::entity)entity, dst.get() };
 	}
 
-	copy_component(AllComponents{}, dst_registry, src_registry, entt_map);
-
-	const auto has_parent = [](const auto& pair) -> bool {
-		const auto& relation = pair.second.get_relation();
-		return (bool)relation.parent_id;
-	};
+	// parent pointers still point to the transforms of the source scene,
+	// handles are the same so they only need to be relinked
+	dst_registry.view<RelationComponent, Transform>().each(
+			[&](const RelationComponent& relation, Transform& transform) {
+				transform.parent = relation.parent != entt::null
+						? &dst_registry.get<Transform>(relation.parent)
+						: nullptr;
+			});
 
-	// set child/parent relations
-	for (auto& [uid, entity] :
-			dst->entity_map | std::views::filter(has_parent)) {
-		// Set parent entity
-		auto& relation = entity.get_relation();
-		auto parent_entity = dst->find_by_id(relation.parent_id);
-		if (parent_entity) {
-			entity.set_parent(parent_entity);
-		}
-	}
+	dst->physics_system.get_settings() = src->physics_system.get_settings();
 
 	// copy asset registry
 	//? TODO maybe moving is better?
@@ -326,12 +487,22 @@ Ref<Scene> Scene::copy(Ref<Scene> src) {
 		break;                                                                 \
 	}
 
-NLOHMANN_JSON_SERIALIZE_ENUM(Rigidbody2D::BodyType,
-		{
-				{ Rigidbody2D::BodyType::STATIC, "static" },
-				{ Rigidbody2D::BodyType::DYNAMIC, "dynamic" },
-				{ Rigidbody2D::BodyType::KINEMATIC, "kinematic" },
-		})
+template <typename... Component>
+inline static void serialize_components(
+		ComponentGroup<Component...>, Entity& entity, Json& out) {
+	(
+			[&]() {
+				if (!entity.has_component<Component>()) {
+					return;
+				}
+
+				Json component_json = Json::object();
+				reflection::write_json(
+						component_json, entity.get_component<Component>());
+				out[Reflection<Component>::NAME] = std::move(component_json);
+			}(),
+			...);
+}
 
 static Json serialize_entity(Ref<Scene>& scene, Entity& entity) {
 	bool has_required_components =
@@ -344,137 +515,20 @@ static Json serialize_entity(Ref<Scene>& scene, Entity& entity) {
 	out["tag"] = entity.get_name();
 	out["parent_id"] = entity.get_relation().parent_id;
 
-	const Transform& transform = entity.get_transform();
-	out["transform_component"] = Json{
-		{ "local_position", transform.local_position },
-		{ "local_rotation", transform.local_rotation },
-		{ "local_scale", transform.local_scale },
-	};
-
-	if (entity.has_component<CameraComponent>()) {
-		const CameraComponent& cc = entity.get_component<CameraComponent>();
-
-		out["camera_component"] = Json{
-			{
-					"camera",
-					{
-							{ "aspect_ratio", cc.camera.aspect_ratio },
-							{ "zoom_level", cc.camera.zoom_level },
-							{ "near_clip", cc.camera.near_clip },
-							{ "far_clip", cc.camera.far_clip },
-					},
-			},
-			{ "is_primary", cc.is_primary },
-			{ "is_fixed_aspect_ratio", cc.is_fixed_aspect_ratio },
-		};
-	}
-
-	if (entity.has_component<SpriteRenderer>()) {
-		const SpriteRenderer& sc = entity.get_component<SpriteRenderer>();
-
-		out["sprite_renderer_component"] = Json{
-			{ "texture", sc.texture },
-			{ "color", sc.color },
-			{ "tex_tiling", sc.tex_tiling },
-			{ "is_atlas", sc.is_atlas },
-			{ "block_size", sc.block_size },
-			{ "index", sc.index },
-		};
-	}
-
-	if (entity.has_component<TextRenderer>()) {
-		const TextRenderer& tc = entity.get_component<TextRenderer>();
-
-		out["text_renderer_component"] = Json{
-			{ "text", tc.text },
-			{ "font", tc.font },
-			{ "fg_color", tc.fg_color },
-			{ "bg_color", tc.bg_color },
-			{ "kerning", tc.kerning },
-			{ "line_spacing", tc.line_spacing },
-			{ "is_screen_space", tc.is_screen_space },
-		};
-	}
-
-	if (entity.has_component<Rigidbody2D>()) {
-		auto& rb2d = entity.get_component<Rigidbody2D>();
-
-		out["rigidbody2d_component"] = Json{
-			{ "type", rb2d.type },
-			{ "fixed_rotation", rb2d.fixed_rotation },
-		};
-	}
-
-	if (entity.has_component<BoxCollider2D>()) {
-		auto& box_collider = entity.get_component<BoxCollider2D>();
-
-		out["box_collider"] = Json{
-			{ "offset", box_collider.offset },
-			{ "size", box_collider.size },
-			{ "is_trigger", box_collider.is_trigger },
-			{ "density", box_collider.density },
-			{ "friction", box_collider.friction },
-			{ "restitution", box_collider.restitution },
-			{ "restitution_threshold", box_collider.restitution_threshold },
-		};
-	}
-
-	if (entity.has_component<CircleCollider2D>()) {
-		auto& circle_collider = entity.get_component<CircleCollider2D>();
-
-		out["circle_collider"] = Json{
-			{ "offset", circle_collider.offset },
-			{ "radius", circle_collider.radius },
-			{ "is_trigger", circle_collider.is_trigger },
-			{ "density", circle_collider.density },
-			{ "friction", circle_collider.friction },
-			{ "restitution", circle_collider.restitution },
-			{ "restitution_threshold", circle_collider.restitution_threshold },
-		};
-	}
-
-	if (entity.has_component<PostProcessVolume>()) {
-		const PostProcessVolume& volume =
-				entity.get_component<PostProcessVolume>();
-
-		out["post_process_volume"] = Json{ { "is_global", volume.is_global },
-			{ "gray_scale", Json{ { "enabled", volume.gray_scale.enabled } } },
-			{ "chromatic_aberration",
-					Json{
-							{ "enabled", volume.chromatic_aberration.enabled },
-							{ "offset", volume.chromatic_aberration.offset },
-					} },
-			{ "blur",
-					Json{
-							{ "enabled", volume.blur.enabled },
-							{ "size", volume.blur.size },
-							{ "seperation", volume.blur.seperation },
-					} },
-			{ "sharpen",
-					Json{
-							{ "enabled", volume.sharpen.enabled },
-							{ "amount", volume.sharpen.amount },
-					} },
-			{ "vignette",
-					Json{
-							{ "enabled", volume.vignette.enabled },
-							{ "inner", volume.vignette.inner },
-							{ "outer", volume.vignette.outer },
-							{ "strength", volume.vignette.strength },
-							{ "curvature", volume.vignette.curvature },
-					} } };
-	}
+	serialize_components(AllComponents{}, entity, out);
 
 	if (entity.has_component<ScriptComponent>()) {
 		auto& sc = entity.get_component<ScriptComponent>();
 
-		Json script_component_json = { { "class_name", sc.class_name },
-			{ "script_fields", Json::array() } };
+		Json& script_component_json = out[Reflection<ScriptComponent>::NAME];
+		script_component_json["script_fields"] = Json::array();
 
-		Ref<ScriptClass> entity_class =
-				ScriptEngine::get_entity_class(sc.class_name);
-		const auto& fields = entity_class->get_fields();
-		if (!fields.empty()) {
+		// field values only exist while the script runtime is alive
+		Ref<ScriptClass> entity_class = ScriptEngine::is_initialized()
+				? ScriptEngine::get_entity_class(sc.class_name)
+				: nullptr;
+		if (entity_class && !entity_class->get_fields().empty()) {
+			const auto& fields = entity_class->get_fields();
 			for (const auto& [name, field] : fields) {
 				auto& entity_fields =
 						ScriptEngine::get_script_field_map(entity);
@@ -515,8 +569,6 @@ static Json serialize_entity(Ref<Scene>& scene, Entity& entity) {
 				}
 			}
 		}
-
-		out["script_component"] = script_component_json;
 	}
 
 	return out;
@@ -559,302 +611,248 @@ void Scene::serialize(Ref<Scene> scene, std::string path) {
 			path);
 }
 
+static void deserialize_script_fields(
+		Entity entity, const Json& script_fields_json) {
+	if (!ScriptEngine::is_initialized()) {
+		return;
+	}
+
+	const auto& sc = entity.get_component<ScriptComponent>();
+
+	Ref<ScriptClass> entity_class =
+			ScriptEngine::get_entity_class(sc.class_name);
+	if (!entity_class) {
+		return;
+	}
+
+	const auto& fields = entity_class->get_fields();
+	auto& entity_fields = ScriptEngine::get_script_field_map(entity);
+
+	for (const auto& script_field_json : script_fields_json) {
+		std::string name = script_field_json["name"].get<std::string>();
+		std::string type_string = script_field_json["type"].get<std::string>();
+		ScriptFieldType type = deserialize_script_field_type(type_string);
+
+		ScriptFieldInstance& field_instance = entity_fields[name];
+
+		if (fields.find(name) == fields.end()) {
+			continue;
+		}
+
+		field_instance.field = fields.at(name);
+		field_instance.class_id = entity_class->get_id();
+
+		switch (type) {
+			READ_SCRIPT_FIELD(FLOAT, float);
+			READ_SCRIPT_FIELD(DOUBLE, double);
+			READ_SCRIPT_FIELD(BOOL, bool);
+			READ_SCRIPT_FIELD(CHAR, char);
+			READ_SCRIPT_FIELD(BYTE, int8_t);
+			READ_SCRIPT_FIELD(SHORT, int16_t);
+			READ_SCRIPT_FIELD(INT, int32_t);
+			READ_SCRIPT_FIELD(LONG, int64_t);
+			READ_SCRIPT_FIELD(UBYTE, uint8_t);
+			READ_SCRIPT_FIELD(USHORT, uint16_t);
+			READ_SCRIPT_FIELD(UINT, uint32_t);
+			READ_SCRIPT_FIELD(ULONG, uint64_t);
+			READ_SCRIPT_FIELD(VECTOR2, glm::vec2);
+			READ_SCRIPT_FIELD(VECTOR3, glm::vec3);
+			READ_SCRIPT_FIELD(VECTOR4, glm::vec4);
+			READ_SCRIPT_FIELD(COLOR, Color);
+			READ_SCRIPT_FIELD(ENTITY, UID);
+			default:
+				break;
+		}
+	}
+}
+
 bool Scene::deserialize(Ref<Scene>& scene, std::string path) {
-	EVE_LOG_VERBOSE_TRACE(
-			"Deserializing scene \"{}\" to path \"{}\".", scene->name, path);
+	Ref<SceneLoadData> data = prepare_load(path);
+	if (!data) {
+		return false;
+	}
 
-	path = Project::get_asset_path(path).string();
+	return commit_load(scene, *data);
+}
+
+Ref<SceneLoadData> Scene::prepare_load(
+		std::string path, std::atomic<float>* progress) {
+	EVE_PROFILE_FUNCTION();
+
+	EVE_LOG_VERBOSE_TRACE("Preparing scene from path \"{}\".", path);
+
+	Ref<SceneLoadData> data = create_ref<SceneLoadData>();
+	data->path = Project::get_asset_path(path).string();
+	data->is_binary = fs::path(path).extension() == SCENE_BINARY_EXTENSION;
+	data->progress = progress;
+
+	const bool result =
+			data->is_binary ? _prepare_binary(*data) : _prepare_json(*data);
+	if (!result) {
+		return nullptr;
+	}
+
+	return data;
+}
+
+void Scene::wait_for_assets(SceneLoadData& data) {
+	EVE_PROFILE_FUNCTION();
+
+	if (data.asset_loads.empty()) {
+		data.add_progress(LOAD_PROGRESS_ASSETS);
+		return;
+	}
+
+	for (auto& load : data.asset_loads) {
+		load.wait();
+		data.add_progress(LOAD_PROGRESS_ASSETS / data.asset_loads.size());
+	}
+}
+
+bool Scene::commit_load(Ref<Scene>& scene, SceneLoadData& data) {
+	EVE_PROFILE_FUNCTION();
 
 	if (!scene->entity_map.empty()) {
 		EVE_LOG_WARNING("Given scene to deserialize is not "
 						"empty.\nClearing the data...");
 		scene->entity_map.clear();
+		scene->name_index.clear();
 		scene->registry.clear();
 	}
 
-	Json data;
-	if (!json_utils::read_file(path, data)) {
-		EVE_LOG_ERROR("Failed to load scene file at '{}'", path);
+	scene->handle = data.handle;
+	scene->name = data.name;
+	scene->path = Project::get_relative_asset_path(data.path);
+
+	const bool result = data.is_binary ? _commit_binary(scene, data)
+									   : _commit_json(scene, data);
+	if (!result) {
 		return false;
 	}
 
-	scene->handle = data["uid"].get<AssetHandle>();
-	scene->name = data["name"].get<std::string>();
-	scene->path = Project::get_relative_asset_path(path);
+	scene->asset_registry.finish_asset_loads(data.asset_loads);
+
+	EVE_LOG_VERBOSE_TRACE(
+			"Scene \"{}\" successfully deserialized from path \"{}\".",
+			scene->name, data.path);
 
-	if (!data.contains("entities") || !data.contains("assets")) {
+	return true;
+}
+
+bool Scene::_prepare_json(SceneLoadData& data) {
+	EVE_PROFILE_FUNCTION();
+
+	if (!json_utils::read_file(data.path, data.document)) {
+		EVE_LOG_ERROR("Failed to load scene file at '{}'", data.path);
 		return false;
 	}
 
-	auto& asset_registry = scene->get_asset_registry();
-
-	Json assets_json = data["assets"];
-	for (const auto& asset_json : assets_json) {
-		asset_registry.load_asset(asset_json["path"].get<std::string>(),
-				asset_json["type"].get<AssetType>(),
-				asset_json["handle"].get<UID>());
+	const Json& document = data.document;
+	if (!document.contains("uid") || !document.contains("name") ||
+			!document.contains("entities") || !document.contains("assets")) {
+		EVE_LOG_ERROR("Unable to read scene file at '{}'.", data.path);
+		return false;
 	}
 
-	Json entities_json = data["entities"];
+	data.handle = document["uid"].get<AssetHandle>();
+	data.name = document["name"].get<std::string>();
 
-	// Create entities before adding components in order to build parent/child
-	// relations.
-	std::vector<Entity> entities;
-	for (const auto& entity_json : entities_json) {
-		UID uid = entity_json["id"].get<UID>();
-		std::string name = entity_json["tag"].get<std::string>();
-		entities.push_back(scene->create(uid, name));
+	data.add_progress(LOAD_PROGRESS_READ);
+
+	// decode the assets while the entities are being parsed
+	std::vector<AssetLoadRequest> asset_requests;
+	for (const auto& asset_json : document["assets"]) {
+		asset_requests.push_back({
+				asset_json["path"].get<std::string>(),
+				asset_json["type"].get<AssetType>(),
+				asset_json["handle"].get<UID>(),
+		});
 	}
 
-	for (uint32_t i = 0; i < entities.size(); i++) {
-		auto& entity_json = entities_json.at(i);
-		auto& deserialing_entity = entities.at(i);
+	data.asset_loads = asset_loader::prepare_assets_async(asset_requests);
 
-		// Set parent entity
-		UID parent_id = entity_json["parent_id"].get<UID>();
-		if (parent_id) {
-			auto parent_entity = scene->find_by_id(parent_id);
-			if (parent_entity) {
-				deserialing_entity.set_parent(parent_entity);
-			}
-		}
+	const Json& entities_json = document["entities"];
+	const uint32_t entity_count = entities_json.size();
 
-		if (const auto& transform_json = entity_json["transform_component"];
-				!transform_json.is_null()) {
-			auto& tc = deserialing_entity.get_component<Transform>();
+	const uint32_t chunk_count = std::clamp<uint32_t>(
+			entity_count / ENTITIES_PER_CHUNK, 1,
+			std::max(std::thread::hardware_concurrency(), 1u));
+	const uint32_t chunk_size = (entity_count + chunk_count - 1) / chunk_count;
 
-			tc.local_position =
-					transform_json["local_position"].get<glm::vec3>();
-			tc.local_rotation =
-					transform_json["local_rotation"].get<glm::vec3>();
-			tc.local_scale = transform_json["local_scale"].get<glm::vec3>();
-		}
+	data.chunks.resize(chunk_count);
 
-		if (const auto& camera_comp_json = entity_json["camera_component"];
-				!camera_comp_json.is_null()) {
-			auto& camera_component =
-					deserialing_entity.add_component<CameraComponent>();
-
-			{
-				const auto& camera_json = camera_comp_json["camera"];
-				camera_component.camera.aspect_ratio =
-						camera_json["aspect_ratio"].get<float>();
-				camera_component.camera.zoom_level =
-						camera_json["zoom_level"].get<float>();
-				camera_component.camera.near_clip =
-						camera_json["near_clip"].get<float>();
-				camera_component.camera.far_clip =
-						camera_json["far_clip"].get<float>();
-			}
+	const auto stage_chunk = [&](uint32_t chunk_index) {
+		SceneChunk& chunk = data.chunks[chunk_index];
 
-			camera_component.is_primary =
-					camera_comp_json["is_primary"].get<bool>();
-			camera_component.is_fixed_aspect_ratio =
-					camera_comp_json["is_fixed_aspect_ratio"].get<bool>();
-		}
+		const uint32_t first = chunk_index * chunk_size;
+		const uint32_t last = std::min(first + chunk_size, entity_count);
 
-		if (const auto& sprite_comp_json =
-						entity_json["sprite_renderer_component"];
-				!sprite_comp_json.is_null()) {
-			auto& sprite_component =
-					deserialing_entity.add_component<SpriteRenderer>();
-
-			sprite_component.texture = sprite_comp_json["texture"].get<UID>();
-			sprite_component.color = sprite_comp_json["color"].get<Color>();
-			sprite_component.tex_tiling =
-					sprite_comp_json["tex_tiling"].get<glm::vec2>();
-			sprite_component.is_atlas =
-					sprite_comp_json["is_atlas"].get<bool>();
-			sprite_component.block_size =
-					sprite_comp_json["block_size"].get<glm::vec2>();
-			sprite_component.index = sprite_comp_json["index"].get<uint32_t>();
+		chunk.entities.reserve(last - first);
+		for (uint32_t i = first; i < last; i++) {
+			chunk.stage(i, entities_json[i]);
 		}
 
-		if (const auto& text_comp_json = entity_json["text_renderer_component"];
-				!text_comp_json.is_null()) {
-			auto& text_component =
-					deserialing_entity.add_component<TextRenderer>();
-
-			text_component.text = text_comp_json["text"].get<std::string>();
-
-			text_component.font = text_comp_json["font"].get<UID>();
-			text_component.fg_color = text_comp_json["fg_color"].get<Color>();
-			text_component.bg_color = text_comp_json["bg_color"].get<Color>();
-			text_component.kerning = text_comp_json["kerning"].get<float>();
-			text_component.line_spacing =
-					text_comp_json["line_spacing"].get<float>();
-			text_component.is_screen_space =
-					text_comp_json["is_screen_space"].get<bool>();
-		}
+		data.add_progress(LOAD_PROGRESS_PARSE / chunk_count);
+	};
 
-		if (const auto& rb2d_json = entity_json["rigidbody2d_component"];
-				!rb2d_json.is_null()) {
-			auto& rb2d = deserialing_entity.add_component<Rigidbody2D>();
+	std::vector<std::future<void>> workers;
+	for (uint32_t i = 1; i < chunk_count; i++) {
+		workers.push_back(std::async(std::launch::async, stage_chunk, i));
+	}
 
-			rb2d.type = rb2d_json["type"].get<Rigidbody2D::BodyType>();
-			rb2d.fixed_rotation = rb2d_json["fixed_rotation"].get<bool>();
-		}
+	stage_chunk(0);
 
-		if (const auto& box_collider_json = entity_json["box_collider"];
-				!box_collider_json.is_null()) {
-			auto& box_collider =
-					deserialing_entity.add_component<BoxCollider2D>();
+	for (auto& worker : workers) {
+		worker.get();
+	}
 
-			box_collider.offset = box_collider_json["offset"].get<glm::vec2>();
-			box_collider.size = box_collider_json["size"].get<glm::vec2>();
+	return true;
+}
 
-			box_collider.is_trigger =
-					box_collider_json["is_trigger"].get<bool>();
+bool Scene::_commit_json(Ref<Scene>& scene, SceneLoadData& data) {
+	EVE_PROFILE_FUNCTION();
 
-			box_collider.density = box_collider_json["density"].get<float>();
-			box_collider.friction = box_collider_json["friction"].get<float>();
-			box_collider.restitution =
-					box_collider_json["restitution"].get<float>();
-			box_collider.restitution_threshold =
-					box_collider_json["restitution_threshold"].get<float>();
-		}
+	uint32_t entity_count = 0;
+	for (const SceneChunk& chunk : data.chunks) {
+		entity_count += chunk.entities.size();
+	}
+
+	// Create entities before adding components in order to build parent/child
+	// relations.
+	std::vector<Entity> entities;
+	entities.reserve(entity_count);
+	scene->entity_map.reserve(entity_count);
 
-		if (const auto& circle_collider_json = entity_json["circle_collider"];
-				!circle_collider_json.is_null()) {
-			auto& circle_collider =
-					deserialing_entity.add_component<CircleCollider2D>();
-
-			circle_collider.offset =
-					circle_collider_json["offset"].get<glm::vec2>();
-			circle_collider.radius =
-					circle_collider_json["radius"].get<float>();
-
-			circle_collider.is_trigger =
-					circle_collider_json["is_trigger"].get<bool>();
-
-			circle_collider.density =
-					circle_collider_json["density"].get<float>();
-			circle_collider.friction =
-					circle_collider_json["friction"].get<float>();
-			circle_collider.restitution =
-					circle_collider_json["restitution"].get<float>();
-			circle_collider.restitution_threshold =
-					circle_collider_json["restitution_threshold"].get<float>();
+	for (const SceneChunk& chunk : data.chunks) {
+		for (const StagedEntity& staged_entity : chunk.entities) {
+			entities.push_back(
+					scene->create(staged_entity.id, staged_entity.tag));
 		}
+	}
 
-		if (const auto& post_process_json = entity_json["post_process_volume"];
-				!post_process_json.is_null()) {
-			auto& post_process_volume =
-					deserialing_entity.add_component<PostProcessVolume>();
-
-			post_process_volume.is_global =
-					post_process_json["is_global"].get<bool>();
-			{
-				const auto& gray_scale_json = post_process_json["gray_scale"];
-				post_process_volume.gray_scale.enabled =
-						gray_scale_json["enabled"].get<bool>();
-			}
-			{
-				const auto& chromatic_aberration_json =
-						post_process_json["chromatic_aberration"];
-
-				post_process_volume.chromatic_aberration.enabled =
-						chromatic_aberration_json["enabled"].get<bool>();
-				post_process_volume.chromatic_aberration.offset =
-						chromatic_aberration_json["offset"].get<glm::vec3>();
-			}
-			{
-				const auto& blur_json = post_process_json["blur"];
-
-				post_process_volume.blur.enabled =
-						blur_json["enabled"].get<bool>();
-				post_process_volume.blur.size =
-						blur_json["size"].get<uint32_t>();
-				post_process_volume.blur.seperation =
-						blur_json["seperation"].get<float>();
-			}
-			{
-				const auto& sharpen_json = post_process_json["sharpen"];
+	uint32_t entity_index = 0;
+	for (const SceneChunk& chunk : data.chunks) {
+		for (const StagedEntity& staged_entity : chunk.entities) {
+			Entity& entity = entities[entity_index++];
 
-				post_process_volume.sharpen.enabled =
-						sharpen_json["enabled"].get<bool>();
-				post_process_volume.sharpen.amount =
-						sharpen_json["amount"].get<float>();
+			if (!staged_entity.parent_id) {
+				continue;
 			}
-			{
-				const auto& vignette_json = post_process_json["vignette"];
-
-				post_process_volume.vignette.enabled =
-						vignette_json["enabled"].get<bool>();
-				post_process_volume.vignette.inner =
-						vignette_json["inner"].get<float>();
-				post_process_volume.vignette.outer =
-						vignette_json["outer"].get<float>();
-				post_process_volume.vignette.strength =
-						vignette_json["strength"].get<float>();
-				post_process_volume.vignette.curvature =
-						vignette_json["curvature"].get<float>();
-			}
-		}
 
-		if (auto script_component_json = entity_json["script_component"];
-				!script_component_json.is_null()) {
-			auto& sc = deserialing_entity.add_component<ScriptComponent>();
-
-			sc.class_name =
-					script_component_json["class_name"].get<std::string>();
-
-			auto script_fields_json = script_component_json["script_fields"];
-			if (!script_fields_json.is_null()) {
-				Ref<ScriptClass> entity_class =
-						ScriptEngine::get_entity_class(sc.class_name);
-				if (entity_class) {
-					const auto& fields = entity_class->get_fields();
-					auto& entity_fields = ScriptEngine::get_script_field_map(
-							deserialing_entity);
-
-					for (const auto& script_field_json : script_fields_json) {
-						std::string name =
-								script_field_json["name"].get<std::string>();
-						std::string type_string =
-								script_field_json["type"].get<std::string>();
-						ScriptFieldType type =
-								deserialize_script_field_type(type_string);
-
-						ScriptFieldInstance& field_instance =
-								entity_fields[name];
-
-						if (fields.find(name) == fields.end()) {
-							continue;
-						}
-
-						field_instance.field = fields.at(name);
-
-						switch (type) {
-							READ_SCRIPT_FIELD(FLOAT, float);
-							READ_SCRIPT_FIELD(DOUBLE, double);
-							READ_SCRIPT_FIELD(BOOL, bool);
-							READ_SCRIPT_FIELD(CHAR, char);
-							READ_SCRIPT_FIELD(BYTE, int8_t);
-							READ_SCRIPT_FIELD(SHORT, int16_t);
-							READ_SCRIPT_FIELD(INT, int32_t);
-							READ_SCRIPT_FIELD(LONG, int64_t);
-							READ_SCRIPT_FIELD(UBYTE, uint8_t);
-							READ_SCRIPT_FIELD(USHORT, uint16_t);
-							READ_SCRIPT_FIELD(UINT, uint32_t);
-							READ_SCRIPT_FIELD(ULONG, uint64_t);
-							READ_SCRIPT_FIELD(VECTOR2, glm::vec2);
-							READ_SCRIPT_FIELD(VECTOR3, glm::vec3);
-							READ_SCRIPT_FIELD(VECTOR4, glm::vec4);
-							READ_SCRIPT_FIELD(COLOR, Color);
-							READ_SCRIPT_FIELD(ENTITY, UID);
-							default:
-								break;
-						}
-					}
-				}
+			auto parent_entity = scene->find_by_id(staged_entity.parent_id);
+			if (parent_entity) {
+				entity.set_parent(parent_entity);
 			}
 		}
 	}
 
-	EVE_LOG_VERBOSE_TRACE(
-			"Scene \"{}\" successfully deserialized to path \"{}\".",
-			scene->name, path);
+	for (SceneChunk& chunk : data.chunks) {
+		chunk.commit(scene->registry, entities);
+
+		for (const auto& [index, script_fields_json] : chunk.script_fields) {
+			deserialize_script_fields(entities[index], *script_fields_json);
+		}
+	}
 
 	return true;
 }
@@ -3,10 +3,16 @@
 
 #include "asset/asset_registry.h"
 #include "physics/physics_system.h"
+#include "scene/name_index.h"
 
 #include <entt/entt.hpp>
 
 class Entity;
+class Prefab;
+struct SceneLoadData;
+
+inline constexpr const char* SCENE_EXTENSION = ".escn";
+inline constexpr const char* SCENE_BINARY_EXTENSION = ".escb";
 
 class Scene {
 public:
@@ -36,6 +42,44 @@ public:
 	void destroy(Entity entity);
 	void destroy(UID uid);
 
+	// destroys the entity at the end of the update while the scene is
+	// running so that the scripts and physics callbacks of the frame can
+	// still access it, destroys it immediately otherwise
+	void queue_destroy(Entity entity);
+
+	// processes the queued destructions and releases, called by update
+	// after the physics step
+	void flush_pending();
+
+	// creates the entities of the prefab with new ids, scripts are started
+	// if the scene is running. returns the root of the instance.
+	Entity instantiate(const Prefab& prefab, UID parent_id = INVALID_UID,
+			const glm::vec3* position = nullptr);
+
+	// creates count instances at once and appends their roots, positions
+	// has to hold a local position for every root if given
+	void instantiate(const Prefab& prefab, uint32_t count,
+			std::vector<Entity>& roots, UID parent_id = INVALID_UID,
+			const glm::vec3* positions = nullptr);
+
+	// Opt-in pooling, same as instantiate but released instances are kept
+	// deactivated with their physics bodies and script instances and spawn
+	// reuses them before creating new ones. reused instances get the
+	// components and field values of the prefab back.
+	Entity spawn(const Prefab& prefab, UID parent_id = INVALID_UID,
+			const glm::vec3* position = nullptr);
+
+	// returns the instance to its pool at the end of the update, entities
+	// that were not spawned from a pool are destroyed instead
+	void release(Entity root);
+
+	// destroys the pooled instances that are not in use
+	void clear_pools();
+
+	// sorts the relations so that views of RelationComponent visit the
+	// parents before their children
+	void sort_by_depth();
+
 	// will check if entity valid or not
 	bool exists(Entity entity) const;
 
@@ -43,13 +87,33 @@ public:
 	bool exists(UID uid) const;
 
 	Entity find_by_id(UID uid);
-	Entity find_by_name(const std::string& name);
+
+	// O(1) lookup through a handle cached by the caller, the id makes sure
+	// the handle was not reused by another entity or scene
+	Entity find_by_handle(entt::entity handle, UID uid);
+
+	// first entity created with the name
+	Entity find_by_name(std::string_view name);
+
+	// appends every entity with the name, returns the number of entities
+	// found so that the vector can be reused between queries
+	size_t find_all_by_name(
+			std::string_view name, std::vector<Entity>& entities);
+
+	// same as find_all_by_name for the names starting with prefix
+	size_t find_all_by_prefix(
+			std::string_view prefix, std::vector<Entity>& entities);
 
 	template <typename... Components>
 	auto view() {
 		return registry.view<Components...>();
 	}
 
+	template <typename... Components, typename... Exclude>
+	auto view(entt::exclude_t<Exclude...> exclude) {
+		return registry.view<Components...>(exclude);
+	}
+
 	template <typename T, typename... Args>
 	auto& add_component(entt::entity handle, Args&&... args) {
 		EVE_ASSERT(!has_component<T>(handle), "Entity already has that component!");
@@ -110,6 +174,13 @@ public:
 
 	AssetRegistry& get_asset_registry();
 
+	PhysicsSystem& get_physics_system();
+
+	// changes whenever the storage of T, one of ScriptDataComponents, may
+	// have moved, so that pointers handed to the scripts can be checked.
+	// shared by every scene so that its address stays valid.
+	template <typename T> static const uint32_t* get_storage_generation();
+
 	const std::vector<Entity>& get_selected_entities() const;
 
 	// DISCLAIMER
@@ -119,8 +190,46 @@ public:
 
 	static void serialize(Ref<Scene> scene, std::string path);
 
+	// dispatches to deserialize_binary for cooked scenes
 	static bool deserialize(Ref<Scene>& scene, std::string path);
 
+	// compact cooked format used by the runtime, the editor keeps working
+	// with the json files
+	static void serialize_binary(Ref<Scene> scene, std::string path);
+
+	static bool deserialize_binary(Ref<Scene>& scene, std::string path);
+
+	// Loading split in two so that scenes can be loaded in the background.
+	// prepare_load reads the file, parses the entities and starts decoding the
+	// assets without touching any scene so it can be called from any thread,
+	// returns null on failure. commit_load fills the scene on the main thread.
+	static Ref<SceneLoadData> prepare_load(
+			std::string path, std::atomic<float>* progress = nullptr);
+
+	// blocks until the assets of the load are decoded so that commit_load
+	// only has to upload them
+	static void wait_for_assets(SceneLoadData& data);
+
+	static bool commit_load(Ref<Scene>& scene, SceneLoadData& data);
+
+private:
+	// destroys a single entity, children must be destroyed before
+	void _destroy_entity(Entity entity);
+
+	// deactivates the instance and adds it to its pool
+	void _release_instance(Entity root);
+
+	// resets the pooled instance to the prefab, returns false if its
+	// hierarchy no longer matches the prefab
+	bool _reuse_instance(const Prefab& prefab, Entity root, UID parent_id,
+			const glm::vec3* position);
+
+	static bool _prepare_json(SceneLoadData& data);
+	static bool _commit_json(Ref<Scene>& scene, SceneLoadData& data);
+
+	static bool _prepare_binary(SceneLoadData& data);
+	static bool _commit_binary(Ref<Scene>& scene, SceneLoadData& data);
+
 private:
 	AssetHandle handle;
 	std::string name;
@@ -134,11 +243,20 @@ private:
 
 	entt::registry registry;
 	std::unordered_map<UID, Entity> entity_map;
+	NameIndex name_index;
+
+	// ids so that entities destroyed in between are skipped
+	std::vector<UID> destroy_queue;
+	std::vector<UID> release_queue;
+
+	// released instance roots of every pooled prefab
+	std::unordered_map<AssetHandle, std::vector<Entity>> entity_pools;
 
 	AssetRegistry asset_registry;
 
 	std::vector<Entity> selected_entities;
 
+	friend class Entity;
 	friend class EditorApplication;
 	friend class HierarchyPanel;
 };
@@ -0,0 +1,506 @@
+#include "scene/scene.h"
+
+#include "core/binary_utils.h"
+#include "project/project.h"
+#include "scene/component_binary.h"
+#include "scene/scene_load_data.h"
+
+// Cooked scene layout, every section follows the previous one:
+//
+//  SceneBinaryHeader
+//  string table  length prefixed strings, referenced by index
+//  asset table   AssetEntry[asset_count]
+//  entity table  EntityEntry[entity_count], parents come before children
+//  columns       ColumnHeader followed by (entity index, component) pairs
+//
+// Unknown columns are skipped so older runtimes can load newer files as long
+// as the version stays the same.
+
+// "ESCB" in little endian
+inline constexpr uint32_t SCENE_BINARY_MAGIC = 0x42435345;
+inline constexpr uint32_t SCENE_BINARY_VERSION = 1;
+
+inline constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+struct SceneBinaryHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t uid;
+	uint32_t name;
+	uint32_t string_count;
+	uint64_t string_table_size;
+	uint32_t asset_count;
+	uint32_t entity_count;
+	uint32_t column_count;
+	uint32_t reserved;
+};
+
+struct AssetEntry {
+	uint64_t handle;
+	uint32_t path;
+	uint32_t type;
+};
+
+struct EntityEntry {
+	uint64_t uid;
+	uint32_t name;
+	uint32_t parent;
+};
+
+struct ColumnHeader {
+	uint32_t id;
+	uint32_t count;
+	uint64_t size;
+};
+
+class StringTable {
+public:
+	uint32_t add(const std::string& string) {
+		const auto it = indices.find(string);
+		if (it != indices.end()) {
+			return it->second;
+		}
+
+		const uint32_t index = strings.size();
+		indices[string] = index;
+		strings.push_back(string);
+
+		return index;
+	}
+
+	uint32_t get_count() const { return strings.size(); }
+
+	void write_string(BinaryWriter& writer, const std::string& string) {
+		writer.write(add(string));
+	}
+
+	void write_table(BinaryWriter& writer) const {
+		for (const auto& string : strings) {
+			writer.write_string(string);
+		}
+	}
+
+private:
+	std::vector<std::string> strings;
+	std::unordered_map<std::string, uint32_t> indices;
+};
+
+using StringList = std::vector<std::string_view>;
+
+inline static bool get_string(
+		const StringList& strings, uint32_t index, std::string& out) {
+	if (index >= strings.size()) {
+		return false;
+	}
+
+	out = strings[index];
+	return true;
+}
+
+// resolves the string indices of the columns
+struct StringTableView {
+	const StringList& strings;
+
+	bool read_string(BinaryReader& reader, std::string& string) const {
+		uint32_t index = 0;
+		return reader.read(index) && get_string(strings, index, string);
+	}
+};
+
+// returns the number of written components
+template <typename T>
+inline static uint32_t write_column(BinaryWriter& writer, StringTable& strings,
+		const std::vector<Entity>& entities) {
+	const size_t header_offset = writer.get_size();
+	writer.write(ColumnHeader{});
+
+	uint32_t count = 0;
+	for (uint32_t i = 0; i < entities.size(); i++) {
+		Entity entity = entities[i];
+		if (!entity.has_component<T>()) {
+			continue;
+		}
+
+		writer.write(i);
+		component_binary::write_component(
+				writer, strings, entity, entity.get_component<T>());
+
+		count++;
+	}
+
+	const ColumnHeader header = {
+		(uint32_t)ComponentColumn<T>::ID,
+		count,
+		writer.get_size() - header_offset - sizeof(ColumnHeader),
+	};
+	writer.write_at(header_offset, header);
+
+	return count;
+}
+
+template <typename... Component>
+inline static uint32_t write_columns(ComponentGroup<Component...>,
+		BinaryWriter& writer, StringTable& strings,
+		const std::vector<Entity>& entities) {
+	uint32_t column_count = 0;
+
+	(
+			[&]() {
+				const size_t column_offset = writer.get_size();
+
+				if (write_column<Component>(writer, strings, entities) > 0) {
+					column_count++;
+				} else {
+					// drop empty columns
+					writer.truncate(column_offset);
+				}
+			}(),
+			...);
+
+	return column_count;
+}
+
+template <typename T>
+inline static bool read_column(BinaryReader& reader, uint32_t count,
+		const StringTableView& strings, const std::vector<Entity>& entities) {
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t index = 0;
+		if (!reader.read(index) || index >= entities.size()) {
+			return false;
+		}
+
+		Entity entity = entities[index];
+
+		// required components are created with the entity
+		T& component = entity.has_component<T>()
+				? entity.get_component<T>()
+				: entity.add_component<T>();
+
+		if (!component_binary::read_component(
+					reader, strings, entity, component)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template <typename... Component>
+inline static bool dispatch_column(ComponentGroup<Component...>,
+		ComponentColumnId id, BinaryReader& reader, uint32_t count,
+		const StringTableView& strings, const std::vector<Entity>& entities) {
+	bool known = false;
+	bool result = true;
+
+	(
+			[&]() {
+				if (known || id != ComponentColumn<Component>::ID) {
+					return;
+				}
+
+				known = true;
+				result = read_column<Component>(
+						reader, count, strings, entities);
+			}(),
+			...);
+
+	if (!known) {
+		EVE_LOG_WARNING(
+				"Skipping unknown scene column with id {}.", (uint32_t)id);
+	}
+
+	return result;
+}
+
+// depth first so that parents are written before their children and
+// children keep their order
+inline static std::vector<Entity> collect_entities(Ref<Scene>& scene) {
+	const auto relation_view = scene->view<RelationComponent>();
+
+	std::vector<Entity> entities;
+	entities.reserve(relation_view.size());
+
+	relation_view.each(
+			[&](entt::entity entity_id, const RelationComponent& relation) {
+				if (relation.parent != entt::null) {
+					return;
+				}
+
+				Entity entity = { entity_id, scene.get() };
+				entities.push_back(entity);
+
+				entity.each_descendant([&](Entity descendant) {
+					entities.push_back(descendant);
+				});
+			});
+
+	return entities;
+}
+
+void Scene::serialize_binary(Ref<Scene> scene, std::string path) {
+	EVE_PROFILE_FUNCTION();
+
+	EVE_LOG_VERBOSE_TRACE("Serializing scene \"{}\" to binary path \"{}\".",
+			scene->name, path);
+
+	path = Project::get_asset_path(path).string();
+
+	StringTable strings;
+
+	SceneBinaryHeader header = {};
+	header.magic = SCENE_BINARY_MAGIC;
+	header.version = SCENE_BINARY_VERSION;
+	header.uid = scene->handle;
+	header.name = strings.add(scene->name);
+
+	BinaryWriter tables;
+
+	for (const auto& [uid, asset] : scene->get_asset_registry()) {
+		tables.write(AssetEntry{
+				asset->handle,
+				strings.add(asset->path),
+				(uint32_t)asset->get_type(),
+		});
+		header.asset_count++;
+	}
+
+	const std::vector<Entity> entities = collect_entities(scene);
+
+	std::unordered_map<UID, uint32_t> entity_indices;
+	entity_indices.reserve(entities.size());
+	for (uint32_t i = 0; i < entities.size(); i++) {
+		entity_indices[entities[i].get_uid()] = i;
+	}
+
+	for (Entity entity : entities) {
+		const UID parent_id = entity.get_relation().parent_id;
+		const auto parent_it = entity_indices.find(parent_id);
+
+		tables.write(EntityEntry{
+				entity.get_uid(),
+				strings.add(entity.get_name()),
+				parent_it != entity_indices.end() ? parent_it->second
+												  : INVALID_INDEX,
+		});
+	}
+	header.entity_count = entities.size();
+
+	BinaryWriter columns;
+	header.column_count =
+			write_columns(AllComponents{}, columns, strings, entities);
+
+	BinaryWriter string_table;
+	strings.write_table(string_table);
+
+	header.string_count = strings.get_count();
+	header.string_table_size = string_table.get_size();
+
+	std::ofstream file(path, std::ios::binary);
+	if (!file.is_open()) {
+		EVE_LOG_ERROR("Unable to open binary scene file at \"{}\".", path);
+		return;
+	}
+
+	file.write((const char*)&header, sizeof(SceneBinaryHeader));
+	file.write((const char*)string_table.get_data(), string_table.get_size());
+	file.write((const char*)tables.get_data(), tables.get_size());
+	file.write((const char*)columns.get_data(), columns.get_size());
+
+	EVE_LOG_VERBOSE_TRACE(
+			"Scene \"{}\" successfully serialized to binary path \"{}\".",
+			scene->name, path);
+}
+
+bool Scene::deserialize_binary(Ref<Scene>& scene, std::string path) {
+	EVE_PROFILE_FUNCTION();
+
+	SceneLoadData data;
+	data.path = Project::get_asset_path(path).string();
+	data.is_binary = true;
+
+	return _prepare_binary(data) && commit_load(scene, data);
+}
+
+bool Scene::_prepare_binary(SceneLoadData& data) {
+	EVE_PROFILE_FUNCTION();
+
+	const std::string& path = data.path;
+
+	std::ifstream file(path, std::ios::binary);
+	if (!file.is_open()) {
+		EVE_LOG_ERROR("Failed to load scene file at '{}'", path);
+		return false;
+	}
+
+	std::error_code error;
+	const uint64_t file_size = fs::file_size(path, error);
+	if (error) {
+		EVE_LOG_ERROR("Failed to load scene file at '{}'", path);
+		return false;
+	}
+
+	// the file is read at once so that the main thread only has to copy the
+	// columns into the registry
+	data.binary.resize(file_size);
+	if (!file.read((char*)data.binary.data(), file_size)) {
+		EVE_LOG_ERROR("Failed to load scene file at '{}'", path);
+		return false;
+	}
+
+	data.add_progress(LOAD_PROGRESS_READ);
+
+	BinaryReader reader(data.binary.data(), data.binary.size());
+
+	SceneBinaryHeader header;
+	if (!reader.read(header) || header.magic != SCENE_BINARY_MAGIC) {
+		EVE_LOG_ERROR("Unable to read binary scene '{}', unknown format.", path);
+		return false;
+	}
+
+	if (header.version != SCENE_BINARY_VERSION) {
+		EVE_LOG_ERROR("Unable to read binary scene '{}', version {} is not "
+					  "supported, cook the scene again.",
+				path, header.version);
+		return false;
+	}
+
+	const auto fail = [&]() -> bool {
+		EVE_LOG_ERROR("Unable to read binary scene '{}', file is corrupted.",
+				path);
+		return false;
+	};
+
+	if (header.string_table_size > reader.get_remaining()) {
+		return fail();
+	}
+
+	StringList& strings = data.strings;
+	strings.reserve(header.string_count);
+	{
+		BinaryReader string_reader(data.binary.data() + reader.get_position(),
+				header.string_table_size);
+		for (uint32_t i = 0; i < header.string_count; i++) {
+			std::string_view string;
+			if (!string_reader.read_string(string)) {
+				return fail();
+			}
+
+			strings.push_back(string);
+		}
+	}
+	reader.skip(header.string_table_size);
+
+	if ((uint64_t)header.asset_count * sizeof(AssetEntry) +
+					(uint64_t)header.entity_count * sizeof(EntityEntry) >
+			reader.get_remaining()) {
+		return fail();
+	}
+
+	std::vector<AssetEntry> assets(header.asset_count);
+	if (!reader.read_bytes(assets.data(), assets.size() * sizeof(AssetEntry))) {
+		return fail();
+	}
+
+	if (!get_string(strings, header.name, data.name)) {
+		return fail();
+	}
+	data.handle = header.uid;
+
+	std::vector<AssetLoadRequest> asset_requests;
+	asset_requests.reserve(assets.size());
+	for (const AssetEntry& asset : assets) {
+		if (asset.path >= strings.size()) {
+			return fail();
+		}
+
+		asset_requests.push_back({
+				std::string(strings[asset.path]),
+				(AssetType)asset.type,
+				asset.handle,
+		});
+	}
+
+	data.asset_loads = asset_loader::prepare_assets_async(asset_requests);
+
+	data.add_progress(LOAD_PROGRESS_PARSE);
+
+	return true;
+}
+
+bool Scene::_commit_binary(Ref<Scene>& scene, SceneLoadData& data) {
+	EVE_PROFILE_FUNCTION();
+
+	const auto fail = [&]() -> bool {
+		EVE_LOG_ERROR("Unable to read binary scene '{}', file is corrupted.",
+				data.path);
+
+		scene->entity_map.clear();
+		scene->name_index.clear();
+		scene->registry.clear();
+
+		return false;
+	};
+
+	// header and tables are validated by _prepare_binary
+	BinaryReader reader(data.binary.data(), data.binary.size());
+
+	SceneBinaryHeader header;
+	reader.read(header);
+	reader.skip(header.string_table_size);
+	reader.skip(header.asset_count * sizeof(AssetEntry));
+
+	std::vector<EntityEntry> entity_entries(header.entity_count);
+	if (!reader.read_bytes(entity_entries.data(),
+				entity_entries.size() * sizeof(EntityEntry))) {
+		return fail();
+	}
+
+	const StringList& strings = data.strings;
+
+	scene->entity_map.reserve(header.entity_count);
+
+	std::vector<Entity> entities;
+	entities.reserve(header.entity_count);
+	for (const EntityEntry& entry : entity_entries) {
+		if (entry.name >= strings.size()) {
+			return fail();
+		}
+
+		entities.push_back(
+				scene->create(entry.uid, std::string(strings[entry.name])));
+	}
+
+	// parents are linked before the transforms are assigned, same as the
+	// json loader, so local values are not converted
+	for (uint32_t i = 0; i < entities.size(); i++) {
+		const uint32_t parent = entity_entries[i].parent;
+		if (parent == INVALID_INDEX) {
+			continue;
+		}
+
+		if (parent >= i) {
+			return fail();
+		}
+
+		entities[i].set_parent(entities[parent]);
+	}
+
+	for (uint32_t i = 0; i < header.column_count; i++) {
+		ColumnHeader column;
+		if (!reader.read(column) || column.size > reader.get_remaining()) {
+			return fail();
+		}
+
+		BinaryReader column_reader(
+				data.binary.data() + reader.get_position(), column.size);
+		reader.skip(column.size);
+
+		if (!dispatch_column(AllComponents{}, (ComponentColumnId)column.id,
+					column_reader, column.count, StringTableView{ strings },
+					entities)) {
+			return fail();
+		}
+	}
+
+	return true;
+}
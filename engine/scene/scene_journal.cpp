@@ -0,0 +1,548 @@
+#include "scene/scene_journal.h"
+
+#include "scene/component_binary.h"
+
+// "ESCJ" in little endian
+inline constexpr uint32_t JOURNAL_MAGIC = 0x4A435345;
+inline constexpr uint32_t JOURNAL_VERSION = 1;
+
+// oldest changes are dropped after this
+inline constexpr size_t MAX_UNDO_COUNT = 128;
+
+// slot of the name and the parent of the entity, components use their column
+// ids
+inline constexpr uint32_t ENTITY_SLOT = 0;
+inline constexpr uint32_t SLOT_COUNT = COMPONENT_COLUMN_MAX + 1;
+
+struct ByteRange {
+	const uint8_t* data = nullptr;
+	uint32_t size = 0;
+
+	bool operator==(const ByteRange& other) const {
+		return size == other.size &&
+				(size == 0 || memcmp(data, other.data, size) == 0);
+	}
+};
+
+using SlotList = std::array<ByteRange, SLOT_COUNT>;
+
+struct JournalOp {
+	uint64_t uid;
+	uint32_t slot;
+	ByteRange before;
+	ByteRange after;
+};
+
+// returns the offset of the size to patch with end_slot
+inline static size_t begin_slot(BinaryWriter& writer, uint32_t slot) {
+	writer.write(slot);
+
+	const size_t size_offset = writer.get_size();
+	writer.write<uint32_t>(0);
+
+	return size_offset;
+}
+
+inline static void end_slot(BinaryWriter& writer, size_t size_offset) {
+	writer.write_at(size_offset,
+			(uint32_t)(writer.get_size() - size_offset - sizeof(uint32_t)));
+}
+
+// snapshots are written by the journal itself, missing slots stay empty
+inline static SlotList split_snapshot(const uint8_t* data, size_t size) {
+	SlotList slots{};
+
+	BinaryReader reader(data, size);
+
+	uint32_t slot = 0;
+	uint32_t slot_size = 0;
+	while (reader.get_remaining() > 0 && reader.read(slot) &&
+			reader.read(slot_size) && slot < SLOT_COUNT &&
+			slot_size <= reader.get_remaining()) {
+		slots[slot] = { data + reader.get_position(), slot_size };
+		reader.skip(slot_size);
+	}
+
+	return slots;
+}
+
+inline static void write_range(BinaryWriter& writer, const ByteRange& range) {
+	writer.write(range.size);
+	writer.write_bytes(range.data, range.size);
+}
+
+inline static bool read_range(
+		BinaryReader& reader, const uint8_t* data, ByteRange& range) {
+	if (!reader.read(range.size) || range.size > reader.get_remaining()) {
+		return false;
+	}
+
+	range.data = data + reader.get_position();
+	return reader.skip(range.size);
+}
+
+inline static void write_diff(BinaryWriter& change, UID uid,
+		const ByteRange& before, const ByteRange& after) {
+	const SlotList before_slots = split_snapshot(before.data, before.size);
+	const SlotList after_slots = split_snapshot(after.data, after.size);
+
+	for (uint32_t slot = 0; slot < SLOT_COUNT; slot++) {
+		if (before_slots[slot] == after_slots[slot]) {
+			continue;
+		}
+
+		change.write<uint64_t>(uid);
+		change.write(slot);
+		write_range(change, before_slots[slot]);
+		write_range(change, after_slots[slot]);
+	}
+}
+
+inline static bool read_ops(
+		const std::vector<uint8_t>& change, std::vector<JournalOp>& ops) {
+	BinaryReader reader(change.data(), change.size());
+
+	while (reader.get_remaining() > 0) {
+		JournalOp op;
+		if (!reader.read(op.uid) || !reader.read(op.slot) ||
+				op.slot >= SLOT_COUNT ||
+				!read_range(reader, change.data(), op.before) ||
+				!read_range(reader, change.data(), op.after)) {
+			return false;
+		}
+
+		ops.push_back(op);
+	}
+
+	return true;
+}
+
+// returns false if the entity slot is corrupted
+inline static bool read_entity_slot(
+		const ByteRange& state, std::string_view& name, UID& parent_id) {
+	BinaryReader reader(state.data, state.size);
+
+	uint64_t parent = 0;
+	reader.read_string(name);
+	reader.read(parent);
+	parent_id = parent;
+
+	return reader.is_valid();
+}
+
+template <typename T>
+inline static bool apply_component(Entity entity, const ByteRange& state) {
+	if (state.size == 0) {
+		if (entity.has_component<T>()) {
+			entity.remove_component<T>();
+		}
+		return true;
+	}
+
+	T& component = entity.has_component<T>() ? entity.get_component<T>()
+											 : entity.add_component<T>();
+
+	BinaryReader reader(state.data, state.size);
+	return component_binary::read_component(
+			reader, InlineStrings{}, entity, component);
+}
+
+template <typename... Component>
+inline static bool apply_component_slot(ComponentGroup<Component...>,
+		uint32_t slot, Entity entity, const ByteRange& state) {
+	bool result = true;
+
+	(
+			[&]() {
+				if (slot == (uint32_t)ComponentColumn<Component>::ID) {
+					result = apply_component<Component>(entity, state);
+				}
+			}(),
+			...);
+
+	return result;
+}
+
+void SceneJournal::reset(Ref<Scene> _scene, const fs::path& _autosave_path) {
+	EVE_PROFILE_FUNCTION();
+
+	scene = _scene;
+	autosave_path = _autosave_path;
+
+	snapshots.clear();
+	dirty_ids.clear();
+	undo_stack.clear();
+	redo_stack.clear();
+
+	if (!scene) {
+		return;
+	}
+
+	const auto id_view = scene->view<IdComponent>();
+	snapshots.reserve(id_view.size());
+
+	BinaryWriter writer;
+	id_view.each([&](entt::entity entity_id, const IdComponent& id) {
+		writer.clear();
+		_write_snapshot(writer, Entity{ entity_id, scene.get() });
+
+		snapshots[id.id].assign(
+				writer.get_data(), writer.get_data() + writer.get_size());
+	});
+}
+
+void SceneJournal::mark_dirty(UID uid) { dirty_ids.insert(uid); }
+
+bool SceneJournal::record() {
+	EVE_PROFILE_FUNCTION();
+
+	if (!scene) {
+		return false;
+	}
+
+	// created entities do not have a snapshot yet
+	const auto id_view = scene->view<IdComponent>();
+	id_view.each([this](const IdComponent& id) {
+		if (!snapshots.contains(id.id)) {
+			dirty_ids.insert(id.id);
+		}
+	});
+
+	BinaryWriter change;
+	BinaryWriter snapshot;
+
+	for (const UID uid : dirty_ids) {
+		Entity entity = scene->find_by_id(uid);
+		if (!entity) {
+			continue;
+		}
+
+		snapshot.clear();
+		_write_snapshot(snapshot, entity);
+
+		const ByteRange current = { snapshot.get_data(),
+			(uint32_t)snapshot.get_size() };
+
+		// new entities start with an empty snapshot
+		std::vector<uint8_t>& last_snapshot = snapshots[uid];
+		const ByteRange last = { last_snapshot.data(),
+			(uint32_t)last_snapshot.size() };
+
+		if (last == current) {
+			continue;
+		}
+
+		write_diff(change, uid, last, current);
+
+		last_snapshot.assign(
+				snapshot.get_data(), snapshot.get_data() + snapshot.get_size());
+	}
+
+	dirty_ids.clear();
+
+	// every entity has a snapshot now, the ones left belong to destroyed
+	// entities
+	if (snapshots.size() > id_view.size()) {
+		for (auto it = snapshots.begin(); it != snapshots.end();) {
+			if (scene->exists(it->first)) {
+				it++;
+				continue;
+			}
+
+			write_diff(change, it->first,
+					{ it->second.data(), (uint32_t)it->second.size() }, {});
+
+			it = snapshots.erase(it);
+		}
+	}
+
+	if (change.get_size() == 0) {
+		return false;
+	}
+
+	std::vector<uint8_t> data(
+			change.get_data(), change.get_data() + change.get_size());
+
+	_append_autosave(data, true);
+
+	undo_stack.push_back(std::move(data));
+	if (undo_stack.size() > MAX_UNDO_COUNT) {
+		undo_stack.erase(undo_stack.begin());
+	}
+
+	redo_stack.clear();
+
+	return true;
+}
+
+bool SceneJournal::undo() {
+	EVE_PROFILE_FUNCTION();
+
+	// edits which are not recorded yet are the first ones to undo
+	record();
+
+	if (undo_stack.empty()) {
+		return false;
+	}
+
+	std::vector<uint8_t> change = std::move(undo_stack.back());
+	undo_stack.pop_back();
+
+	_apply(change, false);
+	_append_autosave(change, false);
+
+	redo_stack.push_back(std::move(change));
+
+	return true;
+}
+
+bool SceneJournal::redo() {
+	EVE_PROFILE_FUNCTION();
+
+	if (redo_stack.empty()) {
+		return false;
+	}
+
+	std::vector<uint8_t> change = std::move(redo_stack.back());
+	redo_stack.pop_back();
+
+	_apply(change, true);
+	_append_autosave(change, true);
+
+	undo_stack.push_back(std::move(change));
+
+	return true;
+}
+
+bool SceneJournal::can_undo() const { return !undo_stack.empty(); }
+
+bool SceneJournal::can_redo() const { return !redo_stack.empty(); }
+
+void SceneJournal::set_autosave_path(const fs::path& _autosave_path) {
+	autosave_path = _autosave_path;
+}
+
+bool SceneJournal::has_autosave() const {
+	return !autosave_path.empty() && fs::exists(autosave_path);
+}
+
+bool SceneJournal::recover() {
+	EVE_PROFILE_FUNCTION();
+
+	if (!scene || !has_autosave()) {
+		return false;
+	}
+
+	std::ifstream file(autosave_path, std::ios::binary);
+	const std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)),
+			std::istreambuf_iterator<char>());
+
+	BinaryReader reader(data.data(), data.size());
+
+	uint32_t magic = 0;
+	uint32_t version = 0;
+	reader.read(magic);
+	reader.read(version);
+	if (!reader.is_valid() || magic != JOURNAL_MAGIC ||
+			version != JOURNAL_VERSION) {
+		EVE_LOG_ERROR("Unable to read autosave file at \"{}\".",
+				autosave_path.string());
+		return false;
+	}
+
+	uint32_t change_count = 0;
+
+	std::vector<uint8_t> change;
+	while (reader.get_remaining() > 0) {
+		uint32_t size = 0;
+		if (!reader.read(size) || size > reader.get_remaining()) {
+			// the editor stopped while writing the last change
+			EVE_LOG_WARNING("Skipping incomplete change in autosave file.");
+			break;
+		}
+
+		change.resize(size);
+		reader.read_bytes(change.data(), size);
+
+		if (!_apply(change, true)) {
+			break;
+		}
+
+		change_count++;
+	}
+
+	EVE_LOG_INFO("Recovered {} changes from the autosave file.", change_count);
+
+	return change_count > 0;
+}
+
+void SceneJournal::on_save() {
+	if (autosave_path.empty()) {
+		return;
+	}
+
+	std::error_code error;
+	fs::remove(autosave_path, error);
+}
+
+void SceneJournal::_write_snapshot(BinaryWriter& writer, Entity entity) const {
+	const size_t size_offset = begin_slot(writer, ENTITY_SLOT);
+	writer.write_string(entity.get_name());
+	writer.write<uint64_t>(entity.get_relation().parent_id);
+	end_slot(writer, size_offset);
+
+	InlineStrings strings;
+	component_binary::write_components(
+			AllComponents{}, writer, strings, entity);
+}
+
+bool SceneJournal::_apply(const std::vector<uint8_t>& change, bool forward) {
+	EVE_PROFILE_FUNCTION();
+
+	std::vector<JournalOp> ops;
+	if (!read_ops(change, ops)) {
+		EVE_LOG_ERROR("Unable to apply scene change, data is corrupted.");
+		return false;
+	}
+
+	const auto get_state = [forward](const JournalOp& op) -> const ByteRange& {
+		return forward ? op.after : op.before;
+	};
+
+	std::unordered_set<uint64_t> destroyed_ids;
+
+	// entities first so that parents and components have something to
+	// attach to
+	for (const JournalOp& op : ops) {
+		if (op.slot != ENTITY_SLOT) {
+			continue;
+		}
+
+		const ByteRange& state = get_state(op);
+		if (state.size == 0) {
+			destroyed_ids.insert(op.uid);
+			continue;
+		}
+
+		std::string_view name;
+		UID parent_id;
+		if (!read_entity_slot(state, name, parent_id)) {
+			return false;
+		}
+
+		Entity entity = scene->find_by_id(op.uid);
+		if (!entity) {
+			scene->create(op.uid, std::string(name));
+		} else {
+			entity.set_name(std::string(name));
+		}
+	}
+
+	for (const JournalOp& op : ops) {
+		const ByteRange& state = get_state(op);
+		if (op.slot != ENTITY_SLOT || state.size == 0) {
+			continue;
+		}
+
+		std::string_view name;
+		UID parent_id;
+		read_entity_slot(state, name, parent_id);
+
+		Entity entity = scene->find_by_id(op.uid);
+		if (entity.get_relation().parent_id != parent_id) {
+			entity.set_parent(scene->find_by_id(parent_id));
+		}
+	}
+
+	// transforms are assigned after the parents so local values are kept
+	for (const JournalOp& op : ops) {
+		if (op.slot == ENTITY_SLOT || destroyed_ids.contains(op.uid)) {
+			continue;
+		}
+
+		Entity entity = scene->find_by_id(op.uid);
+		if (!entity ||
+				!apply_component_slot(
+						AllComponents{}, op.slot, entity, get_state(op))) {
+			EVE_LOG_ERROR("Unable to apply component change of entity {}.",
+					op.uid);
+		}
+	}
+
+	for (const uint64_t uid : destroyed_ids) {
+		scene->destroy(uid);
+	}
+
+	// keep the snapshots in sync so the change is not recorded again
+	std::unordered_set<uint64_t> updated_ids;
+	for (const JournalOp& op : ops) {
+		if (!updated_ids.insert(op.uid).second) {
+			continue;
+		}
+
+		_update_snapshot(op.uid);
+	}
+
+	// children are destroyed along with their parents
+	if (!destroyed_ids.empty()) {
+		std::erase_if(snapshots, [this](const auto& pair) {
+			return !scene->exists(pair.first);
+		});
+	}
+
+	return true;
+}
+
+void SceneJournal::_append_autosave(
+		const std::vector<uint8_t>& change, bool forward) {
+	if (autosave_path.empty()) {
+		return;
+	}
+
+	std::vector<JournalOp> ops;
+	if (!read_ops(change, ops)) {
+		return;
+	}
+
+	BinaryWriter writer;
+	if (!fs::exists(autosave_path)) {
+		writer.write(JOURNAL_MAGIC);
+		writer.write(JOURNAL_VERSION);
+	}
+
+	// recovery only goes forward so previous states are left out
+	const size_t size_offset = writer.get_size();
+	writer.write<uint32_t>(0);
+
+	for (const JournalOp& op : ops) {
+		writer.write(op.uid);
+		writer.write(op.slot);
+		write_range(writer, {});
+		write_range(writer, forward ? op.after : op.before);
+	}
+
+	end_slot(writer, size_offset);
+
+	std::ofstream file(autosave_path, std::ios::binary | std::ios::app);
+	if (!file.is_open()) {
+		EVE_LOG_ERROR("Unable to write autosave file at \"{}\".",
+				autosave_path.string());
+		return;
+	}
+
+	file.write((const char*)writer.get_data(), writer.get_size());
+}
+
+void SceneJournal::_update_snapshot(UID uid) {
+	Entity entity = scene->find_by_id(uid);
+	if (!entity) {
+		snapshots.erase(uid);
+		return;
+	}
+
+	BinaryWriter writer;
+	_write_snapshot(writer, entity);
+
+	snapshots[uid].assign(
+			writer.get_data(), writer.get_data() + writer.get_size());
+}
@@ -0,0 +1,73 @@
+#ifndef SCENE_JOURNAL_H
+#define SCENE_JOURNAL_H
+
+#include "core/binary_utils.h"
+#include "scene/scene.h"
+
+// Keeps the last recorded state of every entity as plain bytes and turns the
+// differences into component level changes. Changes are used for undo/redo
+// and appended to an autosave file, so saving an edit does not require
+// writing the whole scene again.
+//
+// A change is a list of operations:
+//
+//  uint64_t entity id
+//  uint32_t slot, 0 for the entity itself or a ComponentColumnId
+//  uint32_t size followed by the state before, empty if it did not exist
+//  uint32_t size followed by the state after, empty if it does not exist
+//
+// Autosave files only store the state after.
+class SceneJournal {
+public:
+	// takes the current state of the scene as the base and clears the history
+	void reset(Ref<Scene> scene, const fs::path& autosave_path = {});
+
+	// entity is compared with its last recorded state on the next record
+	void mark_dirty(UID uid);
+
+	// compares the dirty, created and destroyed entities with the last
+	// recorded state, returns false if nothing has changed
+	bool record();
+
+	bool undo();
+
+	bool redo();
+
+	bool can_undo() const;
+
+	bool can_redo() const;
+
+	// changes after this point are written to the given file
+	void set_autosave_path(const fs::path& autosave_path);
+
+	bool has_autosave() const;
+
+	// applies the changes of the autosave file on top of the scene, the
+	// file is kept since the scene file still does not contain them
+	bool recover();
+
+	// scene file contains every change now, removes the autosave file
+	void on_save();
+
+private:
+	void _write_snapshot(BinaryWriter& writer, Entity entity) const;
+
+	// returns false if the change is corrupted
+	bool _apply(const std::vector<uint8_t>& change, bool forward);
+
+	void _append_autosave(const std::vector<uint8_t>& change, bool forward);
+
+	void _update_snapshot(UID uid);
+
+private:
+	Ref<Scene> scene = nullptr;
+	fs::path autosave_path;
+
+	std::unordered_map<UID, std::vector<uint8_t>> snapshots;
+	std::unordered_set<UID> dirty_ids;
+
+	std::vector<std::vector<uint8_t>> undo_stack;
+	std::vector<std::vector<uint8_t>> redo_stack;
+};
+
+#endif
@@ -0,0 +1,148 @@
+#ifndef SCENE_LOAD_DATA_H
+#define SCENE_LOAD_DATA_H
+
+#include "asset/asset_registry.h"
+#include "core/json_utils.h"
+#include "scene/component_reflection.h"
+#include "scene/components.h"
+#include "scene/entity.h"
+
+// scenes smaller than this are parsed on the calling thread only
+inline constexpr uint32_t ENTITIES_PER_CHUNK = 1024;
+
+struct StagedEntity {
+	UID id = INVALID_UID;
+	std::string tag;
+	UID parent_id = INVALID_UID;
+};
+
+template <typename T>
+struct StagedColumn {
+	std::vector<uint32_t> indices;
+	std::vector<T> components;
+};
+
+// Entities of a scene file parsed by a worker thread without touching the
+// registry, indices point into the entity list of the whole scene.
+template <typename Group>
+struct StagedChunk;
+
+template <typename... Component>
+struct StagedChunk<ComponentGroup<Component...>> {
+	std::vector<StagedEntity> entities;
+	std::tuple<StagedColumn<Component>...> columns;
+
+	// script field values need the script runtime so they are read on the
+	// main thread
+	std::vector<std::pair<uint32_t, const Json*>> script_fields;
+
+	void stage(uint32_t index, const Json& entity_json) {
+		entities.push_back({
+				entity_json["id"].get<UID>(),
+				entity_json["tag"].get<std::string>(),
+				entity_json["parent_id"].get<UID>(),
+		});
+
+		// components are stored in AllComponents order, see
+		// serialize_components
+		auto cursor = entity_json.begin();
+		(stage_component<Component>(index, entity_json, cursor), ...);
+	}
+
+	void commit(entt::registry& registry, const std::vector<Entity>& targets) {
+		(commit_column<Component>(registry, targets), ...);
+	}
+
+private:
+	template <typename T>
+	void stage_component(uint32_t index, const Json& entity_json,
+			Json::const_iterator& cursor) {
+		const auto it = reflection::find_key(
+				entity_json, cursor, Reflection<T>::NAME);
+		if (it == entity_json.end() || it->is_null()) {
+			return;
+		}
+
+		auto& column = std::get<StagedColumn<T>>(columns);
+		column.indices.push_back(index);
+		reflection::read_json(*it, column.components.emplace_back());
+
+		if constexpr (std::is_same_v<T, ScriptComponent>) {
+			const auto fields_it = it->find("script_fields");
+			if (fields_it != it->end()) {
+				script_fields.emplace_back(index, &*fields_it);
+			}
+		}
+	}
+
+	template <typename T>
+	void commit_column(
+			entt::registry& registry, const std::vector<Entity>& targets) {
+		auto& column = std::get<StagedColumn<T>>(columns);
+		if (column.indices.empty()) {
+			return;
+		}
+
+		if constexpr (std::is_same_v<T, Transform>) {
+			// transforms are created with the entities and might be linked
+			// to their parents already
+			for (size_t i = 0; i < column.indices.size(); i++) {
+				reflection::copy(
+						registry.get<Transform>(targets[column.indices[i]]),
+						column.components[i]);
+			}
+		} else {
+			std::vector<entt::entity> handles;
+			handles.reserve(column.indices.size());
+			for (const uint32_t index : column.indices) {
+				handles.push_back(targets[index]);
+			}
+
+			registry.insert<T>(handles.begin(), handles.end(),
+					std::make_move_iterator(column.components.begin()));
+		}
+
+		column = {};
+	}
+};
+
+using SceneChunk = StagedChunk<AllComponents>;
+
+// share of every loading step in the reported progress, the rest is left
+// for Scene::commit_load
+inline constexpr float LOAD_PROGRESS_READ = 0.3f;
+inline constexpr float LOAD_PROGRESS_PARSE = 0.4f;
+inline constexpr float LOAD_PROGRESS_ASSETS = 0.25f;
+
+// Scene file read into memory by Scene::prepare_load, nothing in here
+// belongs to a scene until Scene::commit_load.
+struct SceneLoadData {
+	// absolute path of the file
+	std::string path;
+	bool is_binary = false;
+
+	AssetHandle handle = INVALID_UID;
+	std::string name;
+
+	PendingAssetLoads asset_loads;
+
+	// json scenes, script fields of the chunks point into the document
+	Json document;
+	std::vector<SceneChunk> chunks;
+
+	// cooked scenes, the whole file since the tables are read again on
+	// commit, strings point into it
+	std::vector<uint8_t> binary;
+	std::vector<std::string_view> strings;
+
+	// written from the loading threads, might be null
+	std::atomic<float>* progress = nullptr;
+
+	inline void add_progress(float amount) {
+		if (progress) {
+			progress->fetch_add(amount);
+		}
+	}
+};
+
+#endif
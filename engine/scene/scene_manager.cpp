@@ -1,13 +1,62 @@
 #include "scene/scene_manager.h"
 
 #include "core/application.h"
+#include "project/project.h"
 
 Ref<Scene> SceneManager::s_active_scene = nullptr;
+bool SceneManager::s_use_cooked_scenes = false;
+std::vector<std::future<void>> SceneManager::s_load_workers = {};
+
+float SceneLoadHandle::get_progress() const { return progress.load(); }
+
+SceneLoadState SceneLoadHandle::get_state() const { return state.load(); }
+
+bool SceneLoadHandle::is_done() const {
+	return state.load() != SceneLoadState::LOADING;
+}
+
+Ref<Scene> SceneLoadHandle::get_scene() const { return scene; }
+
+inline static std::string get_cooked_scene_path(const std::string& path) {
+	fs::path cooked_path = path;
+	if (cooked_path.extension() != SCENE_EXTENSION) {
+		return path;
+	}
+
+	cooked_path.replace_extension(SCENE_BINARY_EXTENSION);
+
+	const fs::path asset_path = Project::get_asset_path(path);
+	const fs::path cooked_asset_path =
+			Project::get_asset_path(cooked_path.string());
+	if (!fs::exists(cooked_asset_path)) {
+		return path;
+	}
+
+	// builds may ship without the text scenes
+	std::error_code error;
+	const auto source_time = fs::last_write_time(asset_path, error);
+	if (!error) {
+		const auto cooked_time = fs::last_write_time(cooked_asset_path, error);
+		if (error || cooked_time < source_time) {
+			EVE_LOG_WARNING("Cooked scene '{}' is older than '{}', loading the "
+							"text scene instead.",
+					cooked_path.string(), path);
+			return path;
+		}
+	}
+
+	EVE_LOG_VERBOSE_TRACE("Loading cooked scene '{}'.", cooked_path.string());
+
+	return cooked_path.string();
+}
+
+bool SceneManager::load_scene(const std::string& scene_path) {
+	const std::string path =
+			s_use_cooked_scenes ? get_cooked_scene_path(scene_path) : scene_path;
 
-bool SceneManager::load_scene(const std::string& path) {
 	//? TODO do not unload shared assets
 	if (s_active_scene && s_active_scene->is_running()) {
-		Application::enque_main_thread([&]() {
+		Application::enque_main_thread([path]() {
 			s_active_scene->stop();
 
 			if (!Scene::deserialize(
@@ -34,11 +83,104 @@ bool SceneManager::load_scene(const std::string& path) {
 	return true;
 }
 
+Ref<SceneLoadHandle> SceneManager::load_scene_async(
+		const std::string& scene_path, bool activate) {
+	EVE_PROFILE_FUNCTION();
+
+	const std::string path =
+			s_use_cooked_scenes ? get_cooked_scene_path(scene_path) : scene_path;
+
+	Ref<SceneLoadHandle> handle = create_ref<SceneLoadHandle>();
+
+	// forget about the finished loads
+	std::erase_if(s_load_workers, [](const std::future<void>& worker) {
+		return worker.wait_for(std::chrono::seconds(0)) ==
+				std::future_status::ready;
+	});
+
+	// the editor may stop the play mode or change the scene before the load
+	// is done, the loaded scene must not replace whatever is active then
+	const std::weak_ptr<Scene> requester = s_active_scene;
+	const bool requester_running =
+			s_active_scene && s_active_scene->is_running();
+
+	const auto load = [handle, path, activate, requester,
+							  requester_running]() {
+		// a malformed scene file throws while it is parsed, the handle has
+		// to fail instead of loading forever
+		Ref<SceneLoadData> data = nullptr;
+		try {
+			data = Scene::prepare_load(path, &handle->progress);
+			if (data) {
+				Scene::wait_for_assets(*data);
+			}
+		} catch (const std::exception& e) {
+			EVE_LOG_ERROR("Unable to read scene from path: {}, {}", path,
+					e.what());
+			data = nullptr;
+		}
+
+		// only the renderer uploads and registry inserts are left
+		Application::enque_main_thread([handle, path, activate, data,
+											   requester, requester_running]() {
+			Ref<Scene> scene = create_ref<Scene>();
+			if (!data || !Scene::commit_load(scene, *data)) {
+				EVE_LOG_ERROR("Unable to load scene from path: {}", path);
+				handle->state = SceneLoadState::FAILED;
+				return;
+			}
+
+			handle->scene = scene;
+			handle->progress = 1.0f;
+			handle->state = SceneLoadState::LOADED;
+
+			if (!activate) {
+				return;
+			}
+
+			const bool requester_changed = requester.lock() != s_active_scene;
+			const bool requester_stopped = requester_running &&
+					(!s_active_scene || !s_active_scene->is_running());
+			if (requester_changed || requester_stopped) {
+				EVE_LOG_WARNING("Scene {} is loaded but not activated, the "
+								"scene that requested it is gone.",
+						path);
+				handle->scene = nullptr;
+				return;
+			}
+
+			const bool was_running =
+					s_active_scene && s_active_scene->is_running();
+			if (was_running) {
+				s_active_scene->stop();
+			}
+
+			set_active(scene);
+
+			// handles may be kept around, only the scene manager keeps the
+			// active scene alive
+			handle->scene = nullptr;
+
+			if (was_running) {
+				s_active_scene->start();
+			}
+		});
+	};
+
+	s_load_workers.push_back(std::async(std::launch::async, load));
+
+	return handle;
+}
+
 void SceneManager::set_active(Ref<Scene> scene) {
 	s_active_scene.reset();
 	s_active_scene = scene;
 }
 
+void SceneManager::set_use_cooked_scenes(bool use_cooked) {
+	s_use_cooked_scenes = use_cooked;
+}
+
 Ref<Scene>& SceneManager::get_active() {
 	return s_active_scene;
 }
@@ -3,17 +3,60 @@
 
 #include "scene/entity.h"
 
+enum class SceneLoadState {
+	LOADING,
+	LOADED,
+	FAILED,
+};
+
+// Progress of a scene loaded in the background, the scene is filled on the
+// main thread at the end so it is safe to poll from there.
+class SceneLoadHandle {
+public:
+	// in [0, 1] range
+	float get_progress() const;
+
+	SceneLoadState get_state() const;
+
+	bool is_done() const;
+
+	// null until the load is finished and again once the scene is activated
+	Ref<Scene> get_scene() const;
+
+private:
+	std::atomic<float> progress = 0.0f;
+	std::atomic<SceneLoadState> state = SceneLoadState::LOADING;
+
+	Ref<Scene> scene = nullptr;
+
+	friend class SceneManager;
+};
+
 class SceneManager {
 public:
-	// TODO	Make an async version
 	static bool load_scene(const std::string& path);
 
+	// Reads, parses and decodes the scene on a worker thread and fills it on
+	// the main thread queue. When activate is set the loaded scene replaces
+	// the active one, otherwise it is kept as is to be activated later on
+	// with set_active, e.g. preloading the next level. The scene is not
+	// activated if the active scene changed or stopped running meanwhile.
+	static Ref<SceneLoadHandle> load_scene_async(
+			const std::string& path, bool activate = true);
+
 	static void set_active(Ref<Scene> scene);
 
+	// when enabled json scenes are replaced with their cooked binary
+	// versions laying next to them if there are any
+	static void set_use_cooked_scenes(bool use_cooked);
+
 	static Ref<Scene>& get_active();
 
 private:
 	static Ref<Scene> s_active_scene;
+	static bool s_use_cooked_scenes;
+
+	static std::vector<std::future<void>> s_load_workers;
 };
 
 #endif
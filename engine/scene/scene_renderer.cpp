@@ -163,7 +163,10 @@ void SceneRenderer::_render_scene(const CameraData& camera_data) {
 
 		renderer::begin_pass(camera_data);
 		{
-			scene->view<Transform, SpriteRenderer>().each(
+			// pooled entities are not drawn
+			const auto sprite_view = scene->view<Transform, SpriteRenderer>(
+					entt::exclude<InactiveComponent>);
+			sprite_view.each(
 					[this, scene](entt::entity entity_id,
 							const Transform& transform,
 							const SpriteRenderer& sprite) {
@@ -212,7 +215,9 @@ void SceneRenderer::_render_scene(const CameraData& camera_data) {
 						}
 					});
 
-			scene->view<Transform, TextRenderer>().each(
+			const auto text_view = scene->view<Transform, TextRenderer>(
+					entt::exclude<InactiveComponent>);
+			text_view.each(
 					[this, scene](entt::entity entity_id,
 							const Transform& transform,
 							const TextRenderer& text_component) {
@@ -11,13 +11,42 @@
 #include <mono/metadata/object.h>
 #include <mono/metadata/threads.h>
 
+// classes are only loaded on the main thread
+static uint32_t s_next_class_id = 1;
+
 ScriptClass::ScriptClass(const std::string& class_namespace,
 		const std::string& class_name, bool is_core) :
-		class_namespace(class_namespace), class_name(class_name) {
+		id(s_next_class_id++),
+		class_namespace(class_namespace),
+		class_name(class_name),
+		full_name(class_namespace.empty()
+						? class_name
+						: std::format("{}.{}", class_namespace, class_name)) {
 	mono_class = mono_class_from_name(is_core
 					? ScriptEngine::get_core_assembly_image()
 					: ScriptEngine::get_app_assembly_image(),
 			class_namespace.c_str(), class_name.c_str());
+	if (!mono_class) {
+		return;
+	}
+
+	constructor = get_method(".ctor", 1);
+	on_create_method = get_method("OnCreate", 0);
+	on_update_method = get_method("OnUpdate", 1);
+	on_destroy_method = get_method("OnDestroy", 0);
+
+	if (on_create_method) {
+		on_create_thunk = (ScriptCallbackThunk)mono_method_get_unmanaged_thunk(
+				on_create_method);
+	}
+	if (on_update_method) {
+		on_update_thunk = (ScriptUpdateThunk)mono_method_get_unmanaged_thunk(
+				on_update_method);
+	}
+	if (on_destroy_method) {
+		on_destroy_thunk = (ScriptCallbackThunk)mono_method_get_unmanaged_thunk(
+				on_destroy_method);
+	}
 }
 
 MonoObject* ScriptClass::instantiate() {
@@ -29,6 +58,72 @@ MonoMethod* ScriptClass::get_method(const std::string& name, int param_count) {
 			mono_class, name.c_str(), param_count);
 }
 
+void log_script_exception(MonoObject* exception) {
+	// corlib outlives the script domains, so the getter is looked up once
+	static MonoMethod* s_message_getter =
+			mono_property_get_get_method(mono_class_get_property_from_name(
+					mono_get_exception_class(), "Message"));
+
+	MonoString* msg = (MonoString*)mono_runtime_invoke(
+			s_message_getter, exception, nullptr, nullptr);
+	if (!msg) {
+		log_script_exception_message("Unknown exception");
+		return;
+	}
+
+	char* message_utf8 = mono_string_to_utf8(msg);
+
+	log_script_exception_message(message_utf8);
+
+	mono_free(message_utf8);
+}
+
+struct ScriptExceptionLogState {
+	std::chrono::steady_clock::time_point last_logged;
+	uint32_t skipped_count = 0;
+};
+
+void log_script_exception_message(std::string_view message) {
+	// jobs throw from the worker threads
+	static std::mutex s_mutex;
+	static std::unordered_map<std::string, ScriptExceptionLogState> s_states;
+
+	// messages with ids in them would otherwise grow it forever
+	constexpr size_t MAX_TRACKED_MESSAGES = 256;
+
+	const auto now = std::chrono::steady_clock::now();
+
+	std::lock_guard<std::mutex> lock(s_mutex);
+
+	const std::string key(message);
+
+	auto it = s_states.find(key);
+	if (it == s_states.end()) {
+		if (s_states.size() == MAX_TRACKED_MESSAGES) {
+			s_states.clear();
+		}
+
+		s_states.emplace(key, ScriptExceptionLogState{ now });
+
+		EVE_LOG_ERROR("[EXCEPTION] [SCRIPT]: {}", message);
+		return;
+	}
+
+	ScriptExceptionLogState& state = it->second;
+
+	const std::chrono::duration<float> elapsed = now - state.last_logged;
+	if (elapsed.count() < SCRIPT_EXCEPTION_LOG_INTERVAL) {
+		state.skipped_count++;
+		return;
+	}
+
+	EVE_LOG_ERROR("[EXCEPTION] [SCRIPT]: {} (skipped {} times)", message,
+			state.skipped_count);
+
+	state.last_logged = now;
+	state.skipped_count = 0;
+}
+
 MonoObject* ScriptClass::invoke_method(
 		MonoObject* instance, MonoMethod* method, void** params) {
 	MonoObject* exception = nullptr;
@@ -37,18 +132,7 @@ MonoObject* ScriptClass::invoke_method(
 
 	// Check if an exception occurred
 	if (exception != nullptr) {
-		MonoProperty* prop = mono_class_get_property_from_name(
-				mono_get_exception_class(), "Message");
-		MonoMethod* getter = mono_property_get_get_method(prop);
-		MonoString* msg = (MonoString*)mono_runtime_invoke(
-				getter, exception, nullptr, nullptr);
-
-		char* message_utf8 = mono_string_to_utf8(msg);
-
-		EVE_LOG_ERROR("[EXCEPTION] [SCRIPT]: {}", message_utf8);
-
-		mono_free(message_utf8);
-
+		log_script_exception(exception);
 		return nullptr;
 	}
 
@@ -60,27 +144,31 @@ ScriptClass::get_fields() const {
 	return fields;
 }
 
-MonoClass* ScriptClass::get_mono_class() { return mono_class; }
+MonoClass* ScriptClass::get_mono_class() const { return mono_class; }
+
+uint32_t ScriptClass::get_id() const { return id; }
+
+const std::string& ScriptClass::get_full_name() const { return full_name; }
 
 ScriptInstance::ScriptInstance(
 		Ref<ScriptClass> script_class, MonoObject* managed_object) :
 		script_class(script_class) {
 	instance = managed_object;
 
-	ctor = ScriptEngine::get_entity_class().get_method(".ctor", 1);
-	on_create_method = script_class->get_method("OnCreate", 0);
-	on_update_method = script_class->get_method("OnUpdate", 1);
-	on_destroy_method = script_class->get_method("OnDestroy", 0);
+	ctor = ScriptEngine::get_entity_class().constructor;
+	on_create_method = script_class->on_create_method;
+	on_update_method = script_class->on_update_method;
+	on_destroy_method = script_class->on_destroy_method;
 }
 
 ScriptInstance::ScriptInstance(Ref<ScriptClass> script_class, Entity entity) :
 		script_class(script_class) {
 	instance = script_class->instantiate();
 
-	ctor = ScriptEngine::get_entity_class().get_method(".ctor", 1);
-	on_create_method = script_class->get_method("OnCreate", 0);
-	on_update_method = script_class->get_method("OnUpdate", 1);
-	on_destroy_method = script_class->get_method("OnDestroy", 0);
+	ctor = ScriptEngine::get_entity_class().constructor;
+	on_create_method = script_class->on_create_method;
+	on_update_method = script_class->on_update_method;
+	on_destroy_method = script_class->on_destroy_method;
 
 	// Call Entity constructor
 	{
@@ -91,21 +179,41 @@ ScriptInstance::ScriptInstance(Ref<ScriptClass> script_class, Entity entity) :
 }
 
 void ScriptInstance::invoke_on_create() {
-	if (on_create_method) {
-		script_class->invoke_method(instance, on_create_method);
+	if (!script_class->on_create_thunk) {
+		return;
+	}
+
+	MonoException* exception = nullptr;
+	script_class->on_create_thunk(instance, &exception);
+
+	if (exception) {
+		log_script_exception((MonoObject*)exception);
 	}
 }
 
 void ScriptInstance::invoke_on_update(float ds) {
-	if (on_update_method) {
-		void* param = &ds;
-		script_class->invoke_method(instance, on_update_method, &param);
+	if (!script_class->on_update_thunk) {
+		return;
+	}
+
+	MonoException* exception = nullptr;
+	script_class->on_update_thunk(instance, ds, &exception);
+
+	if (exception) {
+		log_script_exception((MonoObject*)exception);
 	}
 }
 
 void ScriptInstance::invoke_on_destroy() {
-	if (on_destroy_method) {
-		script_class->invoke_method(instance, on_destroy_method);
+	if (!script_class->on_destroy_thunk) {
+		return;
+	}
+
+	MonoException* exception = nullptr;
+	script_class->on_destroy_thunk(instance, &exception);
+
+	if (exception) {
+		log_script_exception((MonoObject*)exception);
 	}
 }
 
@@ -113,84 +221,98 @@ Ref<ScriptClass> ScriptInstance::get_script_class() { return script_class; }
 
 MonoObject* ScriptInstance::get_managed_object() { return instance; }
 
-bool ScriptInstance::_get_field_value_internal(
-		const std::string& name, void* buffer) {
+const ScriptField* ScriptInstance::_find_field(const std::string& name) const {
 	const auto& fields = script_class->get_fields();
-	auto it = fields.find(name);
+
+	const auto it = fields.find(name);
 	if (it == fields.end()) {
-		return false;
+		return nullptr;
 	}
 
-	const ScriptField& field = it->second;
+	return &it->second;
+}
 
-	if (field.type != ScriptFieldType::ENTITY) {
-		mono_field_get_value(instance, field.class_field, buffer);
-	} else {
-		MonoObject* entity_object = (MonoObject*)malloc(sizeof(MonoObject));
-		mono_field_get_value(instance, field.class_field, entity_object);
+bool ScriptInstance::_get_field_value_internal(
+		const ScriptField& field, void* buffer, size_t size) {
+	// references to unknown types can not be handled as bytes
+	if (field.type == ScriptFieldType::NONE) {
+		return false;
+	}
 
-		if (!entity_object) {
-			return false;
-		}
+	if (field.type != ScriptFieldType::ENTITY) {
+		EVE_ASSERT(field.offset >= sizeof(MonoObject));
 
-		MonoProperty* id_property = mono_class_get_property_from_name(
-				ScriptEngine::get_entity_class().get_mono_class(), "Id");
+		memcpy(buffer, (uint8_t*)instance + field.offset,
+				std::min<size_t>(field.size, size));
+		return true;
+	}
 
-		if (!id_property) {
-			return false;
-		}
+	MonoObject* entity_object = nullptr;
+	mono_field_get_value(instance, field.class_field, &entity_object);
 
-		MonoObject* id_value = mono_property_get_value(
-				id_property, entity_object, nullptr, nullptr);
+	if (!entity_object) {
+		return false;
+	}
 
-		memcpy(buffer, mono_object_unbox(id_value), sizeof(UID));
+	MonoProperty* id_property = mono_class_get_property_from_name(
+			ScriptEngine::get_entity_class().get_mono_class(), "Id");
 
-		free(entity_object);
+	if (!id_property) {
+		return false;
 	}
 
+	MonoObject* id_value = mono_property_get_value(
+			id_property, entity_object, nullptr, nullptr);
+
+	memcpy(buffer, mono_object_unbox(id_value), std::min(sizeof(UID), size));
+
 	return true;
 }
 
 bool ScriptInstance::_set_field_value_internal(
-		const std::string& name, const void* value) {
-	const auto& fields = script_class->get_fields();
-	auto it = fields.find(name);
-	if (it == fields.end()) {
+		const ScriptField& field, const void* value, size_t size) {
+	// writing a reference as bytes would skip the write barrier of the gc
+	if (field.type == ScriptFieldType::NONE) {
 		return false;
 	}
 
-	const ScriptField& field = it->second;
+	// value types live inside the object, the gc does not need to know
+	if (field.type != ScriptFieldType::ENTITY) {
+		EVE_ASSERT(field.offset >= sizeof(MonoObject));
 
-	void* data = (void*)value;
+		memcpy((uint8_t*)instance + field.offset, value,
+				std::min<size_t>(field.size, size));
+		return true;
+	}
 
-	if (field.type == ScriptFieldType::ENTITY) {
-		UID uuid = *(UID*)value;
+	UID uuid = *(UID*)value;
 
-		Entity entity = SceneManager::get_active()->find_by_id(uuid);
-		if (!entity) {
-			EVE_LOG_WARNING(
-					"Unable to set entity instance of {}.", (uint64_t)uuid);
-			return false;
-		}
+	Entity entity = SceneManager::get_active()->find_by_id(uuid);
+	if (!entity) {
+		EVE_LOG_WARNING("Unable to set entity instance of {}.", (uint64_t)uuid);
+		return false;
+	}
 
-		MonoObject* managed_instance = ScriptEngine::get_managed_instance(uuid);
-		if (managed_instance) {
-			data = (void*)managed_instance;
-		} else {
-			EVE_LOG_VERBOSE_WARNING(
-					"Entity {}, does not have an managed script "
-					"instance. Using default "
-					"instead.",
-					entity.get_name());
-
-			ScriptInstance entity_instance(
-					create_ref<ScriptClass>(ScriptEngine::get_entity_class()),
-					entity);
-
-			data = (void*)entity_instance.instance;
-		}
+	void* data = nullptr;
+
+	MonoObject* managed_instance = ScriptEngine::get_managed_instance(uuid);
+	if (managed_instance) {
+		data = (void*)managed_instance;
+	} else {
+		EVE_LOG_VERBOSE_WARNING(
+				"Entity {}, does not have an managed script "
+				"instance. Using default "
+				"instead.",
+				entity.get_name());
+
+		ScriptInstance entity_instance(
+				create_ref<ScriptClass>(ScriptEngine::get_entity_class()),
+				entity);
+
+		data = (void*)entity_instance.instance;
 	}
 
+	// references go through mono for the write barrier of the gc
 	mono_field_set_value(instance, field.class_field, data);
 
 	return true;
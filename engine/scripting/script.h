@@ -11,6 +11,8 @@ typedef struct _MonoAssembly MonoAssembly;
 typedef struct _MonoImage MonoImage;
 typedef struct _MonoClassField MonoClassField;
 typedef struct _MonoString MonoString;
+typedef struct _MonoArray MonoArray;
+typedef struct _MonoException MonoException;
 }
 
 enum class ScriptFieldType {
@@ -42,16 +44,42 @@ const char* serialize_script_field_type(ScriptFieldType field_type);
 
 ScriptFieldType deserialize_script_field_type(std::string_view field_type);
 
+// logs the message of a managed exception
+void log_script_exception(MonoObject* exception);
+
+// the same message is logged once in SCRIPT_EXCEPTION_LOG_INTERVAL seconds
+// along with how many times it was skipped, so a script throwing every frame
+// does not flood the log
+void log_script_exception_message(std::string_view message);
+
+inline constexpr float SCRIPT_EXCEPTION_LOG_INTERVAL = 5.0f;
+
+// OnCreate and OnDestroy
+typedef void (*ScriptCallbackThunk)(
+		MonoObject* instance, MonoException** exception);
+
+// OnUpdate
+typedef void (*ScriptUpdateThunk)(
+		MonoObject* instance, float dt, MonoException** exception);
+
 struct ScriptField {
 	ScriptFieldType type;
 	std::string name;
 
 	MonoClassField* class_field;
+
+	// location of the value inside the managed object, value type fields are
+	// read and written there directly
+	uint32_t offset = 0;
+	uint32_t size = 0;
 };
 
 // ScriptField + data storage
 struct ScriptFieldInstance {
 	ScriptField field;
+	// id of the ScriptClass the field was taken from, values are applied to
+	// its instances without looking the field up by name again
+	uint32_t class_id = 0;
 
 	inline ScriptFieldInstance() { memset(buffer, 0, sizeof(buffer)); }
 
@@ -91,17 +119,40 @@ public:
 
 	const std::unordered_map<std::string, ScriptField>& get_fields() const;
 
-	MonoClass* get_mono_class();
+	MonoClass* get_mono_class() const;
+
+	// namespace and name, the key of the class in the script engine
+	const std::string& get_full_name() const;
+
+	// unique for every loaded class, the fields of a class with the same id
+	// are the same
+	uint32_t get_id() const;
 
 private:
+	uint32_t id = 0;
+
 	std::string class_namespace;
 	std::string class_name;
+	std::string full_name;
 
 	std::unordered_map<std::string, ScriptField> fields;
 
 	MonoClass* mono_class = nullptr;
 
+	// looked up once per class instead of once per instance
+	MonoMethod* constructor = nullptr;
+	MonoMethod* on_create_method = nullptr;
+	MonoMethod* on_update_method = nullptr;
+	MonoMethod* on_destroy_method = nullptr;
+
+	// called directly instead of through mono_runtime_invoke, which boxes
+	// the arguments on every call
+	ScriptCallbackThunk on_create_thunk = nullptr;
+	ScriptUpdateThunk on_update_thunk = nullptr;
+	ScriptCallbackThunk on_destroy_thunk = nullptr;
+
 	friend class ScriptEngine;
+	friend class ScriptInstance;
 };
 
 class ScriptInstance {
@@ -118,29 +169,45 @@ public:
 	Ref<ScriptClass> get_script_class();
 
 	template <typename T>
-	inline T get_field_value(const std::string& name) {
+	inline T get_field_value(const ScriptField& field) {
 		static_assert(sizeof(T) <= 16, "Type too large!");
 
-		bool success = _get_field_value_internal(name, field_value_buffer);
-		if (!success) {
-			return T();
-		}
+		T value{};
+		_get_field_value_internal(field, &value, sizeof(T));
 
-		return *(T*)field_value_buffer;
+		return value;
 	}
 
 	template <typename T>
-	inline void set_field_value(const std::string& name, T value) {
+	inline void set_field_value(const ScriptField& field, T value) {
 		static_assert(sizeof(T) <= 16, "Type too large!");
 
-		_set_field_value_internal(name, &value);
+		_set_field_value_internal(field, &value, sizeof(T));
+	}
+
+	template <typename T>
+	inline T get_field_value(const std::string& name) {
+		const ScriptField* field = _find_field(name);
+		return field ? get_field_value<T>(*field) : T();
+	}
+
+	template <typename T>
+	inline void set_field_value(const std::string& name, T value) {
+		if (const ScriptField* field = _find_field(name)) {
+			set_field_value(*field, value);
+		}
 	}
 
 	MonoObject* get_managed_object();
 
 private:
-	bool _get_field_value_internal(const std::string& name, void* buffer);
-	bool _set_field_value_internal(const std::string& name, const void* value);
+	const ScriptField* _find_field(const std::string& name) const;
+
+	// at most size bytes are copied from or to the value
+	bool _get_field_value_internal(
+			const ScriptField& field, void* buffer, size_t size);
+	bool _set_field_value_internal(
+			const ScriptField& field, const void* value, size_t size);
 
 private:
 	Ref<ScriptClass> script_class;
@@ -151,8 +218,6 @@ private:
 	MonoMethod* on_update_method = nullptr;
 	MonoMethod* on_destroy_method = nullptr;
 
-	inline static char field_value_buffer[16];
-
 	friend class ScriptEngine;
 	friend struct ScriptFieldInstance;
 };
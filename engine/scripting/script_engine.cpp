@@ -2,10 +2,14 @@
 
 #include "core/application.h"
 #include "core/file_system.h"
+#include "core/timer.h"
 #include "debug/log.h"
 #include "project/project.h"
 #include "scene/components.h"
+#include "scripting/script_events.h"
 #include "scripting/script_glue.h"
+#include "scripting/script_jobs.h"
+#include "scripting/script_profiler.h"
 
 #include <mono/jit/jit.h>
 #include <mono/metadata/appdomain.h>
@@ -38,15 +42,20 @@ static std::unordered_map<std::string, ScriptFieldType>
 			{ "EveEngine.Entity", ScriptFieldType::ENTITY },
 		};
 
-inline static MonoAssembly* load_mono_assembly(
-		const fs::path& assembly_path, bool load_pdb = false) {
-	ScopedBuffer file_data = file_system::read_to_buffer(assembly_path);
+inline static MonoAssembly* load_mono_assembly(const fs::path& assembly_path,
+		const Buffer& data, const Buffer& pdb_data, bool is_aot) {
+	const std::string image_name = fs::absolute(assembly_path).string();
 
 	// NOTE: We can't use this image for anything other than loading the
 	// assembly because this image doesn't have a reference to the assembly
 	MonoImageOpenStatus status;
-	MonoImage* image = mono_image_open_from_data_full(
-			file_data.as<char>(), file_data.get_size(), 1, &status, 0);
+	// mono looks for the AOT image next to the path the image is named
+	// after, named images are cached by mono so they can not be reloaded
+	MonoImage* image = is_aot
+			? mono_image_open_from_data_with_name((char*)data.data,
+					  data.size, 1, &status, 0, image_name.c_str())
+			: mono_image_open_from_data_full(
+					  (char*)data.data, data.size, 1, &status, 0);
 
 	if (status != MONO_IMAGE_OK) {
 		const char* error_message = mono_image_strerror(status);
@@ -54,18 +63,9 @@ inline static MonoAssembly* load_mono_assembly(
 		return nullptr;
 	}
 
-	if (load_pdb) {
-		fs::path pdb_path = assembly_path;
-		pdb_path.replace_extension(".pdb");
-
-		if (fs::exists(pdb_path)) {
-			ScopedBuffer pdb_file_data = file_system::read_to_buffer(pdb_path);
-			mono_debug_open_image_from_memory(image,
-					pdb_file_data.as<const mono_byte>(),
-					pdb_file_data.get_size());
-
-			EVE_LOG_VERBOSE_TRACE("Loaded PDB: {}", pdb_path.string());
-		}
+	if (pdb_data) {
+		mono_debug_open_image_from_memory(
+				image, (const mono_byte*)pdb_data.data, pdb_data.size);
 	}
 
 	const std::string path_string = assembly_path.string();
@@ -76,6 +76,65 @@ inline static MonoAssembly* load_mono_assembly(
 	return assembly;
 }
 
+// reads the pdb next to the assembly if there is one
+inline static Buffer read_pdb(const fs::path& assembly_path) {
+	fs::path pdb_path = assembly_path;
+	pdb_path.replace_extension(".pdb");
+
+	if (!fs::exists(pdb_path)) {
+		return Buffer();
+	}
+
+	EVE_LOG_VERBOSE_TRACE("Loaded PDB: {}", pdb_path.string());
+
+	return file_system::read_to_buffer(pdb_path);
+}
+
+inline static MonoAssembly* load_mono_assembly(
+		const fs::path& assembly_path, bool load_pdb, bool is_aot) {
+	ScopedBuffer file_data = file_system::read_to_buffer(assembly_path);
+	ScopedBuffer pdb_file_data = load_pdb ? read_pdb(assembly_path) : Buffer();
+
+	return load_mono_assembly(assembly_path,
+			Buffer(file_data.get_data(), file_data.get_size()),
+			Buffer(pdb_file_data.get_data(), pdb_file_data.get_size()),
+			is_aot);
+}
+
+// EveEngine.ScriptDispatcher.UpdateEntities
+typedef void (*UpdateEntitiesThunk)(MonoArray* entities, int32_t count,
+		float dt, MonoArray* timings, MonoException** exception);
+
+// EveEngine.ScriptDispatcher.DispatchEvents
+typedef void (*DispatchEventsThunk)(MonoException** exception);
+
+// EveEngine.ScriptDispatcher.ResetEvents
+typedef void (*ResetEventsThunk)(MonoException** exception);
+
+// Started instances of a script class, their managed objects are kept in a
+// managed array in the same order so that the class is updated with a
+// single call.
+struct UpdateBatch {
+	ScriptClass* script_class = nullptr;
+	// handle of the Entity[], the array may be moved by the gc
+	uint32_t gc_handle = 0;
+	uint32_t capacity = 0;
+	std::vector<UID> entities;
+};
+
+struct UpdateSlot {
+	uint32_t batch;
+	uint32_t index;
+};
+
+// public field values of a running instance, they are put back into the new
+// instance after an assembly reload
+struct ScriptInstanceState {
+	UID entity_id;
+	bool is_updated;
+	ScriptFieldMap fields;
+};
+
 struct ScriptEngineData {
 	MonoDomain* root_domain = nullptr;
 	MonoDomain* app_domain = nullptr;
@@ -89,17 +148,37 @@ struct ScriptEngineData {
 	fs::path core_assembly_path;
 	fs::path app_assembly_path;
 
+	// script_core does not change while the engine runs, reloads only read
+	// the app assembly from disk
+	Buffer core_assembly_data;
+	Buffer core_pdb_data;
+
 	ScriptClass entity_class;
 
 	std::unordered_map<std::string, Ref<ScriptClass>> entity_classes;
 	std::unordered_map<UID, Ref<ScriptInstance>> entity_instances;
 	std::unordered_map<UID, ScriptFieldMap> entity_script_fields;
 
+	UpdateEntitiesThunk update_entities_thunk = nullptr;
+	DispatchEventsThunk dispatch_events_thunk = nullptr;
+	ResetEventsThunk reset_events_thunk = nullptr;
+	std::vector<UpdateBatch> update_batches;
+	std::unordered_map<ScriptClass*, uint32_t> update_batch_indices;
+	std::unordered_map<UID, UpdateSlot> update_slots;
+
+	// double[] the dispatcher writes the time of every entity of a batch
+	// into, only passed while the script profiler is enabled
+	uint32_t update_timings_handle = 0;
+	uint32_t update_timings_capacity = 0;
+
+	std::vector<ScriptInstanceState> reload_states;
+
 	Scope<filewatch::FileWatch<std::string>> app_assembly_watcher;
 	bool assembly_reload_pending = false;
 	bool is_runtime = false;
 
 	bool enable_debugging = true;
+	ScriptExecutionMode execution_mode = ScriptExecutionMode::JIT;
 
 	Scene* scene_context = nullptr;
 };
@@ -132,7 +211,47 @@ inline static ScriptFieldType mono_type_to_script_field_type(
 	return it->second;
 }
 
-void ScriptEngine::init(bool is_runtime) {
+const char* serialize_script_execution_mode(ScriptExecutionMode mode) {
+	switch (mode) {
+		case ScriptExecutionMode::JIT:
+			return "JIT";
+		case ScriptExecutionMode::AOT:
+			return "AOT";
+		case ScriptExecutionMode::FULL_AOT:
+			return "FULL_AOT";
+		case ScriptExecutionMode::LLVM_AOT:
+			return "LLVM_AOT";
+		default:
+			return "Unknown";
+	}
+}
+
+ScriptExecutionMode deserialize_script_execution_mode(std::string_view mode) {
+	if (mode == "AOT")
+		return ScriptExecutionMode::AOT;
+	if (mode == "FULL_AOT")
+		return ScriptExecutionMode::FULL_AOT;
+	if (mode == "LLVM_AOT")
+		return ScriptExecutionMode::LLVM_AOT;
+
+	return ScriptExecutionMode::JIT;
+}
+
+inline static MonoAotMode script_execution_mode_to_aot_mode(
+		ScriptExecutionMode mode) {
+	switch (mode) {
+		case ScriptExecutionMode::AOT:
+			return MONO_AOT_MODE_NORMAL;
+		case ScriptExecutionMode::FULL_AOT:
+			return MONO_AOT_MODE_FULL;
+		case ScriptExecutionMode::LLVM_AOT:
+			return MONO_AOT_MODE_LLVMONLY;
+		default:
+			return MONO_AOT_MODE_NONE;
+	}
+}
+
+void ScriptEngine::init(const ScriptEngineSettings& settings) {
 	EVE_PROFILE_FUNCTION();
 
 	if (s_data) {
@@ -140,13 +259,27 @@ void ScriptEngine::init(bool is_runtime) {
 		return;
 	}
 
+	Timer timer;
+
 	s_data = new ScriptEngineData();
-	s_data->is_runtime = is_runtime;
+	s_data->is_runtime = settings.is_runtime;
+	s_data->enable_debugging = settings.enable_debugging;
+	s_data->execution_mode = settings.execution_mode;
+
+	// the debugger agent needs the jit to place its breakpoints
+	if (s_data->enable_debugging &&
+			s_data->execution_mode != ScriptExecutionMode::JIT) {
+		EVE_LOG_WARNING("Script debugging is only supported with JIT, it is "
+						"disabled.");
+		s_data->enable_debugging = false;
+	}
 
 	_init_mono();
 
 	script_glue::register_functions();
 
+	script_events::init();
+
 	bool status = load_assembly("script_core.dll");
 	if (!status) {
 		EVE_LOG_ERROR("[ScriptEngine] Could not load script_core assembly.");
@@ -167,7 +300,13 @@ void ScriptEngine::init(bool is_runtime) {
 	// Retrieve and instantiate class
 	s_data->entity_class = ScriptClass("EveEngine", "Entity", true);
 
-	EVE_LOG_VERBOSE_TRACE("ScriptEngine initialized!");
+	script_jobs::init(s_data->app_domain, s_data->core_assembly_image);
+
+	// compare the modes with this, the rest of the compilation cost shows
+	// up in the first frames and the script profiler
+	EVE_LOG_INFO("ScriptEngine initialized in {:.2f} ms ({}).",
+			timer.get_elapsed_milliseconds(),
+			serialize_script_execution_mode(s_data->execution_mode));
 }
 
 void ScriptEngine::reinit() {
@@ -187,8 +326,13 @@ void ScriptEngine::shutdown() {
 		return;
 	}
 
+	script_jobs::shutdown();
+
 	_shutdown_mono();
 
+	s_data->core_assembly_data.release();
+	s_data->core_pdb_data.release();
+
 	delete s_data;
 	s_data = nullptr;
 
@@ -205,15 +349,59 @@ bool ScriptEngine::load_assembly(const fs::path& filepath) {
 	s_data->app_domain = mono_domain_create_appdomain(friendly_name, nullptr);
 	mono_domain_set(s_data->app_domain, true);
 
+	if (!s_data->core_assembly_data || s_data->core_assembly_path != filepath) {
+		s_data->core_assembly_data.release();
+		s_data->core_pdb_data.release();
+
+		s_data->core_assembly_data = file_system::read_to_buffer(filepath);
+		if (s_data->enable_debugging) {
+			s_data->core_pdb_data = read_pdb(filepath);
+		}
+	}
+
 	s_data->core_assembly_path = filepath;
-	s_data->core_assembly =
-			load_mono_assembly(filepath, s_data->enable_debugging);
+	s_data->core_assembly = load_mono_assembly(filepath,
+			s_data->core_assembly_data, s_data->core_pdb_data,
+			s_data->execution_mode != ScriptExecutionMode::JIT);
 	if (s_data->core_assembly == nullptr) {
 		return false;
 	}
 
 	s_data->core_assembly_image =
 			mono_assembly_get_image(s_data->core_assembly);
+
+	// thunks skip the argument boxing of mono_runtime_invoke
+	MonoClass* dispatcher_class = mono_class_from_name(
+			s_data->core_assembly_image, "EveEngine", "ScriptDispatcher");
+	MonoMethod* update_method = dispatcher_class
+			? mono_class_get_method_from_name(
+					  dispatcher_class, "UpdateEntities", 4)
+			: nullptr;
+	MonoMethod* dispatch_events_method = dispatcher_class
+			? mono_class_get_method_from_name(
+					  dispatcher_class, "DispatchEvents", 0)
+			: nullptr;
+	MonoMethod* reset_events_method = dispatcher_class
+			? mono_class_get_method_from_name(
+					  dispatcher_class, "ResetEvents", 0)
+			: nullptr;
+
+	if (!update_method || !dispatch_events_method || !reset_events_method) {
+		EVE_LOG_ERROR("Could not find the script dispatcher, entities will "
+					  "not be updated.");
+		s_data->update_entities_thunk = nullptr;
+		s_data->dispatch_events_thunk = nullptr;
+		s_data->reset_events_thunk = nullptr;
+		return true;
+	}
+
+	s_data->update_entities_thunk = (UpdateEntitiesThunk)
+			mono_method_get_unmanaged_thunk(update_method);
+	s_data->dispatch_events_thunk = (DispatchEventsThunk)
+			mono_method_get_unmanaged_thunk(dispatch_events_method);
+	s_data->reset_events_thunk = (ResetEventsThunk)
+			mono_method_get_unmanaged_thunk(reset_events_method);
+
 	return true;
 }
 
@@ -222,7 +410,8 @@ bool ScriptEngine::load_app_assembly(const fs::path& filepath) {
 
 	s_data->app_assembly_path = filepath;
 	s_data->app_assembly =
-			load_mono_assembly(filepath, s_data->enable_debugging);
+			load_mono_assembly(filepath, s_data->enable_debugging,
+					s_data->execution_mode != ScriptExecutionMode::JIT);
 	if (s_data->app_assembly == nullptr) {
 		return false;
 	}
@@ -242,6 +431,16 @@ bool ScriptEngine::load_app_assembly(const fs::path& filepath) {
 void ScriptEngine::reload_assembly() {
 	EVE_PROFILE_FUNCTION();
 
+	Timer timer;
+
+	// instances of the running scene die with the domain
+	_save_instance_states();
+
+	// workers are attached to the domain that is unloaded
+	script_jobs::shutdown();
+
+	script_glue::clear_scene_loads();
+
 	mono_domain_set(mono_get_root_domain(), false);
 
 	mono_domain_unload(s_data->app_domain);
@@ -255,7 +454,12 @@ void ScriptEngine::reload_assembly() {
 	// Retrieve and instantiate class
 	s_data->entity_class = ScriptClass("EveEngine", "Entity", true);
 
-	EVE_LOG_INFO("Scipt assembly reloaded.");
+	_restore_instance_states();
+
+	script_jobs::init(s_data->app_domain, s_data->core_assembly_image);
+
+	EVE_LOG_INFO("Script assembly reloaded in {:.2f} ms.",
+			timer.get_elapsed_milliseconds());
 }
 
 bool ScriptEngine::does_entity_class_exists(const std::string& fullClassName) {
@@ -278,18 +482,21 @@ void ScriptEngine::create_entity_instance(Entity entity) {
 
 	s_data->entity_instances[entity_id] = instance;
 
-	if (s_data->entity_script_fields.find(entity_id) !=
-			s_data->entity_script_fields.end()) {
-		const ScriptFieldMap& field_map =
-				s_data->entity_script_fields.at(entity_id);
-		for (const auto& [name, field_instance] : field_map) {
-			if (is_managed_script_field_type(field_instance.field.type)) {
-				continue;
-			}
+	_set_unmanaged_field_values(*instance, entity_id);
+}
 
-			instance->_set_field_value_internal(name, field_instance.buffer);
-		}
+void ScriptEngine::reset_entity_instance(Entity entity) {
+	EVE_PROFILE_FUNCTION();
+
+	UID entity_id = entity.get_uid();
+
+	Ref<ScriptInstance> instance = get_entity_script_instance(entity_id);
+	if (!instance) {
+		create_entity_instance(entity);
+		return;
 	}
+
+	_set_unmanaged_field_values(*instance, entity_id);
 }
 
 void ScriptEngine::set_entity_managed_field_values(Entity entity) {
@@ -305,18 +512,250 @@ void ScriptEngine::set_entity_managed_field_values(Entity entity) {
 
 	if (s_data->entity_script_fields.find(entity_id) !=
 			s_data->entity_script_fields.end()) {
-		const ScriptFieldMap& field_map =
-				s_data->entity_script_fields.at(entity_id);
-		for (const auto& [name, field_instance] : field_map) {
+		ScriptFieldMap& field_map = s_data->entity_script_fields.at(entity_id);
+		for (auto& [name, field_instance] : field_map) {
 			if (!is_managed_script_field_type(field_instance.field.type)) {
 				continue;
 			}
 
-			instance->_set_field_value_internal(name, field_instance.buffer);
+			_set_field_value(*instance, name, field_instance);
 		}
 	}
 }
 
+void ScriptEngine::_set_unmanaged_field_values(
+		ScriptInstance& instance, UID entity_id) {
+	const auto it = s_data->entity_script_fields.find(entity_id);
+	if (it == s_data->entity_script_fields.end()) {
+		return;
+	}
+
+	for (auto& [name, field_instance] : it->second) {
+		if (is_managed_script_field_type(field_instance.field.type)) {
+			continue;
+		}
+
+		_set_field_value(instance, name, field_instance);
+	}
+}
+
+void ScriptEngine::_set_field_value(ScriptInstance& instance,
+		const std::string& name, ScriptFieldInstance& field_instance) {
+	const ScriptClass& script_class = *instance.script_class;
+
+	// the field is looked up once per class, after that it is applied with
+	// the cached handle and offset
+	if (field_instance.class_id != script_class.get_id()) {
+		const auto& fields = script_class.get_fields();
+
+		const auto it = fields.find(name);
+		if (it != fields.end()) {
+			field_instance.field = it->second;
+		} else {
+			field_instance.field.class_field = nullptr;
+		}
+
+		field_instance.class_id = script_class.get_id();
+	}
+
+	// the class has no field with the name anymore
+	if (!field_instance.field.class_field) {
+		return;
+	}
+
+	instance._set_field_value_internal(field_instance.field,
+			field_instance.buffer, sizeof(field_instance.buffer));
+}
+
+void ScriptEngine::_save_instance_states() {
+	EVE_PROFILE_FUNCTION();
+
+	s_data->reload_states.clear();
+	s_data->reload_states.reserve(s_data->entity_instances.size());
+
+	for (const auto& [entity_id, instance] : s_data->entity_instances) {
+		ScriptInstanceState& state = s_data->reload_states.emplace_back();
+		state.entity_id = entity_id;
+		state.is_updated = s_data->update_slots.contains(entity_id);
+
+		for (const auto& [name, field] : instance->script_class->get_fields()) {
+			// strings, arrays and other objects belong to the old domain
+			if (field.type == ScriptFieldType::NONE) {
+				continue;
+			}
+
+			ScriptFieldInstance& field_instance = state.fields[name];
+			field_instance.field = field;
+
+			instance->_get_field_value_internal(field, field_instance.buffer,
+					sizeof(field_instance.buffer));
+		}
+	}
+
+	// the managed arrays of the batches belong to the old domain
+	_clear_update_batches();
+	s_data->entity_instances.clear();
+}
+
+void ScriptEngine::_restore_instance_states() {
+	EVE_PROFILE_FUNCTION();
+
+	Scene* scene = s_data->scene_context;
+	if (!scene) {
+		s_data->reload_states.clear();
+		return;
+	}
+
+	const auto restore_fields = [](bool managed) {
+		for (ScriptInstanceState& state : s_data->reload_states) {
+			Ref<ScriptInstance> instance =
+					get_entity_script_instance(state.entity_id);
+			if (!instance) {
+				continue;
+			}
+
+			const auto& fields = instance->script_class->get_fields();
+
+			for (auto& [name, field_instance] : state.fields) {
+				if (is_managed_script_field_type(field_instance.field.type) !=
+						managed) {
+					continue;
+				}
+
+				// null entity fields stay null
+				if (managed && !field_instance.get_value<UID>()) {
+					continue;
+				}
+
+				// fields that were removed or changed their type start over
+				const auto it = fields.find(name);
+				if (it == fields.end() ||
+						it->second.type == ScriptFieldType::NONE ||
+						it->second.type != field_instance.field.type) {
+					continue;
+				}
+
+				instance->_set_field_value_internal(it->second,
+						field_instance.buffer, sizeof(field_instance.buffer));
+			}
+		}
+	};
+
+	for (const ScriptInstanceState& state : s_data->reload_states) {
+		Entity entity = scene->find_by_id(state.entity_id);
+		if (!entity || !entity.has_component<ScriptComponent>()) {
+			continue;
+		}
+
+		create_entity_instance(entity);
+	}
+
+	// entity fields point to the instances, so they go after all of them
+	// were created
+	restore_fields(false);
+	restore_fields(true);
+
+	// instances keep their state, so OnCreate is not called again
+	for (const ScriptInstanceState& state : s_data->reload_states) {
+		Ref<ScriptInstance> instance =
+				get_entity_script_instance(state.entity_id);
+		if (instance && state.is_updated) {
+			_add_to_update_batch(state.entity_id, *instance);
+		}
+	}
+
+	s_data->reload_states.clear();
+}
+
+void ScriptEngine::_clear_update_batches() {
+	for (const UpdateBatch& batch : s_data->update_batches) {
+		if (batch.gc_handle) {
+			mono_gchandle_free(batch.gc_handle);
+		}
+	}
+
+	s_data->update_batches.clear();
+	s_data->update_batch_indices.clear();
+	s_data->update_slots.clear();
+
+	if (s_data->update_timings_handle) {
+		mono_gchandle_free(s_data->update_timings_handle);
+		s_data->update_timings_handle = 0;
+		s_data->update_timings_capacity = 0;
+	}
+}
+
+void ScriptEngine::_add_to_update_batch(
+		UID entity_id, ScriptInstance& instance) {
+	// classes without OnUpdate are never dispatched
+	if (!instance.on_update_method || !s_data->update_entities_thunk ||
+			s_data->update_slots.contains(entity_id)) {
+		return;
+	}
+
+	const auto [it, inserted] = s_data->update_batch_indices.try_emplace(
+			instance.script_class.get(), s_data->update_batches.size());
+	if (inserted) {
+		s_data->update_batches.emplace_back().script_class =
+				instance.script_class.get();
+	}
+
+	UpdateBatch& batch = s_data->update_batches[it->second];
+
+	const uint32_t index = batch.entities.size();
+	if (index == batch.capacity) {
+		const uint32_t capacity = std::max(batch.capacity * 2, 64u);
+		MonoArray* entities = mono_array_new(s_data->app_domain,
+				s_data->entity_class.get_mono_class(), capacity);
+
+		if (batch.gc_handle) {
+			MonoArray* old_entities =
+					(MonoArray*)mono_gchandle_get_target(batch.gc_handle);
+			for (uint32_t i = 0; i < index; i++) {
+				mono_array_setref(entities, i,
+						mono_array_get(old_entities, MonoObject*, i));
+			}
+
+			mono_gchandle_free(batch.gc_handle);
+		}
+
+		batch.gc_handle = mono_gchandle_new((MonoObject*)entities, false);
+		batch.capacity = capacity;
+	}
+
+	MonoArray* entities = (MonoArray*)mono_gchandle_get_target(batch.gc_handle);
+	mono_array_setref(entities, index, instance.get_managed_object());
+
+	batch.entities.push_back(entity_id);
+	s_data->update_slots[entity_id] = { it->second, index };
+}
+
+void ScriptEngine::_remove_from_update_batch(UID entity_id) {
+	const auto slot_it = s_data->update_slots.find(entity_id);
+	if (slot_it == s_data->update_slots.end()) {
+		return;
+	}
+
+	const UpdateSlot slot = slot_it->second;
+	s_data->update_slots.erase(slot_it);
+
+	UpdateBatch& batch = s_data->update_batches[slot.batch];
+	MonoArray* entities = (MonoArray*)mono_gchandle_get_target(batch.gc_handle);
+
+	// the last instance takes the place of the removed one
+	const uint32_t last = batch.entities.size() - 1;
+	if (slot.index != last) {
+		mono_array_setref(entities, slot.index,
+				mono_array_get(entities, MonoObject*, last));
+
+		batch.entities[slot.index] = batch.entities[last];
+		s_data->update_slots[batch.entities[slot.index]].index = slot.index;
+	}
+
+	mono_array_setref(entities, last, nullptr);
+	batch.entities.pop_back();
+}
+
 void ScriptEngine::invoke_on_create_entity(Entity entity) {
 	EVE_PROFILE_FUNCTION();
 
@@ -329,7 +768,14 @@ void ScriptEngine::invoke_on_create_entity(Entity entity) {
 
 	Ref<ScriptInstance> instance = get_entity_script_instance(entity_id);
 
-	instance->invoke_on_create();
+	{
+		ScriptProfileScope profile_scope(
+				instance->script_class->get_full_name(), entity_id,
+				ScriptCallback::ON_CREATE);
+		instance->invoke_on_create();
+	}
+
+	_add_to_update_batch(entity_id, *instance);
 }
 
 void ScriptEngine::invoke_on_update_entity(Entity entity, float dt) {
@@ -342,6 +788,9 @@ void ScriptEngine::invoke_on_update_entity(Entity entity, float dt) {
 
 	UID entity_uuid = entity.get_uid();
 	if (auto instance = get_entity_script_instance(entity_uuid); instance) {
+		ScriptProfileScope profile_scope(
+				instance->script_class->get_full_name(), entity_uuid,
+				ScriptCallback::ON_UPDATE);
 		instance->invoke_on_update(dt);
 	} else {
 		EVE_LOG_ERROR("Could not find ScriptInstance for entity {}",
@@ -349,6 +798,121 @@ void ScriptEngine::invoke_on_update_entity(Entity entity, float dt) {
 	}
 }
 
+void ScriptEngine::update_entities(float dt) {
+	EVE_PROFILE_FUNCTION();
+
+	if (!s_data->scene_context) {
+		EVE_LOG_ERROR("Could not update entities scene context is not valid.");
+		return;
+	}
+
+	// events of the last frame are handled before the scripts update
+	if (s_data->dispatch_events_thunk) {
+		MonoException* exception = nullptr;
+		s_data->dispatch_events_thunk(&exception);
+
+		if (exception) {
+			log_script_exception((MonoObject*)exception);
+		}
+	}
+
+	const bool is_profiling = script_profiler::is_enabled();
+	script_profiler::on_frame();
+
+	// scripts may start new classes, so the batches are indexed
+	for (size_t i = 0; i < s_data->update_batches.size(); i++) {
+		const UpdateBatch& batch = s_data->update_batches[i];
+		if (batch.entities.empty()) {
+			continue;
+		}
+
+		MonoArray* entities =
+				(MonoArray*)mono_gchandle_get_target(batch.gc_handle);
+
+		// instances started during the call are updated from the next frame
+		const uint32_t count = batch.entities.size();
+
+		MonoArray* timings =
+				is_profiling ? _get_update_timings(count) : nullptr;
+
+		Timer timer;
+		const uint64_t allocation_count =
+				is_profiling ? script_profiler::get_allocation_count() : 0;
+
+		MonoException* exception = nullptr;
+		s_data->update_entities_thunk(
+				entities, (int32_t)count, dt, timings, &exception);
+
+		if (exception) {
+			log_script_exception((MonoObject*)exception);
+		}
+
+		if (is_profiling) {
+			_record_update_batch(i, count, timer.get_elapsed_milliseconds(),
+					script_profiler::get_allocation_count() - allocation_count);
+		}
+	}
+}
+
+void ScriptEngine::_reset_events() {
+	if (!s_data->reset_events_thunk) {
+		return;
+	}
+
+	MonoException* exception = nullptr;
+	s_data->reset_events_thunk(&exception);
+
+	if (exception) {
+		log_script_exception((MonoObject*)exception);
+	}
+}
+
+MonoArray* ScriptEngine::_get_update_timings(uint32_t count) {
+	if (count > s_data->update_timings_capacity) {
+		if (s_data->update_timings_handle) {
+			mono_gchandle_free(s_data->update_timings_handle);
+		}
+
+		const uint32_t capacity =
+				std::max(count, s_data->update_timings_capacity * 2);
+		MonoArray* timings = mono_array_new(
+				s_data->app_domain, mono_get_double_class(), capacity);
+
+		s_data->update_timings_handle =
+				mono_gchandle_new((MonoObject*)timings, false);
+		s_data->update_timings_capacity = capacity;
+	}
+
+	return (MonoArray*)mono_gchandle_get_target(s_data->update_timings_handle);
+}
+
+void ScriptEngine::_record_update_batch(uint32_t batch_index, uint32_t count,
+		double ms, uint64_t allocation_count) {
+	const UpdateBatch& batch = s_data->update_batches[batch_index];
+	const std::string& class_name = batch.script_class->get_full_name();
+
+	// instances released during the call moved other ones inside the batch,
+	// so their timings are close but not exact
+	const double* timings = mono_array_addr(
+			(MonoArray*)mono_gchandle_get_target(
+					s_data->update_timings_handle),
+			double, 0);
+
+	double max_ms = 0.0;
+	for (uint32_t i = 0; i < std::min<size_t>(count, batch.entities.size());
+			i++) {
+		script_profiler::record_entity(batch.entities[i], class_name,
+				ScriptCallback::ON_UPDATE, timings[i]);
+
+		max_ms = std::max(max_ms, timings[i]);
+	}
+
+	// allocations can not be told apart inside of a batch, they only go to
+	// the class
+	script_profiler::record_class_batch(class_name, ScriptCallback::ON_UPDATE,
+			ms, max_ms, allocation_count, count);
+}
+
 void ScriptEngine::invoke_on_destroy_entity(Entity entity) {
 	EVE_PROFILE_FUNCTION();
 
@@ -359,6 +923,11 @@ void ScriptEngine::invoke_on_destroy_entity(Entity entity) {
 
 	UID entity_uuid = entity.get_uid();
 	if (auto instance = get_entity_script_instance(entity_uuid); instance) {
+		_remove_from_update_batch(entity_uuid);
+
+		ScriptProfileScope profile_scope(
+				instance->script_class->get_full_name(), entity_uuid,
+				ScriptCallback::ON_DESTROY);
 		instance->invoke_on_destroy();
 	} else {
 		EVE_LOG_ERROR("Could not find ScriptInstance for entity {}",
@@ -377,7 +946,9 @@ Ref<ScriptInstance> ScriptEngine::get_entity_script_instance(UID entity_id) {
 	return it->second;
 }
 
-ScriptClass ScriptEngine::get_entity_class() { return s_data->entity_class; }
+const ScriptClass& ScriptEngine::get_entity_class() {
+	return s_data->entity_class;
+}
 
 Ref<ScriptClass> ScriptEngine::get_entity_class(const std::string& name) {
 	const auto it = s_data->entity_classes.find(name);
@@ -390,11 +961,24 @@ Ref<ScriptClass> ScriptEngine::get_entity_class(const std::string& name) {
 
 void ScriptEngine::on_runtime_start(Scene* scene) {
 	s_data->scene_context = scene;
+
+	script_events::set_enabled(true);
+	_reset_events();
 }
 
 void ScriptEngine::on_runtime_stop() {
+	// jobs scheduled from OnDestroy still need the scene
+	script_jobs::complete_scheduled();
+
+	script_events::set_enabled(false);
+	_reset_events();
+
+	script_glue::clear_scene_loads();
+
 	s_data->scene_context = nullptr;
 	s_data->entity_instances.clear();
+
+	_clear_update_batches();
 }
 
 std::unordered_map<std::string, Ref<ScriptClass>>
@@ -447,6 +1031,14 @@ void ScriptEngine::_init_mono() {
 		mono_debug_init(MONO_DEBUG_FORMAT_MONO);
 	}
 
+	// the editor keeps track of the allocations of the scripts
+	script_profiler::init(!s_data->is_runtime);
+
+	if (s_data->execution_mode != ScriptExecutionMode::JIT) {
+		mono_jit_set_aot_mode(
+				script_execution_mode_to_aot_mode(s_data->execution_mode));
+	}
+
 	s_data->root_domain = mono_jit_init("EveJITRuntime");
 	EVE_ASSERT(s_data->root_domain);
 
@@ -484,7 +1076,10 @@ MonoObject* ScriptEngine::_instantiate_class(MonoClass* mono_class) {
 void ScriptEngine::_load_assembly_classes() {
 	EVE_PROFILE_FUNCTION();
 
-	s_data->entity_classes.clear();
+	// classes that are still there keep their ScriptClass object, so the refs
+	// held outside of the engine stay valid
+	std::unordered_map<std::string, Ref<ScriptClass>> entity_classes;
+	uint32_t added_count = 0;
 
 	const MonoTableInfo* type_definitions_table = mono_image_get_table_info(
 			s_data->app_assembly_image, MONO_TABLE_TYPEDEF);
@@ -523,9 +1118,18 @@ void ScriptEngine::_load_assembly_classes() {
 			continue;
 		}
 
-		const Ref<ScriptClass> script_class =
-				create_ref<ScriptClass>(class_namespace, class_name);
-		s_data->entity_classes[full_name] = script_class;
+		Ref<ScriptClass> script_class;
+
+		const auto it = s_data->entity_classes.find(full_name);
+		if (it != s_data->entity_classes.end()) {
+			script_class = it->second;
+			*script_class = ScriptClass(class_namespace, class_name);
+		} else {
+			script_class = create_ref<ScriptClass>(class_namespace, class_name);
+			added_count++;
+		}
+
+		entity_classes[full_name] = script_class;
 
 		const int field_count = mono_class_num_fields(mono_class);
 
@@ -536,7 +1140,10 @@ void ScriptEngine::_load_assembly_classes() {
 						mono_class_get_fields(mono_class, &iterator)) {
 			const char* field_name = mono_field_get_name(field);
 			uint32_t flags = mono_field_get_flags(field);
-			if (flags & FIELD_ATTRIBUTE_PUBLIC) {
+			// offsets of static fields point into the static data of the
+			// class, not into the instances
+			if ((flags & FIELD_ATTRIBUTE_PUBLIC) &&
+					!(flags & FIELD_ATTRIBUTE_STATIC)) {
 				MonoType* const type = mono_field_get_type(field);
 
 				ScriptFieldType field_type =
@@ -555,9 +1162,21 @@ void ScriptEngine::_load_assembly_classes() {
 				EVE_LOG_VERBOSE_TRACE("  {} ({})", field_name,
 						serialize_script_field_type(field_type));
 
+				// offsets count the object header, so they are used on the
+				// object pointer as is
+				int alignment = 0;
 				script_class->fields[field_name] = { field_type, field_name,
-					field };
+					field, mono_field_get_offset(field),
+					(uint32_t)mono_type_size(type, &alignment) };
 			}
 		}
 	}
+
+	const uint32_t removed_count =
+			s_data->entity_classes.size() + added_count - entity_classes.size();
+
+	EVE_LOG_VERBOSE_TRACE("Loaded {} script classes, {} added, {} removed.",
+			entity_classes.size(), added_count, removed_count);
+
+	s_data->entity_classes = std::move(entity_classes);
 }
@@ -3,9 +3,34 @@
 
 #include "scripting/script.h"
 
+enum class ScriptExecutionMode {
+	// methods are compiled when they are first called
+	JIT = 0,
+	// uses the AOT images next to the assemblies, methods without compiled
+	// code are compiled when they are called
+	AOT,
+	// only runs AOT compiled code, every assembly including mscorlib needs
+	// an image compiled with --aot=full
+	FULL_AOT,
+	// same as FULL_AOT with images compiled with --aot=llvmonly
+	LLVM_AOT,
+};
+
+const char* serialize_script_execution_mode(ScriptExecutionMode mode);
+ScriptExecutionMode deserialize_script_execution_mode(std::string_view mode);
+
+struct ScriptEngineSettings {
+	// runtime builds do not watch the app assembly for changes and do not
+	// count the managed allocations
+	bool is_runtime = false;
+	// starts the debugger agent and loads the pdbs, only with JIT
+	bool enable_debugging = true;
+	ScriptExecutionMode execution_mode = ScriptExecutionMode::JIT;
+};
+
 class ScriptEngine {
 public:
-	static void init(bool is_runtime = false);
+	static void init(const ScriptEngineSettings& settings = {});
 
 	static void reinit();
 
@@ -25,18 +50,26 @@ public:
 
 	static void create_entity_instance(Entity entity);
 
+	// puts the field values of the entity back into its existing instance
+	// so that pooled entities can be reused without a new mono object
+	static void reset_entity_instance(Entity entity);
+
 	static void set_entity_managed_field_values(Entity entity);
 
 	static void invoke_on_create_entity(Entity entity);
 
 	static void invoke_on_update_entity(Entity entity, float dt);
 
+	// calls OnUpdate of every started instance with one call into managed
+	// code per script class instead of one invoke per entity
+	static void update_entities(float dt);
+
 	static void invoke_on_destroy_entity(Entity entity);
 
 	static Scene* get_scene_context();
 	static Ref<ScriptInstance> get_entity_script_instance(UID entity_id);
 
-	static ScriptClass get_entity_class();
+	static const ScriptClass& get_entity_class();
 	static Ref<ScriptClass> get_entity_class(const std::string& name);
 	static std::unordered_map<std::string, Ref<ScriptClass>> get_entity_classes();
 
@@ -58,6 +91,32 @@ private:
 
 	static void _load_assembly_classes();
 
+	static void _set_unmanaged_field_values(
+			ScriptInstance& instance, UID entity_id);
+
+	static void _set_field_value(ScriptInstance& instance,
+			const std::string& name, ScriptFieldInstance& field_instance);
+
+	// reading the field values of the running instances before the domain is
+	// unloaded and putting them into new instances afterwards
+	static void _save_instance_states();
+	static void _restore_instance_states();
+
+	static void _clear_update_batches();
+
+	// handlers and custom events of the managed event bus do not outlive
+	// a run
+	static void _reset_events();
+
+	static MonoArray* _get_update_timings(uint32_t count);
+
+	static void _record_update_batch(uint32_t batch_index, uint32_t count,
+			double ms, uint64_t allocation_count);
+
+	// instances take part in update_entities from OnCreate until OnDestroy
+	static void _add_to_update_batch(UID entity_id, ScriptInstance& instance);
+	static void _remove_from_update_batch(UID entity_id);
+
 	friend class ScriptClass;
 };
 
@@ -0,0 +1,130 @@
+#include "scripting/script_events.h"
+
+#include "core/event_system.h"
+#include "debug/log.h"
+
+namespace script_events {
+
+struct ScriptEventData {
+	bool enabled = false;
+
+	std::mutex mutex;
+
+	std::vector<ScriptEvent> events;
+	// index of the oldest event
+	uint32_t head = 0;
+	uint32_t count = 0;
+
+	// events overwritten since the last drain
+	uint32_t dropped_count = 0;
+};
+
+static ScriptEventData s_data;
+
+void init(uint32_t capacity) {
+	static bool s_subscribed = false;
+
+	{
+		std::lock_guard<std::mutex> lock(s_data.mutex);
+		s_data.events.resize(std::max(capacity, 1u));
+		s_data.head = 0;
+		s_data.count = 0;
+	}
+
+	if (s_subscribed) {
+		return;
+	}
+
+	event::subscribe<KeyPressEvent>([](const KeyPressEvent& event) {
+		push({ ScriptEventType::KEY_PRESSED, (int32_t)event.key_code, 0, 0 });
+	});
+
+	event::subscribe<KeyReleaseEvent>([](const KeyReleaseEvent& event) {
+		push({ ScriptEventType::KEY_RELEASED, (int32_t)event.key_code, 0, 0 });
+	});
+
+	event::subscribe<MousePressEvent>([](const MousePressEvent& event) {
+		push({ ScriptEventType::MOUSE_PRESSED, (int32_t)event.button_code, 0,
+				0 });
+	});
+
+	event::subscribe<MouseReleaseEvent>([](const MouseReleaseEvent& event) {
+		push({ ScriptEventType::MOUSE_RELEASED, (int32_t)event.button_code,
+				0, 0 });
+	});
+
+	s_subscribed = true;
+}
+
+bool is_enabled() { return s_data.enabled; }
+
+void set_enabled(bool enabled) {
+	s_data.enabled = enabled;
+	clear();
+}
+
+void push(const ScriptEvent& event) {
+	if (!s_data.enabled) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(s_data.mutex);
+
+	const uint32_t capacity = s_data.events.size();
+	if (!capacity) {
+		return;
+	}
+
+	if (s_data.count == capacity) {
+		s_data.head = (s_data.head + 1) % capacity;
+		s_data.count--;
+		s_data.dropped_count++;
+	}
+
+	s_data.events[(s_data.head + s_data.count) % capacity] = event;
+	s_data.count++;
+}
+
+void push_contact(ScriptEventType type, UID entity_id, UID other_id) {
+	push({ type, 0, entity_id, other_id });
+}
+
+void push_entity_destroyed(UID entity_id) {
+	push({ ScriptEventType::ENTITY_DESTROYED, 0, entity_id, 0 });
+}
+
+uint32_t drain(ScriptEvent* out_events, uint32_t max_count) {
+	std::lock_guard<std::mutex> lock(s_data.mutex);
+
+	if (s_data.dropped_count) {
+		EVE_LOG_WARNING("Script event buffer is full, dropped {} events.",
+				s_data.dropped_count);
+		s_data.dropped_count = 0;
+	}
+
+	const uint32_t capacity = s_data.events.size();
+	const uint32_t count = std::min(s_data.count, max_count);
+
+	// at most two copies, the events may wrap around the end
+	const uint32_t first_count = std::min(count, capacity - s_data.head);
+	std::copy_n(s_data.events.begin() + s_data.head, first_count, out_events);
+	std::copy_n(s_data.events.begin(), count - first_count,
+			out_events + first_count);
+
+	if (capacity) {
+		s_data.head = (s_data.head + count) % capacity;
+	}
+	s_data.count -= count;
+
+	return count;
+}
+
+void clear() {
+	std::lock_guard<std::mutex> lock(s_data.mutex);
+
+	s_data.head = 0;
+	s_data.count = 0;
+	s_data.dropped_count = 0;
+}
+
+} //namespace script_events
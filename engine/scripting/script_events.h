@@ -0,0 +1,65 @@
+#ifndef SCRIPT_EVENTS_H
+#define SCRIPT_EVENTS_H
+
+#include "core/uid.h"
+
+enum class ScriptEventType : uint32_t {
+	COLLISION_BEGIN = 0,
+	COLLISION_END,
+	TRIGGER_BEGIN,
+	TRIGGER_END,
+	KEY_PRESSED,
+	KEY_RELEASED,
+	MOUSE_PRESSED,
+	MOUSE_RELEASED,
+	CUSTOM,
+	// handlers of the entity are removed once it is handled
+	ENTITY_DESTROYED,
+};
+
+// has the layout of EveEngine.Event, the scripts read them straight out of
+// the drained array
+struct ScriptEvent {
+	ScriptEventType type;
+	// key or mouse code of input events, id of custom events
+	int32_t code;
+	// entity the event is sent to, zero for input events
+	uint64_t entity_id;
+	// other entity of contact events, payload of custom events
+	uint64_t data;
+};
+
+static_assert(sizeof(ScriptEvent) == 24, "Layout of EveEngine.Event!");
+
+// Events for the scripts are queued in a ring buffer while the frame runs
+// and drained by the managed event bus with a single call, so that no event
+// has to call into managed code on its own. Events are only queued while
+// the scripts run and the oldest ones are dropped once the buffer is full.
+namespace script_events {
+
+inline constexpr uint32_t DEFAULT_CAPACITY = 4096;
+
+// subscribes to the input events
+void init(uint32_t capacity = DEFAULT_CAPACITY);
+
+bool is_enabled();
+
+// clears the queued events
+void set_enabled(bool enabled);
+
+void push(const ScriptEvent& event);
+
+void push_contact(ScriptEventType type, UID entity_id, UID other_id);
+
+// entity was destroyed or released to its pool
+void push_entity_destroyed(UID entity_id);
+
+// moves up to max_count of the oldest events into out_events and returns
+// how many were moved
+uint32_t drain(ScriptEvent* out_events, uint32_t max_count);
+
+void clear();
+
+} //namespace script_events
+
+#endif
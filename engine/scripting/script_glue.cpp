@@ -3,13 +3,17 @@
 #include "core/application.h"
 #include "core/color.h"
 #include "core/input.h"
+#include "project/project.h"
 #include "renderer/post_processor.h"
 #include "scene/components.h"
 #include "scene/entity.h"
+#include "scene/prefab.h"
 #include "scene/scene.h"
 #include "scene/scene_manager.h"
 #include "scene/transform.h"
 #include "scripting/script_engine.h"
+#include "scripting/script_events.h"
+#include "scripting/script_jobs.h"
 
 #include <mono/metadata/appdomain.h>
 #include <mono/metadata/object.h>
@@ -48,6 +52,48 @@ inline static Entity get_entity(UID entity_id) {
 	return entity;
 }
 
+// EveEngine.EntityHandle, cached by the managed entities so that the calls
+// made through them do not hash the id
+struct EntityHandle {
+	UID id;
+	entt::entity handle;
+};
+
+static_assert(sizeof(EntityHandle) == 16);
+
+// null if the entity was destroyed
+inline static Entity find_entity(EntityHandle* entity_handle) {
+	Scene* scene = get_scene_context();
+
+	Entity entity =
+			scene->find_by_handle(entity_handle->handle, entity_handle->id);
+	if (!entity) {
+		// first call or the scene changed, cache the handle for the next ones
+		entity = scene->find_by_id(entity_handle->id);
+		entity_handle->handle = entity;
+	}
+
+	return entity;
+}
+
+inline static Entity get_entity(EntityHandle* entity_handle) {
+	Entity entity = find_entity(entity_handle);
+
+	EVE_ASSERT(entity);
+	return entity;
+}
+
+// jobs run on the workers while the main thread waits for them, entities and
+// components can only be created or destroyed on the main thread
+inline static bool check_main_thread(const char* function) {
+	if (script_jobs::is_worker_thread()) {
+		EVE_LOG_ERROR("{} can not be called from a job.", function);
+		return false;
+	}
+
+	return true;
+}
+
 #pragma region Application
 
 static void application_quit() { Application::get_instance()->quit(); }
@@ -88,10 +134,18 @@ inline static void debug_log_fatal(MonoString* string) {
 	EVE_LOG_VERBOSE_FATAL("{}", mono_string_to_string(string));
 }
 
+inline static void debug_log_exception(MonoString* message) {
+	log_script_exception_message(mono_string_to_string(message));
+}
+
 #pragma endregion
 #pragma region Entity
 
 inline static void entity_destroy(UID entity_id) {
+	if (!check_main_thread(__func__)) {
+		return;
+	}
+
 	if (!entity_id) {
 		return;
 	}
@@ -99,25 +153,38 @@ inline static void entity_destroy(UID entity_id) {
 	Scene* scene = get_scene_context();
 	Entity entity = get_entity(entity_id);
 
-	scene->destroy(entity);
+	// scripts and physics callbacks of the frame might still use it
+	scene->queue_destroy(entity);
 }
 
-inline static uint64_t entity_get_parent(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static void entity_release(UID entity_id) {
+	if (!check_main_thread(__func__)) {
+		return;
+	}
+
+	if (!entity_id) {
+		return;
+	}
+
+	get_scene_context()->release(get_entity(entity_id));
+}
+
+inline static uint64_t entity_get_parent(EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 	Entity parent_entity = entity.get_parent();
 
 	return parent_entity ? parent_entity.get_uid() : INVALID_UID;
 }
 
-inline static MonoString* entity_get_name(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static MonoString* entity_get_name(EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return ScriptEngine::create_mono_string(entity.get_name().c_str());
 }
 
 inline static bool entity_has_component(
-		UID entity_id, MonoReflectionType* component_type) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, MonoReflectionType* component_type) {
+	Entity entity = get_entity(entity_handle);
 
 	MonoType* managed_type = mono_reflection_type_get_type(component_type);
 	EVE_ASSERT(entity_has_component_funcs.find(managed_type) !=
@@ -127,8 +194,12 @@ inline static bool entity_has_component(
 }
 
 inline static void entity_add_component(
-		UID entity_id, MonoReflectionType* component_type) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, MonoReflectionType* component_type) {
+	if (!check_main_thread(__func__)) {
+		return;
+	}
+
+	Entity entity = get_entity(entity_handle);
 
 	MonoType* managed_type = mono_reflection_type_get_type(component_type);
 	EVE_ASSERT(entity_add_component_funcs.find(managed_type) !=
@@ -137,14 +208,55 @@ inline static void entity_add_component(
 	entity_add_component_funcs.at(managed_type)(entity);
 }
 
+// encodes the utf-16 characters of the string into buffer, which is reused
+// between the calls instead of allocating a new string with mono
+inline static std::string_view read_mono_string(
+		MonoString* string, std::string& buffer) {
+	const mono_unichar2* chars = mono_string_chars(string);
+	const int32_t length = mono_string_length(string);
+
+	buffer.clear();
+	for (int32_t i = 0; i < length; i++) {
+		uint32_t code_point = chars[i];
+
+		// surrogate pairs are joined, lone ones are kept as they are
+		if (code_point >= 0xD800 && code_point < 0xDC00 && i + 1 < length &&
+				chars[i + 1] >= 0xDC00 && chars[i + 1] < 0xE000) {
+			code_point = 0x10000 + ((code_point - 0xD800) << 10) +
+					(chars[i + 1] - 0xDC00);
+			i++;
+		}
+
+		if (code_point < 0x80) {
+			buffer.push_back((char)code_point);
+		} else if (code_point < 0x800) {
+			buffer.push_back((char)(0xC0 | (code_point >> 6)));
+			buffer.push_back((char)(0x80 | (code_point & 0x3F)));
+		} else if (code_point < 0x10000) {
+			buffer.push_back((char)(0xE0 | (code_point >> 12)));
+			buffer.push_back((char)(0x80 | ((code_point >> 6) & 0x3F)));
+			buffer.push_back((char)(0x80 | (code_point & 0x3F)));
+		} else {
+			buffer.push_back((char)(0xF0 | (code_point >> 18)));
+			buffer.push_back((char)(0x80 | ((code_point >> 12) & 0x3F)));
+			buffer.push_back((char)(0x80 | ((code_point >> 6) & 0x3F)));
+			buffer.push_back((char)(0x80 | (code_point & 0x3F)));
+		}
+	}
+
+	return buffer;
+}
+
 inline static uint64_t entity_find_by_name(MonoString* name) {
-	char* name_cstr = mono_string_to_utf8(name);
+	static thread_local std::string s_name_buffer;
 
-	Scene* scene = get_scene_context();
+	if (!name) {
+		return 0;
+	}
 
-	auto entity = scene->find_by_name(name_cstr);
-	mono_free(name_cstr);
+	Scene* scene = get_scene_context();
 
+	auto entity = scene->find_by_name(read_mono_string(name, s_name_buffer));
 	if (!entity) {
 		return 0;
 	}
@@ -154,6 +266,10 @@ inline static uint64_t entity_find_by_name(MonoString* name) {
 
 inline static uint64_t entity_instantiate(MonoString* name, UID parent_id,
 		glm::vec3* position, glm::vec3* rotation, glm::vec3* scale) {
+	if (!check_main_thread(__func__)) {
+		return 0;
+	}
+
 	Scene* scene = get_scene_context();
 
 	Entity created_entity =
@@ -171,6 +287,10 @@ inline static uint64_t entity_instantiate(MonoString* name, UID parent_id,
 }
 
 inline static void entity_assign_script(UID entity_id, MonoString* class_name) {
+	if (!check_main_thread(__func__)) {
+		return;
+	}
+
 	Entity entity = get_entity(entity_id);
 
 	auto& sc = entity.add_component<ScriptComponent>();
@@ -186,188 +306,244 @@ inline static void entity_assign_script(UID entity_id, MonoString* class_name) {
 #pragma region TransformComponent
 
 inline static void transform_component_get_local_position(
-		UID entity_id, glm::vec3* out_position) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec3* out_position) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_position = entity.get_transform().local_position;
 }
 
 inline static void transform_component_set_local_position(
-		UID entity_id, glm::vec3* position) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec3* position) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_transform().local_position = *position;
 }
 
 inline static void transform_component_get_local_rotation(
-		UID entity_id, glm::vec3* out_rotation) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec3* out_rotation) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_rotation = entity.get_transform().local_rotation;
 }
 
 inline static void transform_component_set_local_rotation(
-		UID entity_id, glm::vec3* rotation) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec3* rotation) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_transform().local_rotation = *rotation;
 }
 
 inline static void transform_component_get_local_scale(
-		UID entity_id, glm::vec3* out_scale) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec3* out_scale) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_scale = entity.get_transform().local_scale;
 }
 
 inline static void transform_component_set_local_scale(
-		UID entity_id, glm::vec3* scale) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec3* scale) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_transform().local_scale = *scale;
 }
 
 inline static void transform_component_get_position(
-		UID entity_id, glm::vec3* out_position) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec3* out_position) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_position = entity.get_transform().get_position();
 }
 
 inline static void transform_component_get_rotation(
-		UID entity_id, glm::vec3* out_rotation) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec3* out_rotation) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_rotation = entity.get_transform().get_rotation();
 }
 
 inline static void transform_component_get_scale(
-		UID entity_id, glm::vec3* out_scale) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec3* out_scale) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_scale = entity.get_transform().get_scale();
 }
 
 inline static void transform_component_get_forward(
-		UID entity_id, glm::vec3* out_forward) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec3* out_forward) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_forward = entity.get_transform().get_forward();
 }
 
 inline static void transform_component_get_right(
-		UID entity_id, glm::vec3* out_right) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec3* out_right) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_right = entity.get_transform().get_right();
 }
 
 inline static void transform_component_get_up(
-		UID entity_id, glm::vec3* out_up) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec3* out_up) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_up = entity.get_transform().get_up();
 }
 
 inline static void transform_component_translate(
-		UID entity_id, glm::vec3* translation) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec3* translation) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_transform().translate(*translation);
 }
 
 inline static void transform_component_rotate(
-		UID entity_id, const float angle, glm::vec3* axis) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, const float angle, glm::vec3* axis) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_transform().rotate(angle, *axis);
 }
 
+#pragma endregion
+#pragma region ComponentData
+
+// same order as EveEngine.ComponentDataType
+enum class ComponentDataType : uint32_t {
+	TRANSFORM = 0,
+	SPRITE_RENDERER,
+};
+
+// EveEngine.TransformData starts at the local position
+static_assert(offsetof(Transform, local_rotation) ==
+		offsetof(Transform, local_position) + sizeof(glm::vec3));
+static_assert(offsetof(Transform, local_scale) ==
+		offsetof(Transform, local_rotation) + sizeof(glm::vec3));
+
+// EveEngine.SpriteRendererData field offsets
+static_assert(offsetof(SpriteRenderer, texture) == 0);
+static_assert(offsetof(SpriteRenderer, color) == 8);
+static_assert(offsetof(SpriteRenderer, tex_tiling) == 24);
+static_assert(offsetof(SpriteRenderer, is_atlas) == 32);
+static_assert(offsetof(SpriteRenderer, block_size) == 36);
+static_assert(offsetof(SpriteRenderer, index) == 44);
+
+// address of the component data of the entity, valid until the generation of
+// its storage changes. null if the entity does not have the component.
+inline static void* component_data_get(
+		EntityHandle* entity_handle, ComponentDataType type) {
+	Entity entity = find_entity(entity_handle);
+	if (!entity) {
+		return nullptr;
+	}
+
+	switch (type) {
+		case ComponentDataType::TRANSFORM:
+			return &entity.get_transform().local_position;
+		case ComponentDataType::SPRITE_RENDERER:
+			return entity.has_component<SpriteRenderer>()
+					? &entity.get_component<SpriteRenderer>()
+					: nullptr;
+		default:
+			return nullptr;
+	}
+}
+
+inline static const uint32_t* component_data_get_generation(
+		ComponentDataType type) {
+	switch (type) {
+		case ComponentDataType::TRANSFORM:
+			return Scene::get_storage_generation<Transform>();
+		case ComponentDataType::SPRITE_RENDERER:
+			return Scene::get_storage_generation<SpriteRenderer>();
+		default:
+			return nullptr;
+	}
+}
+
 #pragma endregion
 #pragma region CameraComponent
 
 inline static void camera_component_camera_get_aspect_ratio(
-		UID entity_id, float* out_aspect_ratio) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float* out_aspect_ratio) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_aspect_ratio =
 			entity.get_component<CameraComponent>().camera.aspect_ratio;
 }
 
 inline static void camera_component_camera_set_aspect_ratio(
-		UID entity_id, float* aspect_ratio) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float* aspect_ratio) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<CameraComponent>().camera.aspect_ratio = *aspect_ratio;
 }
 
 inline static void camera_component_camera_get_zoom_level(
-		UID entity_id, float* out_zoom_level) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float* out_zoom_level) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_zoom_level = entity.get_component<CameraComponent>().camera.zoom_level;
 }
 
 inline static void camera_component_camera_set_zoom_level(
-		UID entity_id, float* zoom_level) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float* zoom_level) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<CameraComponent>().camera.zoom_level = *zoom_level;
 }
 
 inline static void camera_component_camera_get_near_clip(
-		UID entity_id, float* out_near_clip) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float* out_near_clip) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_near_clip = entity.get_component<CameraComponent>().camera.near_clip;
 }
 
 inline static void camera_component_camera_set_near_clip(
-		UID entity_id, float* near_clip) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float* near_clip) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<CameraComponent>().camera.near_clip = *near_clip;
 }
 
 inline static void camera_component_camera_get_far_clip(
-		UID entity_id, float* out_far_clip) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float* out_far_clip) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_far_clip = entity.get_component<CameraComponent>().camera.far_clip;
 }
 
 inline static void camera_component_camera_set_far_clip(
-		UID entity_id, float* far_clip) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float* far_clip) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<CameraComponent>().camera.far_clip = *far_clip;
 }
 
 inline static void camera_component_get_is_primary(
-		UID entity_id, float* out_is_primary) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float* out_is_primary) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_is_primary = entity.get_component<CameraComponent>().is_primary;
 }
 
 inline static void camera_component_set_is_primary(
-		UID entity_id, float* is_primary) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float* is_primary) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<CameraComponent>().is_primary = *is_primary;
 }
 
 inline static void camera_component_get_is_fixed_aspect_ratio(
-		UID entity_id, float* out_is_fixed_aspect_ratio) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float* out_is_fixed_aspect_ratio) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_is_fixed_aspect_ratio =
 			entity.get_component<CameraComponent>().is_fixed_aspect_ratio;
 }
 
 inline static void camera_component_set_is_fixed_aspect_ratio(
-		UID entity_id, float* is_fixed_aspect_ratio) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float* is_fixed_aspect_ratio) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<CameraComponent>().is_fixed_aspect_ratio =
 			*is_fixed_aspect_ratio;
@@ -376,8 +552,9 @@ inline static void camera_component_set_is_fixed_aspect_ratio(
 #pragma endregion
 #pragma region ScriptComponent
 
-inline static MonoString* script_component_get_class_name(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static MonoString* script_component_get_class_name(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	const auto& sc = entity.get_component<ScriptComponent>();
 	return ScriptEngine::create_mono_string(sc.class_name.c_str());
@@ -386,83 +563,86 @@ inline static MonoString* script_component_get_class_name(UID entity_id) {
 #pragma endregion
 #pragma region SpriteRendererComponent
 
-inline static uint64_t sprite_renderer_component_get_texture(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static uint64_t sprite_renderer_component_get_texture(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<SpriteRenderer>().texture;
 }
 
 inline static void sprite_renderer_component_set_texture(
-		UID entity_id, AssetHandle texture) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, AssetHandle texture) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<SpriteRenderer>().texture = texture;
 }
 
 inline static void sprite_renderer_component_get_color(
-		UID entity_id, Color* out_color) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, Color* out_color) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_color = entity.get_component<SpriteRenderer>().color;
 }
 
 inline static void sprite_renderer_component_set_color(
-		UID entity_id, Color* color) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, Color* color) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<SpriteRenderer>().color = *color;
 }
 
 inline static void sprite_renderer_component_get_tex_tiling(
-		UID entity_id, glm::vec2* out_tex_tiling) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec2* out_tex_tiling) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_tex_tiling = entity.get_component<SpriteRenderer>().tex_tiling;
 }
 
 inline static void sprite_renderer_component_set_tex_tiling(
-		UID entity_id, glm::vec2* tex_tiling) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec2* tex_tiling) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<SpriteRenderer>().tex_tiling = *tex_tiling;
 }
 
-inline static bool sprite_renderer_component_get_is_atlas(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static bool sprite_renderer_component_get_is_atlas(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<SpriteRenderer>().is_atlas;
 }
 
 inline static void sprite_renderer_component_set_is_atlas(
-		UID entity_id, bool is_atlas) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, bool is_atlas) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<SpriteRenderer>().is_atlas = is_atlas;
 }
 
 inline static void sprite_renderer_component_get_block_size(
-		UID entity_id, glm::vec2* out_size) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec2* out_size) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_size = entity.get_component<SpriteRenderer>().block_size;
 }
 
 inline static void sprite_renderer_component_set_block_size(
-		UID entity_id, const glm::vec2* block_size) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, const glm::vec2* block_size) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<SpriteRenderer>().block_size = *block_size;
 }
 
-inline static uint32_t sprite_renderer_component_get_index(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static uint32_t sprite_renderer_component_get_index(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<SpriteRenderer>().index;
 }
 
 inline static void sprite_renderer_component_set_index(
-		UID entity_id, uint32_t index) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, uint32_t index) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<SpriteRenderer>().index = index;
 }
@@ -470,95 +650,100 @@ inline static void sprite_renderer_component_set_index(
 #pragma endregion
 #pragma region TextRendererComponent
 
-inline static std::string text_renderer_component_get_text(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static std::string text_renderer_component_get_text(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<TextRenderer>().text;
 }
 
 inline static void text_renderer_component_set_text(
-		UID entity_id, MonoString* text) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, MonoString* text) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<TextRenderer>().text = mono_string_to_string(text);
 }
 
-inline static UID text_renderer_component_get_font(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static UID text_renderer_component_get_font(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<TextRenderer>().font;
 }
 
 inline static void text_renderer_component_set_font(
-		UID entity_id, UID font_handle) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, UID font_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<TextRenderer>().font = font_handle;
 }
 
 inline static void text_renderer_component_get_fg_color(
-		UID entity_id, Color* out_color) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, Color* out_color) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_color = entity.get_component<TextRenderer>().fg_color;
 }
 
 inline static void text_renderer_component_set_fg_color(
-		UID entity_id, const Color* color) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, const Color* color) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<TextRenderer>().fg_color = *color;
 }
 
 inline static void text_renderer_component_get_bg_color(
-		UID entity_id, Color* out_color) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, Color* out_color) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_color = entity.get_component<TextRenderer>().bg_color;
 }
 
 inline static void text_renderer_component_set_bg_color(
-		UID entity_id, const Color* color) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, const Color* color) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<TextRenderer>().bg_color = *color;
 }
 
-inline static float text_renderer_component_get_kerning(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static float text_renderer_component_get_kerning(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<TextRenderer>().kerning;
 }
 
 inline static void text_renderer_component_set_kerning(
-		UID entity_id, float kerning) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float kerning) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<TextRenderer>().kerning = kerning;
 }
 
-inline static float text_renderer_component_get_line_spacing(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static float text_renderer_component_get_line_spacing(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<TextRenderer>().line_spacing;
 }
 
 inline static void text_renderer_component_set_line_spacing(
-		UID entity_id, float line_spacing) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float line_spacing) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<TextRenderer>().line_spacing = line_spacing;
 }
 
-inline static bool text_renderer_component_get_is_screen_space(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static bool text_renderer_component_get_is_screen_space(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<TextRenderer>().is_screen_space;
 }
 
 inline static void text_renderer_component_set_is_screen_space(
-		UID entity_id, bool is_screen_space) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, bool is_screen_space) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<TextRenderer>().is_screen_space = is_screen_space;
 }
@@ -567,49 +752,51 @@ inline static void text_renderer_component_set_is_screen_space(
 #pragma region Rigidbody2DComponent
 
 inline static Rigidbody2D::BodyType rigidbody2d_component_get_type(
-		UID entity_id) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<Rigidbody2D>().type;
 }
 
 inline static void rigidbody2d_component_set_type(
-		UID entity_id, Rigidbody2D::BodyType type) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, Rigidbody2D::BodyType type) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<Rigidbody2D>().type = type;
 }
 
-inline static bool rigidbody2d_component_get_fixed_rotation(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static bool rigidbody2d_component_get_fixed_rotation(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<Rigidbody2D>().fixed_rotation;
 }
 
 inline static void rigidbody2d_component_set_fixed_rotation(
-		UID entity_id, bool fixed_rotation) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, bool fixed_rotation) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<Rigidbody2D>().fixed_rotation = fixed_rotation;
 }
 
 inline static void rigidbody2d_component_get_velocity(
-		UID entity_id, glm::vec2* out_velocity) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec2* out_velocity) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_velocity = entity.get_component<Rigidbody2D>().velocity;
 }
 
-inline static float rigidbody2d_component_get_angular_velocity(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static float rigidbody2d_component_get_angular_velocity(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<Rigidbody2D>().angular_velocity;
 }
 
-inline static void rigidbody2d_component_add_force(UID entity_id,
+inline static void rigidbody2d_component_add_force(EntityHandle* entity_handle,
 		Rigidbody2D::ForceMode mode, const glm::vec2* force,
 		const glm::vec2* offset) {
-	Entity entity = get_entity(entity_id);
+	Entity entity = get_entity(entity_handle);
 
 	Rigidbody2D::ForceInfo force_info = {
 		.mode = mode,
@@ -621,15 +808,15 @@ inline static void rigidbody2d_component_add_force(UID entity_id,
 }
 
 inline static void rigidbody2d_component_add_angular_impulse(
-		UID entity_id, float angular_impulse) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float angular_impulse) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<Rigidbody2D>().angular_impulse += angular_impulse;
 }
 
 inline static void rigidbody2d_component_add_torque(
-		UID entity_id, float torque) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float torque) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<Rigidbody2D>().torque += torque;
 }
@@ -638,102 +825,106 @@ inline static void rigidbody2d_component_add_torque(
 #pragma region BoxCollider2DComponent
 
 inline static void box_collider2d_component_get_offset(
-		UID entity_id, glm::vec2* out_offset) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec2* out_offset) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_offset = entity.get_component<BoxCollider2D>().offset;
 }
 
 inline static void box_collider2d_component_set_offset(
-		UID entity_id, const glm::vec2* offset) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, const glm::vec2* offset) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<BoxCollider2D>().offset = *offset;
 }
 
 inline static void box_collider2d_component_get_size(
-		UID entity_id, glm::vec2* out_size) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec2* out_size) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_size = entity.get_component<BoxCollider2D>().size;
 }
 
 inline static void box_collider2d_component_set_size(
-		UID entity_id, const glm::vec2* size) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, const glm::vec2* size) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<BoxCollider2D>().size = *size;
 }
 
-inline static bool box_collider2d_component_get_is_trigger(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static bool box_collider2d_component_get_is_trigger(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<BoxCollider2D>().is_trigger;
 }
 
 inline static void box_collider2d_component_set_is_trigger(
-		UID entity_id, bool is_trigger) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, bool is_trigger) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<BoxCollider2D>().is_trigger = is_trigger;
 }
 
 inline static void box_collider2d_component_set_on_trigger(
-		UID entity_id, CollisionTriggerFunction on_trigger) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, CollisionTriggerFunction on_trigger) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<BoxCollider2D>().trigger_function = on_trigger;
 }
 
-inline static float box_collider2d_component_get_density(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static float box_collider2d_component_get_density(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<BoxCollider2D>().density;
 }
 
 inline static void box_collider2d_component_set_density(
-		UID entity_id, float density) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float density) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<BoxCollider2D>().density = density;
 }
 
-inline static float box_collider2d_component_get_friction(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static float box_collider2d_component_get_friction(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<BoxCollider2D>().friction;
 }
 
 inline static void box_collider2d_component_set_friction(
-		UID entity_id, float friction) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float friction) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<BoxCollider2D>().friction = friction;
 }
 
-inline static float box_collider2d_component_get_restitution(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static float box_collider2d_component_get_restitution(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<BoxCollider2D>().restitution;
 }
 
 inline static void box_collider2d_component_set_restitution(
-		UID entity_id, float restitution) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float restitution) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<BoxCollider2D>().restitution = restitution;
 }
 
 inline static float box_collider2d_component_get_restitution_threshold(
-		UID entity_id) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<BoxCollider2D>().restitution_threshold;
 }
 
 inline static void box_collider2d_component_set_restitution_threshold(
-		UID entity_id, float restitution_threshold) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float restitution_threshold) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<BoxCollider2D>().restitution_threshold =
 			restitution_threshold;
@@ -743,194 +934,443 @@ inline static void box_collider2d_component_set_restitution_threshold(
 #pragma region CircleCollider2DComponent
 
 inline static void circle_collider2d_component_get_offset(
-		UID entity_id, glm::vec2* out_offset) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, glm::vec2* out_offset) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_offset = entity.get_component<CircleCollider2D>().offset;
 }
 
 inline static void circle_collider2d_component_set_offset(
-		UID entity_id, const glm::vec2* offset) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, const glm::vec2* offset) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<CircleCollider2D>().offset = *offset;
 }
 
-inline static float circle_collider2d_component_get_radius(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static float circle_collider2d_component_get_radius(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<CircleCollider2D>().radius;
 }
 
 inline static void circle_collider2d_component_set_radius(
-		UID entity_id, float radius) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float radius) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<CircleCollider2D>().radius = radius;
 }
 
-inline static bool circle_collider2d_component_get_is_trigger(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static bool circle_collider2d_component_get_is_trigger(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<CircleCollider2D>().is_trigger;
 }
 
 inline static void circle_collider2d_component_set_is_trigger(
-		UID entity_id, bool is_trigger) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, bool is_trigger) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<CircleCollider2D>().is_trigger = is_trigger;
 }
 
 inline static void circle_collider2d_component_set_on_trigger(
-		UID entity_id, CollisionTriggerFunction on_trigger) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, CollisionTriggerFunction on_trigger) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<CircleCollider2D>().trigger_function = on_trigger;
 }
 
-inline static float circle_collider2d_component_get_density(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static float circle_collider2d_component_get_density(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<CircleCollider2D>().density;
 }
 
 inline static void circle_collider2d_component_set_density(
-		UID entity_id, float density) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float density) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<CircleCollider2D>().density = density;
 }
 
-inline static float circle_collider2d_component_get_friction(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static float circle_collider2d_component_get_friction(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<CircleCollider2D>().friction;
 }
 
 inline static void circle_collider2d_component_set_friction(
-		UID entity_id, float friction) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float friction) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<CircleCollider2D>().friction = friction;
 }
 
-inline static float circle_collider2d_component_get_restitution(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static float circle_collider2d_component_get_restitution(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<CircleCollider2D>().restitution;
 }
 
 inline static void circle_collider2d_component_set_restitution(
-		UID entity_id, float restitution) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float restitution) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<CircleCollider2D>().restitution = restitution;
 }
 
 inline static float circle_collider2d_component_get_restitution_threshold(
-		UID entity_id) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<CircleCollider2D>().restitution_threshold;
 }
 
 inline static void circle_collider2d_component_set_restitution_threshold(
-		UID entity_id, float restitution_threshold) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, float restitution_threshold) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<CircleCollider2D>().restitution_threshold =
 			restitution_threshold;
 }
 
+#pragma endregion
+#pragma region PolygonCollider2DComponent
+
+// shapes are baked into the fixtures, edits mark them to be rebuilt
+template <typename T>
+inline static T& edit_collider(EntityHandle* entity_handle) {
+	T& collider = get_entity(entity_handle).get_component<T>();
+	collider.runtime_dirty = true;
+
+	return collider;
+}
+
+inline static void polygon_collider2d_component_get_offset(
+		EntityHandle* entity_handle, glm::vec2* out_offset) {
+	Entity entity = get_entity(entity_handle);
+
+	*out_offset = entity.get_component<PolygonCollider2D>().offset;
+}
+
+inline static void polygon_collider2d_component_set_offset(
+		EntityHandle* entity_handle, const glm::vec2* offset) {
+	edit_collider<PolygonCollider2D>(entity_handle).offset = *offset;
+}
+
+inline static bool polygon_collider2d_component_get_is_trigger(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
+
+	return entity.get_component<PolygonCollider2D>().is_trigger;
+}
+
+inline static void polygon_collider2d_component_set_is_trigger(
+		EntityHandle* entity_handle, bool is_trigger) {
+	edit_collider<PolygonCollider2D>(entity_handle).is_trigger = is_trigger;
+}
+
+inline static void polygon_collider2d_component_set_on_trigger(
+		EntityHandle* entity_handle, CollisionTriggerFunction on_trigger) {
+	edit_collider<PolygonCollider2D>(entity_handle).trigger_function =
+			on_trigger;
+}
+
+inline static float polygon_collider2d_component_get_density(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
+
+	return entity.get_component<PolygonCollider2D>().density;
+}
+
+inline static void polygon_collider2d_component_set_density(
+		EntityHandle* entity_handle, float density) {
+	edit_collider<PolygonCollider2D>(entity_handle).density = density;
+}
+
+inline static float polygon_collider2d_component_get_friction(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
+
+	return entity.get_component<PolygonCollider2D>().friction;
+}
+
+inline static void polygon_collider2d_component_set_friction(
+		EntityHandle* entity_handle, float friction) {
+	edit_collider<PolygonCollider2D>(entity_handle).friction = friction;
+}
+
+inline static float polygon_collider2d_component_get_restitution(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
+
+	return entity.get_component<PolygonCollider2D>().restitution;
+}
+
+inline static void polygon_collider2d_component_set_restitution(
+		EntityHandle* entity_handle, float restitution) {
+	edit_collider<PolygonCollider2D>(entity_handle).restitution = restitution;
+}
+
+inline static float polygon_collider2d_component_get_restitution_threshold(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
+
+	return entity.get_component<PolygonCollider2D>().restitution_threshold;
+}
+
+inline static void polygon_collider2d_component_set_restitution_threshold(
+		EntityHandle* entity_handle, float restitution_threshold) {
+	edit_collider<PolygonCollider2D>(entity_handle).restitution_threshold =
+			restitution_threshold;
+}
+
+#pragma endregion
+#pragma region CapsuleCollider2DComponent
+
+inline static void capsule_collider2d_component_get_offset(
+		EntityHandle* entity_handle, glm::vec2* out_offset) {
+	Entity entity = get_entity(entity_handle);
+
+	*out_offset = entity.get_component<CapsuleCollider2D>().offset;
+}
+
+inline static void capsule_collider2d_component_set_offset(
+		EntityHandle* entity_handle, const glm::vec2* offset) {
+	edit_collider<CapsuleCollider2D>(entity_handle).offset = *offset;
+}
+
+inline static float capsule_collider2d_component_get_radius(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
+
+	return entity.get_component<CapsuleCollider2D>().radius;
+}
+
+inline static void capsule_collider2d_component_set_radius(
+		EntityHandle* entity_handle, float radius) {
+	edit_collider<CapsuleCollider2D>(entity_handle).radius = radius;
+}
+
+inline static float capsule_collider2d_component_get_height(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
+
+	return entity.get_component<CapsuleCollider2D>().height;
+}
+
+inline static void capsule_collider2d_component_set_height(
+		EntityHandle* entity_handle, float height) {
+	edit_collider<CapsuleCollider2D>(entity_handle).height = height;
+}
+
+inline static bool capsule_collider2d_component_get_is_trigger(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
+
+	return entity.get_component<CapsuleCollider2D>().is_trigger;
+}
+
+inline static void capsule_collider2d_component_set_is_trigger(
+		EntityHandle* entity_handle, bool is_trigger) {
+	edit_collider<CapsuleCollider2D>(entity_handle).is_trigger = is_trigger;
+}
+
+inline static void capsule_collider2d_component_set_on_trigger(
+		EntityHandle* entity_handle, CollisionTriggerFunction on_trigger) {
+	edit_collider<CapsuleCollider2D>(entity_handle).trigger_function =
+			on_trigger;
+}
+
+inline static float capsule_collider2d_component_get_density(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
+
+	return entity.get_component<CapsuleCollider2D>().density;
+}
+
+inline static void capsule_collider2d_component_set_density(
+		EntityHandle* entity_handle, float density) {
+	edit_collider<CapsuleCollider2D>(entity_handle).density = density;
+}
+
+inline static float capsule_collider2d_component_get_friction(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
+
+	return entity.get_component<CapsuleCollider2D>().friction;
+}
+
+inline static void capsule_collider2d_component_set_friction(
+		EntityHandle* entity_handle, float friction) {
+	edit_collider<CapsuleCollider2D>(entity_handle).friction = friction;
+}
+
+inline static float capsule_collider2d_component_get_restitution(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
+
+	return entity.get_component<CapsuleCollider2D>().restitution;
+}
+
+inline static void capsule_collider2d_component_set_restitution(
+		EntityHandle* entity_handle, float restitution) {
+	edit_collider<CapsuleCollider2D>(entity_handle).restitution = restitution;
+}
+
+inline static float capsule_collider2d_component_get_restitution_threshold(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
+
+	return entity.get_component<CapsuleCollider2D>().restitution_threshold;
+}
+
+inline static void capsule_collider2d_component_set_restitution_threshold(
+		EntityHandle* entity_handle, float restitution_threshold) {
+	edit_collider<CapsuleCollider2D>(entity_handle).restitution_threshold =
+			restitution_threshold;
+}
+
+#pragma endregion
+#pragma region ChainCollider2DComponent
+
+inline static float chain_collider2d_component_get_friction(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
+
+	return entity.get_component<ChainCollider2D>().friction;
+}
+
+inline static void chain_collider2d_component_set_friction(
+		EntityHandle* entity_handle, float friction) {
+	edit_collider<ChainCollider2D>(entity_handle).friction = friction;
+}
+
+inline static float chain_collider2d_component_get_restitution(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
+
+	return entity.get_component<ChainCollider2D>().restitution;
+}
+
+inline static void chain_collider2d_component_set_restitution(
+		EntityHandle* entity_handle, float restitution) {
+	edit_collider<ChainCollider2D>(entity_handle).restitution = restitution;
+}
+
+inline static float chain_collider2d_component_get_restitution_threshold(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
+
+	return entity.get_component<ChainCollider2D>().restitution_threshold;
+}
+
+inline static void chain_collider2d_component_set_restitution_threshold(
+		EntityHandle* entity_handle, float restitution_threshold) {
+	edit_collider<ChainCollider2D>(entity_handle).restitution_threshold =
+			restitution_threshold;
+}
+
 #pragma endregion
 #pragma region PostProcessVolume
 
-inline static bool post_process_volume_component_get_is_global(UID entity_id) {
-	Entity entity = get_entity(entity_id);
+inline static bool post_process_volume_component_get_is_global(
+		EntityHandle* entity_handle) {
+	Entity entity = get_entity(entity_handle);
 
 	return entity.get_component<PostProcessVolume>().is_global;
 }
 
 inline static void post_process_volume_component_set_is_global(
-		UID entity_id, bool value) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle, bool value) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<PostProcessVolume>().is_global = value;
 }
 
 inline static void post_process_volume_component_get_gray_scale(
-		UID entity_id, PostProcessVolume::GrayScaleSettings* out_gray_scale) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle,
+		PostProcessVolume::GrayScaleSettings* out_gray_scale) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_gray_scale = entity.get_component<PostProcessVolume>().gray_scale;
 }
 
 inline static void post_process_volume_component_set_gray_scale(
-		UID entity_id, const PostProcessVolume::GrayScaleSettings* gray_scale) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle,
+		const PostProcessVolume::GrayScaleSettings* gray_scale) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<PostProcessVolume>().gray_scale = *gray_scale;
 }
 
 inline static void post_process_volume_component_get_chromatic_aberration(
-		UID entity_id,
-		PostProcessVolume::ChromaticAberrationSettings*
-				out_chromatic_aberration) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle,
+		PostProcessVolume::ChromaticAberrationSettings* out_chromatic_aberration) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_chromatic_aberration =
 			entity.get_component<PostProcessVolume>().chromatic_aberration;
 }
 
 inline static void post_process_volume_component_set_chromatic_aberration(
-		UID entity_id,
-		const PostProcessVolume::ChromaticAberrationSettings*
-				chromatic_aberration) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle,
+		const PostProcessVolume::ChromaticAberrationSettings* chromatic_aberration) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<PostProcessVolume>().chromatic_aberration =
 			*chromatic_aberration;
 }
 
 inline static void post_process_volume_component_get_blur(
-		UID entity_id, PostProcessVolume::BlurSettings* out_blur) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle,
+		PostProcessVolume::BlurSettings* out_blur) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_blur = entity.get_component<PostProcessVolume>().blur;
 }
 
 inline static void post_process_volume_component_set_blur(
-		UID entity_id, const PostProcessVolume::BlurSettings* blur) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle,
+		const PostProcessVolume::BlurSettings* blur) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<PostProcessVolume>().blur = *blur;
 }
 
 inline static void post_process_volume_component_get_sharpen(
-		UID entity_id, PostProcessVolume::SharpenSettings* out_sharpen) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle,
+		PostProcessVolume::SharpenSettings* out_sharpen) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_sharpen = entity.get_component<PostProcessVolume>().sharpen;
 }
 
 inline static void post_process_volume_component_set_sharpen(
-		UID entity_id, const PostProcessVolume::SharpenSettings* sharpen) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle,
+		const PostProcessVolume::SharpenSettings* sharpen) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<PostProcessVolume>().sharpen = *sharpen;
 }
 
 inline static void post_process_volume_component_get_vignette(
-		UID entity_id, PostProcessVolume::VignetteSettings* out_vignette) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle,
+		PostProcessVolume::VignetteSettings* out_vignette) {
+	Entity entity = get_entity(entity_handle);
 
 	*out_vignette = entity.get_component<PostProcessVolume>().vignette;
 }
 
 inline static void post_process_volume_component_set_vignette(
-		UID entity_id, const PostProcessVolume::VignetteSettings* vignette) {
-	Entity entity = get_entity(entity_id);
+		EntityHandle* entity_handle,
+		const PostProcessVolume::VignetteSettings* vignette) {
+	Entity entity = get_entity(entity_handle);
 
 	entity.get_component<PostProcessVolume>().vignette = *vignette;
 }
@@ -965,8 +1405,269 @@ inline static void input_get_scroll_offset(glm::vec2* out_offset) {
 #pragma endregion
 #pragma region SceneManager
 
-inline static void scene_manager_load_scene(MonoString* path) {
-	SceneManager::load_scene(mono_string_to_string(path));
+// loads started by the scripts, the managed handle releases its load once
+// it saw it finish
+static std::unordered_map<uint64_t, Ref<SceneLoadHandle>> s_scene_loads;
+static uint64_t s_next_scene_load_id = 1;
+
+inline static uint64_t scene_manager_load_scene(MonoString* path) {
+	if (!check_main_thread(__func__)) {
+		return 0;
+	}
+
+	// keep the game running while the next scene is loading
+	const uint64_t load_id = s_next_scene_load_id++;
+	s_scene_loads[load_id] =
+			SceneManager::load_scene_async(mono_string_to_string(path));
+
+	return load_id;
+}
+
+inline static float scene_manager_get_load_progress(uint64_t load_id) {
+	if (!check_main_thread(__func__)) {
+		return 0.0f;
+	}
+
+	const auto it = s_scene_loads.find(load_id);
+	if (it == s_scene_loads.end()) {
+		return 0.0f;
+	}
+
+	return it->second->get_progress();
+}
+
+inline static SceneLoadState scene_manager_get_load_state(uint64_t load_id) {
+	if (!check_main_thread(__func__)) {
+		return SceneLoadState::FAILED;
+	}
+
+	const auto it = s_scene_loads.find(load_id);
+	if (it == s_scene_loads.end()) {
+		return SceneLoadState::FAILED;
+	}
+
+	return it->second->get_state();
+}
+
+inline static void scene_manager_release_load(uint64_t load_id) {
+	if (!check_main_thread(__func__)) {
+		return;
+	}
+
+	s_scene_loads.erase(load_id);
+}
+
+#pragma endregion
+#pragma region Prefab
+
+inline static uint64_t prefab_load(MonoString* path) {
+	if (!check_main_thread(__func__)) {
+		return 0;
+	}
+
+	AssetRegistry& registry = get_scene_context()->get_asset_registry();
+
+	const fs::path path_abs =
+			Project::get_asset_path(mono_string_to_string(path));
+
+	// already loaded prefabs are returned as is
+	const AssetHandle handle = registry.get_handle_from_path(path_abs.string());
+	if (handle && registry.is_asset_loaded(handle)) {
+		return handle;
+	}
+
+	return registry.load_asset(path_abs.string(), AssetType::PREFAB, handle);
+}
+
+inline static Ref<Prefab> get_prefab(AssetHandle handle) {
+	Ref<Prefab> prefab =
+			get_scene_context()->get_asset_registry().get_asset<Prefab>(handle);
+	if (!prefab) {
+		EVE_LOG_ERROR(
+				"Unable to find prefab with handle {}.", (uint64_t)handle);
+	}
+
+	return prefab;
+}
+
+inline static uint64_t prefab_instantiate(
+		AssetHandle handle, UID parent_id, glm::vec3* position) {
+	if (!check_main_thread(__func__)) {
+		return 0;
+	}
+
+	Ref<Prefab> prefab = get_prefab(handle);
+	if (!prefab) {
+		return 0;
+	}
+
+	Entity entity =
+			get_scene_context()->instantiate(*prefab, parent_id, position);
+	if (!entity) {
+		return 0;
+	}
+
+	return entity.get_uid();
+}
+
+inline static uint64_t prefab_spawn(
+		AssetHandle handle, UID parent_id, glm::vec3* position) {
+	if (!check_main_thread(__func__)) {
+		return 0;
+	}
+
+	Ref<Prefab> prefab = get_prefab(handle);
+	if (!prefab) {
+		return 0;
+	}
+
+	Entity entity = get_scene_context()->spawn(*prefab, parent_id, position);
+	if (!entity) {
+		return 0;
+	}
+
+	return entity.get_uid();
+}
+
+inline static uint32_t prefab_instantiate_batch(AssetHandle handle,
+		UID parent_id, MonoArray* positions, MonoArray* out_entities) {
+	if (!check_main_thread(__func__)) {
+		return 0;
+	}
+
+	Ref<Prefab> prefab = get_prefab(handle);
+	if (!prefab) {
+		return 0;
+	}
+
+	if (!positions || !out_entities) {
+		return 0;
+	}
+
+	const uint32_t count = (uint32_t)std::min(
+			mono_array_length(positions), mono_array_length(out_entities));
+
+	// OnCreate of the instances might spawn again, so the roots are not
+	// shared between calls
+	std::vector<Entity> roots;
+	roots.reserve(count);
+
+	get_scene_context()->instantiate(*prefab, count, roots, parent_id,
+			mono_array_addr(positions, glm::vec3, 0));
+
+	uint64_t* entity_ids = mono_array_addr(out_entities, uint64_t, 0);
+	for (uint32_t i = 0; i < roots.size(); i++) {
+		entity_ids[i] = roots[i].get_uid();
+	}
+
+	return roots.size();
+}
+
+#pragma endregion
+#pragma region Jobs
+
+inline static void jobs_execute(
+		int32_t job_count, MonoArray* entity_counts, int32_t batch_size) {
+	if (!check_main_thread(__func__)) {
+		return;
+	}
+
+	job_count = std::min<int32_t>(
+			job_count, mono_array_length(entity_counts));
+
+	// the gc may move the array while the jobs allocate
+	static std::vector<int32_t> s_entity_counts;
+
+	const int32_t* counts = mono_array_addr(entity_counts, int32_t, 0);
+	s_entity_counts.assign(counts, counts + job_count);
+
+	script_jobs::execute(job_count, s_entity_counts.data(), batch_size);
+}
+
+#pragma endregion
+#pragma region Events
+
+inline static int32_t events_drain(MonoArray* out_events) {
+	if (!check_main_thread(__func__) || !out_events) {
+		return 0;
+	}
+
+	return script_events::drain(mono_array_addr(out_events, ScriptEvent, 0),
+			(uint32_t)mono_array_length(out_events));
+}
+
+#pragma endregion
+#pragma region Physics2D
+
+inline static PhysicsSystem& get_physics_system() {
+	return get_scene_context()->get_physics_system();
+}
+
+inline static bool physics2d_raycast(const glm::vec2* origin,
+		const glm::vec2* direction, float distance, RaycastHit2D* out_hit) {
+	return get_physics_system().raycast(*origin, *direction, distance, out_hit);
+}
+
+inline static uint32_t physics2d_raycast_all(const glm::vec2* origin,
+		const glm::vec2* direction, float distance, MonoArray* out_hits) {
+	if (!out_hits) {
+		return 0;
+	}
+
+	// write straight into the managed array to avoid per hit allocations
+	return get_physics_system().raycast_all(*origin, *direction, distance,
+			mono_array_addr(out_hits, RaycastHit2D, 0),
+			(uint32_t)mono_array_length(out_hits));
+}
+
+inline static uint32_t physics2d_raycast_batch(
+		MonoArray* queries, MonoArray* out_hits) {
+	if (!queries || !out_hits) {
+		return 0;
+	}
+
+	const uint32_t count = (uint32_t)std::min(
+			mono_array_length(queries), mono_array_length(out_hits));
+
+	return get_physics_system().raycast_batch(
+			mono_array_addr(queries, RaycastQuery2D, 0), count,
+			mono_array_addr(out_hits, RaycastHit2D, 0));
+}
+
+inline static uint32_t physics2d_overlap_box(const glm::vec2* center,
+		const glm::vec2* half_size, float angle, MonoArray* out_entities) {
+	if (!out_entities) {
+		return 0;
+	}
+
+	return get_physics_system().overlap_box(*center, *half_size, angle,
+			mono_array_addr(out_entities, uint64_t, 0),
+			(uint32_t)mono_array_length(out_entities));
+}
+
+inline static uint32_t physics2d_overlap_circle(
+		const glm::vec2* center, float radius, MonoArray* out_entities) {
+	if (!out_entities) {
+		return 0;
+	}
+
+	return get_physics_system().overlap_circle(*center, radius,
+			mono_array_addr(out_entities, uint64_t, 0),
+			(uint32_t)mono_array_length(out_entities));
+}
+
+inline static bool physics2d_box_cast(const glm::vec2* center,
+		const glm::vec2* half_size, float angle, const glm::vec2* direction,
+		float distance, RaycastHit2D* out_hit) {
+	return get_physics_system().shape_cast_box(
+			*center, *half_size, angle, *direction, distance, out_hit);
+}
+
+inline static bool physics2d_circle_cast(const glm::vec2* center,
+		float radius, const glm::vec2* direction, float distance,
+		RaycastHit2D* out_hit) {
+	return get_physics_system().shape_cast_circle(
+			*center, radius, *direction, distance, out_hit);
 }
 
 #pragma endregion
@@ -1041,9 +1742,11 @@ void register_functions() {
 	EVE_ADD_INTERNAL_CALL(debug_log_warning);
 	EVE_ADD_INTERNAL_CALL(debug_log_error);
 	EVE_ADD_INTERNAL_CALL(debug_log_fatal);
+	EVE_ADD_INTERNAL_CALL(debug_log_exception);
 
 	// Begin Entity
 	EVE_ADD_INTERNAL_CALL(entity_destroy);
+	EVE_ADD_INTERNAL_CALL(entity_release);
 	EVE_ADD_INTERNAL_CALL(entity_get_parent);
 	EVE_ADD_INTERNAL_CALL(entity_get_name);
 	EVE_ADD_INTERNAL_CALL(entity_has_component);
@@ -1068,6 +1771,10 @@ void register_functions() {
 	EVE_ADD_INTERNAL_CALL(transform_component_translate);
 	EVE_ADD_INTERNAL_CALL(transform_component_rotate);
 
+	// Begin ComponentData
+	EVE_ADD_INTERNAL_CALL(component_data_get);
+	EVE_ADD_INTERNAL_CALL(component_data_get_generation);
+
 	// Begin CameraComponent
 	EVE_ADD_INTERNAL_CALL(camera_component_camera_get_aspect_ratio);
 	EVE_ADD_INTERNAL_CALL(camera_component_camera_set_aspect_ratio);
@@ -1162,6 +1869,52 @@ void register_functions() {
 	EVE_ADD_INTERNAL_CALL(
 			circle_collider2d_component_set_restitution_threshold);
 
+	// Begin PolygonCollider2D
+	EVE_ADD_INTERNAL_CALL(polygon_collider2d_component_get_offset);
+	EVE_ADD_INTERNAL_CALL(polygon_collider2d_component_set_offset);
+	EVE_ADD_INTERNAL_CALL(polygon_collider2d_component_get_is_trigger);
+	EVE_ADD_INTERNAL_CALL(polygon_collider2d_component_set_is_trigger);
+	EVE_ADD_INTERNAL_CALL(polygon_collider2d_component_set_on_trigger);
+	EVE_ADD_INTERNAL_CALL(polygon_collider2d_component_get_density);
+	EVE_ADD_INTERNAL_CALL(polygon_collider2d_component_set_density);
+	EVE_ADD_INTERNAL_CALL(polygon_collider2d_component_get_friction);
+	EVE_ADD_INTERNAL_CALL(polygon_collider2d_component_set_friction);
+	EVE_ADD_INTERNAL_CALL(polygon_collider2d_component_get_restitution);
+	EVE_ADD_INTERNAL_CALL(polygon_collider2d_component_set_restitution);
+	EVE_ADD_INTERNAL_CALL(
+			polygon_collider2d_component_get_restitution_threshold);
+	EVE_ADD_INTERNAL_CALL(
+			polygon_collider2d_component_set_restitution_threshold);
+
+	// Begin CapsuleCollider2D
+	EVE_ADD_INTERNAL_CALL(capsule_collider2d_component_get_offset);
+	EVE_ADD_INTERNAL_CALL(capsule_collider2d_component_set_offset);
+	EVE_ADD_INTERNAL_CALL(capsule_collider2d_component_get_radius);
+	EVE_ADD_INTERNAL_CALL(capsule_collider2d_component_set_radius);
+	EVE_ADD_INTERNAL_CALL(capsule_collider2d_component_get_height);
+	EVE_ADD_INTERNAL_CALL(capsule_collider2d_component_set_height);
+	EVE_ADD_INTERNAL_CALL(capsule_collider2d_component_get_is_trigger);
+	EVE_ADD_INTERNAL_CALL(capsule_collider2d_component_set_is_trigger);
+	EVE_ADD_INTERNAL_CALL(capsule_collider2d_component_set_on_trigger);
+	EVE_ADD_INTERNAL_CALL(capsule_collider2d_component_get_density);
+	EVE_ADD_INTERNAL_CALL(capsule_collider2d_component_set_density);
+	EVE_ADD_INTERNAL_CALL(capsule_collider2d_component_get_friction);
+	EVE_ADD_INTERNAL_CALL(capsule_collider2d_component_set_friction);
+	EVE_ADD_INTERNAL_CALL(capsule_collider2d_component_get_restitution);
+	EVE_ADD_INTERNAL_CALL(capsule_collider2d_component_set_restitution);
+	EVE_ADD_INTERNAL_CALL(
+			capsule_collider2d_component_get_restitution_threshold);
+	EVE_ADD_INTERNAL_CALL(
+			capsule_collider2d_component_set_restitution_threshold);
+
+	// Begin ChainCollider2D
+	EVE_ADD_INTERNAL_CALL(chain_collider2d_component_get_friction);
+	EVE_ADD_INTERNAL_CALL(chain_collider2d_component_set_friction);
+	EVE_ADD_INTERNAL_CALL(chain_collider2d_component_get_restitution);
+	EVE_ADD_INTERNAL_CALL(chain_collider2d_component_set_restitution);
+	EVE_ADD_INTERNAL_CALL(chain_collider2d_component_get_restitution_threshold);
+	EVE_ADD_INTERNAL_CALL(chain_collider2d_component_set_restitution_threshold);
+
 	// Begin PostProcessVolume
 	EVE_ADD_INTERNAL_CALL(post_process_volume_component_get_is_global);
 	EVE_ADD_INTERNAL_CALL(post_process_volume_component_set_is_global);
@@ -1180,6 +1933,30 @@ void register_functions() {
 
 	// Begin Scene Manager
 	EVE_ADD_INTERNAL_CALL(scene_manager_load_scene);
+	EVE_ADD_INTERNAL_CALL(scene_manager_get_load_progress);
+	EVE_ADD_INTERNAL_CALL(scene_manager_get_load_state);
+	EVE_ADD_INTERNAL_CALL(scene_manager_release_load);
+
+	// Begin Prefab
+	EVE_ADD_INTERNAL_CALL(prefab_load);
+	EVE_ADD_INTERNAL_CALL(prefab_instantiate);
+	EVE_ADD_INTERNAL_CALL(prefab_instantiate_batch);
+	EVE_ADD_INTERNAL_CALL(prefab_spawn);
+
+	// Begin Jobs
+	EVE_ADD_INTERNAL_CALL(jobs_execute);
+
+	// Begin Events
+	EVE_ADD_INTERNAL_CALL(events_drain);
+
+	// Begin Physics2D
+	EVE_ADD_INTERNAL_CALL(physics2d_raycast);
+	EVE_ADD_INTERNAL_CALL(physics2d_raycast_all);
+	EVE_ADD_INTERNAL_CALL(physics2d_raycast_batch);
+	EVE_ADD_INTERNAL_CALL(physics2d_overlap_box);
+	EVE_ADD_INTERNAL_CALL(physics2d_overlap_circle);
+	EVE_ADD_INTERNAL_CALL(physics2d_box_cast);
+	EVE_ADD_INTERNAL_CALL(physics2d_circle_cast);
 
 	// Begin Input
 	EVE_ADD_INTERNAL_CALL(input_is_key_pressed);
@@ -1190,4 +1967,6 @@ void register_functions() {
 	EVE_ADD_INTERNAL_CALL(input_get_scroll_offset);
 }
 
+void clear_scene_loads() { s_scene_loads.clear(); }
+
 } // namespace script_glue
@@ -7,6 +7,10 @@ void register_components();
 
 void register_functions();
 
+// forgets the scene loads started by the scripts, their handles can not be
+// polled after the run or the domain is gone
+void clear_scene_loads();
+
 }; //namespace script_glue
 
 #endif
@@ -0,0 +1,240 @@
+#include "scripting/script_jobs.h"
+
+#include "debug/log.h"
+#include "scripting/script.h"
+
+#include <mono/metadata/appdomain.h>
+#include <mono/metadata/object.h>
+#include <mono/metadata/threads.h>
+
+#include <atomic>
+#include <condition_variable>
+
+namespace script_jobs {
+
+// EveEngine.ScriptDispatcher.ExecuteJobBatch
+typedef void (*ExecuteJobBatchThunk)(int32_t job, int32_t start, int32_t end,
+		MonoException** exception);
+
+// EveEngine.ScriptDispatcher.CompleteJobs
+typedef void (*CompleteJobsThunk)(MonoException** exception);
+
+struct JobBatch {
+	int32_t job;
+	int32_t start;
+	int32_t end;
+};
+
+struct ScriptJobData {
+	MonoDomain* domain = nullptr;
+
+	ExecuteJobBatchThunk execute_batch_thunk = nullptr;
+	CompleteJobsThunk complete_jobs_thunk = nullptr;
+
+	std::vector<std::thread> workers;
+
+	std::mutex mutex;
+	std::condition_variable wave_started;
+	std::condition_variable wave_finished;
+
+	// batches of the current wave, only rebuilt while no worker is active
+	std::vector<JobBatch> batches;
+	std::atomic<uint32_t> next_batch = 0;
+	std::atomic<uint32_t> remaining_batches = 0;
+
+	// guarded by the mutex
+	uint64_t wave = 0;
+	uint32_t active_workers = 0;
+	bool stopping = false;
+};
+
+static ScriptJobData* s_data = nullptr;
+
+static thread_local bool s_is_worker = false;
+
+inline static void run_batches() {
+	const uint32_t batch_count = s_data->batches.size();
+
+	while (true) {
+		const uint32_t index = s_data->next_batch.fetch_add(1);
+		if (index >= batch_count) {
+			return;
+		}
+
+		const JobBatch& batch = s_data->batches[index];
+
+		// exceptions of the entities are caught in managed code already
+		MonoException* exception = nullptr;
+		s_data->execute_batch_thunk(
+				batch.job, batch.start, batch.end, &exception);
+
+		if (exception) {
+			log_script_exception((MonoObject*)exception);
+		}
+
+		if (s_data->remaining_batches.fetch_sub(1) == 1) {
+			std::lock_guard<std::mutex> lock(s_data->mutex);
+			s_data->wave_finished.notify_all();
+		}
+	}
+}
+
+inline static void worker_main() {
+	// the gc has to know about every thread that touches managed objects
+	MonoThread* thread = mono_thread_attach(s_data->domain);
+	s_is_worker = true;
+
+	uint64_t last_wave = 0;
+
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(s_data->mutex);
+			s_data->wave_started.wait(lock, [&]() {
+				return s_data->stopping || s_data->wave != last_wave;
+			});
+
+			if (s_data->stopping) {
+				break;
+			}
+
+			last_wave = s_data->wave;
+			s_data->active_workers++;
+		}
+
+		run_batches();
+
+		{
+			std::lock_guard<std::mutex> lock(s_data->mutex);
+			s_data->active_workers--;
+		}
+		s_data->wave_finished.notify_all();
+	}
+
+	mono_thread_detach(thread);
+}
+
+void init(MonoDomain* domain, MonoImage* core_image) {
+	EVE_PROFILE_FUNCTION();
+
+	if (s_data) {
+		shutdown();
+	}
+
+	MonoClass* dispatcher_class =
+			mono_class_from_name(core_image, "EveEngine", "ScriptDispatcher");
+	MonoMethod* execute_method = dispatcher_class
+			? mono_class_get_method_from_name(
+					  dispatcher_class, "ExecuteJobBatch", 3)
+			: nullptr;
+	MonoMethod* complete_method = dispatcher_class
+			? mono_class_get_method_from_name(
+					  dispatcher_class, "CompleteJobs", 0)
+			: nullptr;
+
+	if (!execute_method || !complete_method) {
+		EVE_LOG_ERROR("Could not find the job dispatcher, script jobs will "
+					  "not run.");
+		return;
+	}
+
+	s_data = new ScriptJobData();
+	s_data->domain = domain;
+	s_data->execute_batch_thunk = (ExecuteJobBatchThunk)
+			mono_method_get_unmanaged_thunk(execute_method);
+	s_data->complete_jobs_thunk =
+			(CompleteJobsThunk)mono_method_get_unmanaged_thunk(complete_method);
+
+	// the main thread runs batches as well while it waits
+	const uint32_t worker_count =
+			std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+	s_data->workers.reserve(worker_count);
+	for (uint32_t i = 0; i < worker_count; i++) {
+		s_data->workers.emplace_back(worker_main);
+	}
+
+	EVE_LOG_VERBOSE_TRACE("Started {} script job workers.", worker_count);
+}
+
+void shutdown() {
+	EVE_PROFILE_FUNCTION();
+
+	if (!s_data) {
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(s_data->mutex);
+		s_data->stopping = true;
+	}
+	s_data->wave_started.notify_all();
+
+	for (std::thread& worker : s_data->workers) {
+		worker.join();
+	}
+
+	delete s_data;
+	s_data = nullptr;
+}
+
+bool is_worker_thread() { return s_is_worker; }
+
+void execute(uint32_t job_count, const int32_t* entity_counts,
+		uint32_t batch_size) {
+	EVE_PROFILE_FUNCTION();
+
+	if (!s_data) {
+		return;
+	}
+
+	EVE_ASSERT(!s_is_worker, "Jobs can not be scheduled from a job.");
+
+	batch_size = std::max(batch_size, 1u);
+
+	std::unique_lock<std::mutex> lock(s_data->mutex);
+
+	// workers that are late to the last wave still read its batches
+	s_data->wave_finished.wait(
+			lock, []() { return s_data->active_workers == 0; });
+
+	s_data->batches.clear();
+	for (uint32_t job = 0; job < job_count; job++) {
+		const int32_t count = entity_counts[job];
+		for (int32_t start = 0; start < count; start += batch_size) {
+			const int32_t end = std::min(start + (int32_t)batch_size, count);
+			s_data->batches.push_back({ (int32_t)job, start, end });
+		}
+	}
+
+	if (s_data->batches.empty()) {
+		return;
+	}
+
+	s_data->next_batch = 0;
+	s_data->remaining_batches = s_data->batches.size();
+	s_data->wave++;
+
+	lock.unlock();
+	s_data->wave_started.notify_all();
+
+	run_batches();
+
+	lock.lock();
+	s_data->wave_finished.wait(
+			lock, []() { return s_data->remaining_batches == 0; });
+}
+
+void complete_scheduled() {
+	if (!s_data) {
+		return;
+	}
+
+	MonoException* exception = nullptr;
+	s_data->complete_jobs_thunk(&exception);
+
+	if (exception) {
+		log_script_exception((MonoObject*)exception);
+	}
+}
+
+} //namespace script_jobs
@@ -0,0 +1,34 @@
+#ifndef SCRIPT_JOBS_H
+#define SCRIPT_JOBS_H
+
+extern "C" {
+typedef struct _MonoDomain MonoDomain;
+typedef struct _MonoImage MonoImage;
+}
+
+// Worker threads attached to the script domain that run the entity jobs
+// scheduled from C#. Jobs only run inside execute, where the main thread runs
+// batches alongside the workers, so job code runs on several threads at once
+// but nothing else is scheduled on the main thread until the wave is done.
+namespace script_jobs {
+
+// starts the workers, has to be called again after the domain is reloaded
+void init(MonoDomain* domain, MonoImage* core_image);
+
+// detaches and joins the workers, has to be called before the domain is
+// unloaded
+void shutdown();
+
+bool is_worker_thread();
+
+// splits the entities of the jobs of a wave into batches and runs them on
+// the workers and the calling thread, returns once every batch is done
+void execute(uint32_t job_count, const int32_t* entity_counts,
+		uint32_t batch_size);
+
+// runs the jobs scheduled by the scripts that are not completed yet
+void complete_scheduled();
+
+} //namespace script_jobs
+
+#endif
@@ -0,0 +1,210 @@
+#include "scripting/script_profiler.h"
+
+#include "debug/log.h"
+
+#include <mono/metadata/profiler.h>
+
+// mono hands this back to the callbacks, there is no state to keep in it
+struct _MonoProfiler {
+	int unused;
+};
+
+const char* serialize_script_callback(ScriptCallback callback) {
+	switch (callback) {
+		case ScriptCallback::ON_CREATE:
+			return "OnCreate";
+		case ScriptCallback::ON_UPDATE:
+			return "OnUpdate";
+		case ScriptCallback::ON_DESTROY:
+			return "OnDestroy";
+		default:
+			return "Unknown";
+	}
+}
+
+double ScriptProfile::get_total_ms() const {
+	double total_ms = 0.0;
+	for (const ScriptCallStats& stats : callbacks) {
+		total_ms += stats.total_ms;
+	}
+
+	return total_ms;
+}
+
+namespace script_profiler {
+
+struct ScriptProfilerData {
+	bool enabled = false;
+	bool count_allocations = false;
+
+	uint64_t frame_count = 0;
+
+	std::unordered_map<std::string, ScriptProfile> class_profiles;
+	std::unordered_map<UID, ScriptProfile> entity_profiles;
+};
+
+static ScriptProfilerData s_data;
+
+static _MonoProfiler s_mono_profiler;
+
+// job workers allocate as well, every thread counts its own
+static thread_local uint64_t s_allocation_count = 0;
+
+inline static void on_gc_allocation(MonoProfiler*, MonoObject*) {
+	s_allocation_count++;
+}
+
+inline static void add_call(ScriptProfile& profile, ScriptCallback callback,
+		double ms, double max_ms, uint64_t allocation_count,
+		uint64_t call_count) {
+	ScriptCallStats& stats = profile.callbacks[(size_t)callback];
+	stats.call_count += call_count;
+	stats.total_ms += ms;
+	stats.max_ms = std::max(stats.max_ms, max_ms);
+
+	profile.allocation_count += allocation_count;
+}
+
+inline static Json serialize_profile(const ScriptProfile& profile) {
+	Json json = {
+		{ "class", profile.class_name },
+		{ "total_ms", profile.get_total_ms() },
+		{ "allocation_count", profile.allocation_count },
+	};
+
+	for (size_t i = 0; i < SCRIPT_CALLBACK_COUNT; i++) {
+		const ScriptCallStats& stats = profile.callbacks[i];
+		if (!stats.call_count) {
+			continue;
+		}
+
+		json[serialize_script_callback((ScriptCallback)i)] = {
+			{ "call_count", stats.call_count },
+			{ "total_ms", stats.total_ms },
+			{ "average_ms", stats.total_ms / stats.call_count },
+			{ "max_ms", stats.max_ms },
+		};
+	}
+
+	return json;
+}
+
+void init(bool count_allocations) {
+	if (!count_allocations) {
+		return;
+	}
+
+	s_data.count_allocations = mono_profiler_enable_allocations();
+	if (!s_data.count_allocations) {
+		EVE_LOG_WARNING("Managed allocations will not be profiled.");
+		return;
+	}
+
+	MonoProfilerHandle handle = mono_profiler_create(&s_mono_profiler);
+	mono_profiler_set_gc_allocation_callback(handle, on_gc_allocation);
+}
+
+bool is_enabled() { return s_data.enabled; }
+
+void set_enabled(bool enabled) { s_data.enabled = enabled; }
+
+bool is_counting_allocations() { return s_data.count_allocations; }
+
+uint64_t get_allocation_count() { return s_allocation_count; }
+
+void reset() {
+	s_data.frame_count = 0;
+	s_data.class_profiles.clear();
+	s_data.entity_profiles.clear();
+}
+
+void on_frame() {
+	if (s_data.enabled) {
+		s_data.frame_count++;
+	}
+}
+
+uint64_t get_frame_count() { return s_data.frame_count; }
+
+void record_class(const std::string& class_name, ScriptCallback callback,
+		double ms, uint64_t allocation_count) {
+	record_class_batch(class_name, callback, ms, ms, allocation_count, 1);
+}
+
+void record_class_batch(const std::string& class_name,
+		ScriptCallback callback, double ms, double max_ms,
+		uint64_t allocation_count, uint64_t call_count) {
+	ScriptProfile& profile = s_data.class_profiles[class_name];
+	if (profile.class_name.empty()) {
+		profile.class_name = class_name;
+	}
+
+	add_call(profile, callback, ms, max_ms, allocation_count, call_count);
+}
+
+void record_entity(UID entity_id, const std::string& class_name,
+		ScriptCallback callback, double ms, uint64_t allocation_count) {
+	ScriptProfile& profile = s_data.entity_profiles[entity_id];
+	if (profile.class_name.empty()) {
+		profile.class_name = class_name;
+	}
+
+	add_call(profile, callback, ms, ms, allocation_count, 1);
+}
+
+const std::unordered_map<std::string, ScriptProfile>& get_class_profiles() {
+	return s_data.class_profiles;
+}
+
+const std::unordered_map<UID, ScriptProfile>& get_entity_profiles() {
+	return s_data.entity_profiles;
+}
+
+Json serialize() {
+	Json classes = Json::array();
+	for (const auto& [name, profile] : s_data.class_profiles) {
+		classes.push_back(serialize_profile(profile));
+	}
+
+	Json entities = Json::array();
+	for (const auto& [entity_id, profile] : s_data.entity_profiles) {
+		Json entity_json = serialize_profile(profile);
+		entity_json["entity"] = (uint64_t)entity_id;
+
+		entities.push_back(entity_json);
+	}
+
+	return {
+		{ "frame_count", s_data.frame_count },
+		{ "counts_allocations", s_data.count_allocations },
+		{ "classes", classes },
+		{ "entities", entities },
+	};
+}
+
+} //namespace script_profiler
+
+ScriptProfileScope::ScriptProfileScope(const std::string& class_name,
+		UID entity_id, ScriptCallback callback) :
+		class_name(class_name),
+		entity_id(entity_id),
+		callback(callback),
+		enabled(script_profiler::is_enabled()) {
+	if (enabled) {
+		allocation_count = script_profiler::get_allocation_count();
+	}
+}
+
+ScriptProfileScope::~ScriptProfileScope() {
+	if (!enabled) {
+		return;
+	}
+
+	const double ms = timer.get_elapsed_milliseconds();
+	const uint64_t allocation_count =
+			script_profiler::get_allocation_count() - this->allocation_count;
+
+	script_profiler::record_class(class_name, callback, ms, allocation_count);
+	script_profiler::record_entity(
+			entity_id, class_name, callback, ms, allocation_count);
+}
@@ -0,0 +1,99 @@
+#ifndef SCRIPT_PROFILER_H
+#define SCRIPT_PROFILER_H
+
+#include "core/json_utils.h"
+#include "core/timer.h"
+#include "core/uid.h"
+
+enum class ScriptCallback {
+	ON_CREATE = 0,
+	ON_UPDATE,
+	ON_DESTROY,
+};
+
+inline constexpr size_t SCRIPT_CALLBACK_COUNT = 3;
+
+const char* serialize_script_callback(ScriptCallback callback);
+
+struct ScriptCallStats {
+	uint64_t call_count = 0;
+	double total_ms = 0.0;
+	double max_ms = 0.0;
+};
+
+struct ScriptProfile {
+	std::string class_name;
+	ScriptCallStats callbacks[SCRIPT_CALLBACK_COUNT];
+	// managed objects allocated while the callbacks ran
+	uint64_t allocation_count = 0;
+
+	inline const ScriptCallStats& get(ScriptCallback callback) const {
+		return callbacks[(size_t)callback];
+	}
+
+	double get_total_ms() const;
+};
+
+// Time spent in the script callbacks and the managed allocations they made,
+// per script class and per entity. Nothing is recorded while the profiler is
+// disabled.
+namespace script_profiler {
+
+// has to be called before mono is initialized, counting allocations turns
+// off the inline allocation fast path of mono so it is left out of runtime
+// builds
+void init(bool count_allocations);
+
+bool is_enabled();
+void set_enabled(bool enabled);
+
+bool is_counting_allocations();
+
+// managed objects allocated by the calling thread so far
+uint64_t get_allocation_count();
+
+void reset();
+
+// called once per updated frame so that the timings can be averaged
+void on_frame();
+
+uint64_t get_frame_count();
+
+void record_class(const std::string& class_name, ScriptCallback callback,
+		double ms, uint64_t allocation_count);
+
+// calls made at once, max_ms is the slowest one of them
+void record_class_batch(const std::string& class_name,
+		ScriptCallback callback, double ms, double max_ms,
+		uint64_t allocation_count, uint64_t call_count);
+
+void record_entity(UID entity_id, const std::string& class_name,
+		ScriptCallback callback, double ms, uint64_t allocation_count = 0);
+
+const std::unordered_map<std::string, ScriptProfile>& get_class_profiles();
+
+const std::unordered_map<UID, ScriptProfile>& get_entity_profiles();
+
+Json serialize();
+
+} //namespace script_profiler
+
+// Records the callback of a single entity under its class and the entity
+// when the profiler is enabled.
+class ScriptProfileScope {
+public:
+	ScriptProfileScope(const std::string& class_name, UID entity_id,
+			ScriptCallback callback);
+	~ScriptProfileScope();
+
+private:
+	const std::string& class_name;
+	UID entity_id;
+	ScriptCallback callback;
+
+	bool enabled;
+	uint64_t allocation_count = 0;
+	Timer timer;
+};
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef COMMANDS_H
+#define COMMANDS_H
+
+#include "headless_utils.h"
+
+// every command returns the process exit code
+
+int run_determinism(const HeadlessArgs& args);
+
+int run_physics_bench(const HeadlessArgs& args);
+
+int run_cook_scene(const HeadlessArgs& args);
+
+int run_scene_load_bench(const HeadlessArgs& args);
+
+int run_scene_copy_bench(const HeadlessArgs& args);
+
+int run_hierarchy_bench(const HeadlessArgs& args);
+
+int run_script_update_bench(const HeadlessArgs& args);
+
+#endif
@@ -0,0 +1,73 @@
+#include "commands.h"
+
+#include "project/project.h"
+#include "scene/components.h"
+#include "scripting/script_engine.h"
+
+inline static size_t get_scene_file_size(const std::string& path) {
+	std::error_code error;
+	const size_t size = fs::file_size(Project::get_asset_path(path), error);
+	return error ? 0 : size;
+}
+
+int run_cook_scene(const HeadlessArgs& args) {
+	if (!args.has("scene")) {
+		EVE_LOG_ERROR("No scene to cook given, use --scene.");
+		return 1;
+	}
+
+	const std::string scene_path = args.get_string("scene", "");
+
+	Ref<Scene> scene = load_headless_scene(args);
+	if (!scene) {
+		return 1;
+	}
+
+	// cooked scenes lay next to their sources by default
+	std::string target_path = args.get_string("target", "");
+	if (target_path.empty()) {
+		fs::path path = scene_path.starts_with("res://")
+				? fs::path(scene_path)
+				: fs::path("res://" + scene_path);
+		target_path = path.replace_extension(SCENE_BINARY_EXTENSION).string();
+	}
+
+	if (!ScriptEngine::is_initialized() &&
+			scene->view<ScriptComponent>().size() > 0) {
+		EVE_LOG_WARNING("Scene has scripts but the script runtime is not "
+						"loaded, field values will not be cooked. Use "
+						"--scripts to load the project assembly.");
+	}
+
+	Scene::serialize_binary(scene, target_path);
+
+	// make sure the runtime will be able to read it back
+	Ref<Scene> cooked_scene = create_ref<Scene>();
+	if (!Scene::deserialize_binary(cooked_scene, target_path)) {
+		EVE_LOG_ERROR("Unable to read the cooked scene back.");
+		return 1;
+	}
+
+	const size_t entity_count = scene->view<IdComponent>().size();
+	const size_t cooked_entity_count =
+			cooked_scene->view<IdComponent>().size();
+
+	if (entity_count != cooked_entity_count) {
+		EVE_LOG_ERROR("Cooked scene has {} entities, expected {}.",
+				cooked_entity_count, entity_count);
+		return 1;
+	}
+
+	const Json result = {
+		{ "command", "cook_scene" },
+		{ "source", scene_path },
+		{ "target", target_path },
+		{ "entity_count", entity_count },
+		{ "source_bytes", get_scene_file_size(scene_path) },
+		{ "target_bytes", get_scene_file_size(target_path) },
+	};
+
+	write_headless_result(args, result);
+
+	return 0;
+}
@@ -0,0 +1,83 @@
+#include "commands.h"
+
+#include "physics/physics_system.h"
+
+inline static std::string hash_to_string(uint64_t hash) {
+	return std::format("{:016x}", hash);
+}
+
+int run_determinism(const HeadlessArgs& args) {
+	const uint32_t runs = (uint32_t)std::max<int64_t>(args.get_int("runs", 3), 2);
+	const uint32_t frames =
+			(uint32_t)std::max<int64_t>(args.get_int("frames", 600), 1);
+
+	Ref<Scene> source_scene = load_headless_scene(args);
+	if (!source_scene) {
+		return 1;
+	}
+
+	PhysicsSettings& source_settings =
+			source_scene->get_physics_system().get_settings();
+	source_settings.deterministic = true;
+
+	// per frame state hashes of every run
+	std::vector<std::vector<uint64_t>> hashes(runs);
+
+	for (uint32_t run = 0; run < runs; run++) {
+		// every run gets a fresh copy, just like entering play mode
+		Ref<Scene> scene = Scene::copy(source_scene);
+		PhysicsSystem& physics_system = scene->get_physics_system();
+
+		scene->start();
+
+		hashes[run].reserve(frames);
+		for (uint32_t frame = 0; frame < frames; frame++) {
+			scene->update(source_settings.fixed_time_step);
+			hashes[run].push_back(physics_system.compute_state_hash());
+		}
+
+		scene->stop();
+	}
+
+	bool deterministic = true;
+
+	Json runs_json = Json::array();
+	for (uint32_t run = 0; run < runs; run++) {
+		int64_t first_divergent_frame = -1;
+		for (uint32_t frame = 0; frame < frames; frame++) {
+			if (hashes[run][frame] != hashes[0][frame]) {
+				first_divergent_frame = frame;
+				break;
+			}
+		}
+
+		if (first_divergent_frame != -1) {
+			deterministic = false;
+		}
+
+		runs_json.push_back({
+				{ "run", run },
+				{ "final_hash", hash_to_string(hashes[run].back()) },
+				{ "first_divergent_frame", first_divergent_frame },
+		});
+	}
+
+	const Json result = {
+		{ "command", "determinism" },
+		{ "scene", args.get_string("scene", "pyramid") },
+		{ "runs", runs },
+		{ "frames", frames },
+		{ "fixed_time_step", source_settings.fixed_time_step },
+		{ "deterministic", deterministic },
+		{ "results", runs_json },
+	};
+
+	write_headless_result(args, result);
+
+	if (!deterministic) {
+		EVE_LOG_ERROR("Physics state diverged between runs.");
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,91 @@
+#include "commands.h"
+
+#include "debug/log.h"
+#include "project/project.h"
+#include "scripting/script_engine.h"
+
+typedef int (*CommandFunction)(const HeadlessArgs& args);
+
+struct Command {
+	const char* name;
+	const char* description;
+	CommandFunction function;
+};
+
+inline static const Command s_commands[] = {
+	{ "determinism", "Compares per frame physics state hashes of N runs.",
+			run_determinism },
+	{ "bench_physics", "Measures physics step times of builtin scenes.",
+			run_physics_bench },
+	{ "cook_scene", "Converts a json scene to the binary runtime format.",
+			run_cook_scene },
+	{ "bench_scene_load", "Compares json and binary scene load times.",
+			run_scene_load_bench },
+	{ "bench_scene_copy", "Measures the scene copy made to enter play mode.",
+			run_scene_copy_bench },
+	{ "bench_hierarchy", "Measures hierarchy traversal, reparent and destroy.",
+			run_hierarchy_bench },
+	{ "bench_script_update", "Compares batched and per entity script updates.",
+			run_script_update_bench },
+};
+
+inline static void print_usage() {
+	std::cout << "Usage: headless <command> [--option value]...\n\n"
+			  << "Commands:\n";
+
+	for (const Command& command : s_commands) {
+		std::cout << std::format(
+				"  {:<20}{}\n", command.name, command.description);
+	}
+}
+
+inline static bool setup_project(const HeadlessArgs& args) {
+	if (args.has("project")) {
+		return Project::load(args.get_string("project", "")) != nullptr;
+	}
+
+	// scenes need an active project for their asset registries
+	const fs::path project_dir = fs::temp_directory_path() / "eve_headless";
+	fs::create_directories(project_dir);
+
+	return Project::create(project_dir / "headless.eve") != nullptr;
+}
+
+int main(int argc, const char** argv) {
+	Logger::init("headless.log");
+
+	if (argc < 2) {
+		print_usage();
+		return 1;
+	}
+
+	const std::string_view command_name = argv[1];
+
+	const auto command = std::find_if(std::begin(s_commands),
+			std::end(s_commands), [&](const Command& command) {
+				return command_name == command.name;
+			});
+
+	if (command == std::end(s_commands)) {
+		print_usage();
+		return 1;
+	}
+
+	const HeadlessArgs args(argc, argv);
+
+	if (!setup_project(args)) {
+		EVE_LOG_ERROR("Unable to setup the project.");
+		return 1;
+	}
+
+	// scenes with scripts need the project assembly for their field values
+	if (args.has("scripts")) {
+		ScriptEngine::init({ .is_runtime = true });
+	}
+
+	const int result = command->function(args);
+
+	ScriptEngine::shutdown();
+
+	return result;
+}
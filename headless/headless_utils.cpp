@@ -0,0 +1,90 @@
+#include "headless_utils.h"
+
+#include "scene_builders.h"
+
+HeadlessArgs::HeadlessArgs(int argc, const char** argv, int first_arg) {
+	for (int i = first_arg; i < argc; i++) {
+		const std::string_view arg = argv[i];
+		if (!arg.starts_with("--")) {
+			EVE_LOG_WARNING("Ignoring unknown argument '{}'.", arg);
+			continue;
+		}
+
+		const std::string name(arg.substr(2));
+
+		const bool has_value =
+				i + 1 < argc && !std::string_view(argv[i + 1]).starts_with("--");
+		values[name] = has_value ? argv[++i] : "true";
+	}
+}
+
+bool HeadlessArgs::has(const std::string& name) const {
+	return values.find(name) != values.end();
+}
+
+std::string HeadlessArgs::get_string(
+		const std::string& name, const std::string& default_value) const {
+	const auto it = values.find(name);
+	return it != values.end() ? it->second : default_value;
+}
+
+int64_t HeadlessArgs::get_int(
+		const std::string& name, int64_t default_value) const {
+	const auto it = values.find(name);
+	if (it == values.end()) {
+		return default_value;
+	}
+
+	int64_t value = default_value;
+	const auto [_, error] = std::from_chars(it->second.data(),
+			it->second.data() + it->second.size(), value);
+	if (error != std::errc()) {
+		EVE_LOG_WARNING("Invalid value '{}' for --{}, using {}.", it->second,
+				name, default_value);
+		return default_value;
+	}
+
+	return value;
+}
+
+void HeadlessArgs::set(const std::string& name, const std::string& value) {
+	values[name] = value;
+}
+
+Ref<Scene> load_headless_scene(const HeadlessArgs& args) {
+	const std::string scene_name = args.get_string("scene", "pyramid");
+
+	if (scene_name.starts_with("res://")) {
+		Ref<Scene> scene = create_ref<Scene>();
+		if (!Scene::deserialize(scene, scene_name)) {
+			return nullptr;
+		}
+
+		return scene;
+	}
+
+	return scene_builders::build(scene_name);
+}
+
+Json get_timing_stats(const std::vector<float>& times) {
+	if (times.empty()) {
+		return nullptr;
+	}
+
+	const float total_ms = std::accumulate(times.begin(), times.end(), 0.0f);
+
+	return {
+		{ "mean", total_ms / times.size() },
+		{ "min", *std::min_element(times.begin(), times.end()) },
+		{ "max", *std::max_element(times.begin(), times.end()) },
+	};
+}
+
+void write_headless_result(const HeadlessArgs& args, const Json& result) {
+	if (args.has("output")) {
+		json_utils::write_file(args.get_string("output", ""), result);
+		return;
+	}
+
+	std::cout << result.dump(2) << "\n";
+}
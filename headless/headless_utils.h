@@ -0,0 +1,45 @@
+#ifndef HEADLESS_UTILS_H
+#define HEADLESS_UTILS_H
+
+#include "core/json_utils.h"
+#include "scene/scene.h"
+
+#if defined(EVE_DEBUG)
+inline constexpr const char* BUILD_CONFIG = "debug";
+#elif defined(EVE_RELEASE)
+inline constexpr const char* BUILD_CONFIG = "release";
+#elif defined(EVE_DIST)
+inline constexpr const char* BUILD_CONFIG = "dist";
+#else
+inline constexpr const char* BUILD_CONFIG = "unknown";
+#endif
+
+// Parses "--name value" pairs, a flag without a value is stored as "true".
+class HeadlessArgs {
+public:
+	HeadlessArgs(int argc, const char** argv, int first_arg = 2);
+
+	bool has(const std::string& name) const;
+
+	std::string get_string(
+			const std::string& name, const std::string& default_value) const;
+
+	int64_t get_int(const std::string& name, int64_t default_value) const;
+
+	void set(const std::string& name, const std::string& value);
+
+private:
+	std::unordered_map<std::string, std::string> values;
+};
+
+// Creates the scene given with --scene, either a builtin one or a scene file
+// of the active project.
+Ref<Scene> load_headless_scene(const HeadlessArgs& args);
+
+// mean, min and max of the given durations
+Json get_timing_stats(const std::vector<float>& times);
+
+// Writes the result to the file given with --output or to stdout.
+void write_headless_result(const HeadlessArgs& args, const Json& result);
+
+#endif
@@ -0,0 +1,151 @@
+#include "commands.h"
+
+#include "core/timer.h"
+#include "scene/entity.h"
+
+// Entities are split evenly into the levels, every entity is parented to one
+// of the entities of the level above so that the tree has the given depth.
+inline static std::vector<std::vector<Entity>> build_tree(
+		Ref<Scene> scene, uint32_t node_count, uint32_t depth) {
+	std::vector<std::vector<Entity>> levels(depth);
+
+	const uint32_t level_size = std::max(node_count / depth, 1u);
+
+	for (uint32_t level = 0; level < depth; level++) {
+		// remaining entities go to the last level
+		const uint32_t count = level + 1 == depth
+				? node_count - level_size * (depth - 1)
+				: level_size;
+
+		levels[level].reserve(count);
+
+		for (uint32_t i = 0; i < count; i++) {
+			Entity entity = scene->create(std::format("Node{}_{}", level, i));
+			if (level > 0) {
+				const auto& parents = levels[level - 1];
+				entity.set_parent(parents[i % parents.size()]);
+			}
+
+			levels[level].push_back(entity);
+		}
+	}
+
+	return levels;
+}
+
+int run_hierarchy_bench(const HeadlessArgs& args) {
+	const uint32_t iterations =
+			(uint32_t)std::max<int64_t>(args.get_int("iterations", 10), 1);
+	const uint32_t depth =
+			(uint32_t)std::max<int64_t>(args.get_int("depth", 10), 1);
+	const uint32_t node_count = (uint32_t)std::max<int64_t>(
+			args.get_int("nodes", 100000), depth);
+
+	EVE_LOG_INFO("Running hierarchy bench with {} nodes, {} levels.",
+			node_count, depth);
+
+	std::vector<float> build_times;
+	std::vector<float> traverse_times;
+	std::vector<float> sort_times;
+	std::vector<float> sorted_view_times;
+	std::vector<float> reparent_times;
+	std::vector<float> destroy_times;
+
+	bool valid = true;
+
+	for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+		Ref<Scene> scene = create_ref<Scene>("hierarchy");
+
+		Timer timer;
+		const auto levels = build_tree(scene, node_count, depth);
+		build_times.push_back(timer.get_elapsed_milliseconds());
+
+		// walk every tree starting from the top level
+		timer = Timer();
+
+		uint32_t visited = 0;
+		uint64_t depth_sum = 0;
+		for (Entity root : levels.front()) {
+			root.each_descendant([&](Entity entity) {
+				visited++;
+				depth_sum += entity.get_relation().depth;
+			});
+		}
+
+		traverse_times.push_back(timer.get_elapsed_milliseconds());
+
+		valid &= visited == node_count - levels.front().size();
+
+		timer = Timer();
+		scene->sort_by_depth();
+		sort_times.push_back(timer.get_elapsed_milliseconds());
+
+		// parents have to come before their children after sorting
+		timer = Timer();
+
+		uint32_t last_depth = 0;
+		bool sorted = true;
+		scene->view<RelationComponent>().each(
+				[&](const RelationComponent& relation) {
+					sorted &= relation.depth >= last_depth;
+					last_depth = relation.depth;
+				});
+
+		sorted_view_times.push_back(timer.get_elapsed_milliseconds());
+
+		valid &= sorted;
+
+		// move the deepest level under other parents of the level above
+		timer = Timer();
+
+		if (depth > 1) {
+			const auto& parents = levels[depth - 2];
+			const auto& children = levels[depth - 1];
+			for (uint32_t i = 0; i < children.size(); i++) {
+				Entity child = children[i];
+				child.set_parent(parents[(i + 1) % parents.size()]);
+			}
+		}
+
+		reparent_times.push_back(timer.get_elapsed_milliseconds());
+
+		// children go along with their parents
+		timer = Timer();
+
+		for (Entity root : levels.front()) {
+			scene->destroy(root);
+		}
+
+		destroy_times.push_back(timer.get_elapsed_milliseconds());
+
+		valid &= scene->view<IdComponent>().size() == 0;
+
+		if (iteration == 0) {
+			EVE_LOG_INFO("Visited {} entities, depth sum {}.", visited,
+					depth_sum);
+		}
+	}
+
+	if (!valid) {
+		EVE_LOG_ERROR("Hierarchy does not match the built tree.");
+	}
+
+	const Json result = {
+		{ "command", "bench_hierarchy" },
+		{ "config", BUILD_CONFIG },
+		{ "node_count", node_count },
+		{ "depth", depth },
+		{ "iterations", iterations },
+		{ "build_ms", get_timing_stats(build_times) },
+		{ "traverse_ms", get_timing_stats(traverse_times) },
+		{ "sort_ms", get_timing_stats(sort_times) },
+		{ "sorted_view_ms", get_timing_stats(sorted_view_times) },
+		{ "reparent_ms", get_timing_stats(reparent_times) },
+		{ "destroy_ms", get_timing_stats(destroy_times) },
+		{ "valid", valid },
+	};
+
+	write_headless_result(args, result);
+
+	return valid ? 0 : 1;
+}
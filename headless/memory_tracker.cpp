@@ -0,0 +1,92 @@
+#include "memory_tracker.h"
+
+#include <atomic>
+#include <new>
+
+// every block starts with its size so it can be subtracted on free, the
+// header keeps the default new alignment of the returned pointer
+inline constexpr size_t HEADER_SIZE = alignof(std::max_align_t);
+
+static std::atomic<size_t> s_allocated_bytes = 0;
+static std::atomic<size_t> s_peak_bytes = 0;
+
+inline static void* tracked_alloc(size_t size) {
+	uint8_t* block = (uint8_t*)malloc(size + HEADER_SIZE);
+	if (!block) {
+		return nullptr;
+	}
+
+	*(size_t*)block = size;
+
+	const size_t allocated =
+			s_allocated_bytes.fetch_add(size, std::memory_order_relaxed) +
+			size;
+
+	size_t peak = s_peak_bytes.load(std::memory_order_relaxed);
+	while (allocated > peak &&
+			!s_peak_bytes.compare_exchange_weak(
+					peak, allocated, std::memory_order_relaxed)) {
+	}
+
+	return block + HEADER_SIZE;
+}
+
+inline static void tracked_free(void* ptr) {
+	if (!ptr) {
+		return;
+	}
+
+	uint8_t* block = (uint8_t*)ptr - HEADER_SIZE;
+	s_allocated_bytes.fetch_sub(*(size_t*)block, std::memory_order_relaxed);
+
+	free(block);
+}
+
+namespace memory_tracker {
+
+size_t get_allocated_bytes() {
+	return s_allocated_bytes.load(std::memory_order_relaxed);
+}
+
+size_t get_peak_bytes() { return s_peak_bytes.load(std::memory_order_relaxed); }
+
+void reset_peak() {
+	s_peak_bytes.store(get_allocated_bytes(), std::memory_order_relaxed);
+}
+
+} //namespace memory_tracker
+
+void* operator new(size_t size) {
+	void* ptr = tracked_alloc(size);
+	if (!ptr) {
+		throw std::bad_alloc();
+	}
+
+	return ptr;
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+	return tracked_alloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+	return tracked_alloc(size);
+}
+
+void operator delete(void* ptr) noexcept { tracked_free(ptr); }
+
+void operator delete[](void* ptr) noexcept { tracked_free(ptr); }
+
+void operator delete(void* ptr, size_t) noexcept { tracked_free(ptr); }
+
+void operator delete[](void* ptr, size_t) noexcept { tracked_free(ptr); }
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+	tracked_free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+	tracked_free(ptr);
+}
@@ -0,0 +1,18 @@
+#ifndef MEMORY_TRACKER_H
+#define MEMORY_TRACKER_H
+
+// Heap usage of everything allocated through the global operator new, the
+// headless executable replaces the global allocation functions to count it.
+// Memory allocated with malloc directly (e.g. by Box2D) is not included.
+namespace memory_tracker {
+
+size_t get_allocated_bytes();
+
+size_t get_peak_bytes();
+
+// restarts the peak measurement from the current usage
+void reset_peak();
+
+} //namespace memory_tracker
+
+#endif
@@ -0,0 +1,129 @@
+#include "commands.h"
+
+#include "core/timer.h"
+#include "physics/physics_system.h"
+#include "scene_builders.h"
+
+// nearest rank percentile of sorted samples
+inline static float get_percentile(
+		const std::vector<float>& sorted_samples, float percentile) {
+	if (sorted_samples.empty()) {
+		return 0.0f;
+	}
+
+	const size_t rank = (size_t)std::ceil(
+			percentile / 100.0f * (float)sorted_samples.size());
+	return sorted_samples[std::clamp<size_t>(rank, 1, sorted_samples.size()) -
+			1];
+}
+
+inline static Json run_scene_bench(
+		const std::string& scene_name, Ref<Scene> source_scene,
+		uint32_t warmup_steps, uint32_t steps) {
+	// the bench should not depend on how long the previous step took
+	PhysicsSettings& settings =
+			source_scene->get_physics_system().get_settings();
+	settings.deterministic = true;
+
+	Ref<Scene> scene = Scene::copy(source_scene);
+	PhysicsSystem& physics_system = scene->get_physics_system();
+
+	Timer start_timer;
+	scene->start();
+	const float start_ms = start_timer.get_elapsed_milliseconds();
+
+	for (uint32_t i = 0; i < warmup_steps; i++) {
+		scene->update(settings.fixed_time_step);
+	}
+
+	const uint64_t trigger_events_before =
+			scene_builders::get_trigger_event_count();
+
+	std::vector<float> step_times;
+	step_times.reserve(steps);
+
+	uint32_t max_contact_count = 0;
+
+	for (uint32_t i = 0; i < steps; i++) {
+		Timer step_timer;
+		scene->update(settings.fixed_time_step);
+		step_times.push_back(step_timer.get_elapsed_milliseconds());
+
+		max_contact_count = std::max(
+				max_contact_count, physics_system.get_stats().contact_count);
+	}
+
+	const PhysicsStats stats = physics_system.get_stats();
+	const uint64_t trigger_events =
+			scene_builders::get_trigger_event_count() - trigger_events_before;
+
+	scene->stop();
+
+	const float total_ms =
+			std::accumulate(step_times.begin(), step_times.end(), 0.0f);
+
+	std::sort(step_times.begin(), step_times.end());
+
+	return {
+		{ "scene", scene_name },
+		{ "body_count", stats.body_count },
+		{ "awake_body_count", stats.awake_body_count },
+		{ "contact_count", stats.contact_count },
+		{ "max_contact_count", max_contact_count },
+		{ "trigger_events", trigger_events },
+		{ "start_ms", start_ms },
+		{ "steps", steps },
+		{ "total_ms", total_ms },
+		{ "step_ms",
+				{
+						{ "mean", steps > 0 ? total_ms / steps : 0.0f },
+						{ "p50", get_percentile(step_times, 50.0f) },
+						{ "p90", get_percentile(step_times, 90.0f) },
+						{ "p99", get_percentile(step_times, 99.0f) },
+						{ "max", step_times.empty() ? 0.0f : step_times.back() },
+				} },
+	};
+}
+
+int run_physics_bench(const HeadlessArgs& args) {
+	const uint32_t steps =
+			(uint32_t)std::max<int64_t>(args.get_int("steps", 600), 1);
+	const uint32_t warmup_steps =
+			(uint32_t)std::max<int64_t>(args.get_int("warmup", 60), 0);
+
+	std::vector<std::string> scene_names;
+	if (args.has("scene")) {
+		scene_names.push_back(args.get_string("scene", ""));
+	} else {
+		scene_names.assign(std::begin(scene_builders::BUILTIN_SCENES),
+				std::end(scene_builders::BUILTIN_SCENES));
+	}
+
+	Json results = Json::array();
+	for (const std::string& scene_name : scene_names) {
+		HeadlessArgs scene_args = args;
+		scene_args.set("scene", scene_name);
+
+		Ref<Scene> scene = load_headless_scene(scene_args);
+		if (!scene) {
+			return 1;
+		}
+
+		EVE_LOG_INFO("Running physics bench on '{}'.", scene_name);
+
+		results.push_back(
+				run_scene_bench(scene_name, scene, warmup_steps, steps));
+	}
+
+	const Json result = {
+		{ "command", "bench_physics" },
+		{ "config", BUILD_CONFIG },
+		{ "warmup_steps", warmup_steps },
+		{ "steps", steps },
+		{ "results", results },
+	};
+
+	write_headless_result(args, result);
+
+	return 0;
+}
@@ -0,0 +1,277 @@
+#include "scene_builders.h"
+
+#include "physics/tile_collision.h"
+#include "scene/components.h"
+#include "scene/entity.h"
+
+namespace scene_builders {
+
+inline static Entity create_box(Ref<Scene> scene, const std::string& name,
+		const glm::vec2& position, const glm::vec2& size,
+		Rigidbody2D::BodyType type) {
+	Entity entity = scene->create(name);
+
+	Transform& transform = entity.get_transform();
+	transform.local_position = { position, 0.0f };
+	transform.local_scale = { size, 1.0f };
+
+	entity.add_component<Rigidbody2D>().type = type;
+	entity.add_component<BoxCollider2D>();
+
+	return entity;
+}
+
+Ref<Scene> build_pyramid(uint32_t base_size) {
+	Ref<Scene> scene = create_ref<Scene>("pyramid");
+
+	create_box(scene, "Ground", { 0.0f, -0.5f },
+			{ base_size * 2.0f + 10.0f, 1.0f }, Rigidbody2D::BodyType::STATIC);
+
+	for (uint32_t row = 0; row < base_size; row++) {
+		const uint32_t count = base_size - row;
+		const float start_x = -(float)(count - 1) * 0.5f;
+
+		for (uint32_t i = 0; i < count; i++) {
+			create_box(scene, std::format("Box{}_{}", row, i),
+					{ start_x + i, row + 0.5f }, { 1.0f, 1.0f },
+					Rigidbody2D::BodyType::DYNAMIC);
+		}
+	}
+
+	return scene;
+}
+
+inline static Entity create_circle(Ref<Scene> scene, const std::string& name,
+		const glm::vec2& position, float radius) {
+	Entity entity = scene->create(name);
+	entity.get_transform().local_position = { position, 0.0f };
+
+	entity.add_component<Rigidbody2D>().type = Rigidbody2D::BodyType::DYNAMIC;
+	entity.add_component<CircleCollider2D>().radius = radius;
+
+	return entity;
+}
+
+// static walls around [-half_width, half_width] on x, starting from y = 0
+inline static void create_container(
+		Ref<Scene> scene, float half_width, float height) {
+	create_box(scene, "Ground", { 0.0f, -0.5f },
+			{ half_width * 2.0f + 2.0f, 1.0f }, Rigidbody2D::BodyType::STATIC);
+	create_box(scene, "LeftWall", { -half_width - 0.5f, height * 0.5f },
+			{ 1.0f, height }, Rigidbody2D::BodyType::STATIC);
+	create_box(scene, "RightWall", { half_width + 0.5f, height * 0.5f },
+			{ 1.0f, height }, Rigidbody2D::BodyType::STATIC);
+}
+
+Ref<Scene> build_falling_circles(uint32_t count) {
+	Ref<Scene> scene = create_ref<Scene>("falling_circles");
+
+	constexpr uint32_t columns = 40;
+	const uint32_t rows = (count + columns - 1) / columns;
+
+	create_container(scene, columns * 0.5f, rows + 10.0f);
+
+	for (uint32_t i = 0; i < count; i++) {
+		const uint32_t column = i % columns;
+		const uint32_t row = i / columns;
+
+		// shift every other row so the circles do not stack perfectly
+		const float offset = (row % 2) * 0.25f;
+
+		create_circle(scene, std::format("Circle{}", i),
+				{ column - columns * 0.5f + 0.5f + offset, row + 2.0f }, 0.4f);
+	}
+
+	return scene;
+}
+
+Ref<Scene> build_tile_field(uint32_t width, uint32_t height, bool bake) {
+	Ref<Scene> scene =
+			create_ref<Scene>(bake ? "tile_field_baked" : "tile_field");
+
+	// terrain with a few holes and steps, cell (0, 0) is at the origin
+	TileGrid grid(width, height);
+	for (uint32_t x = 0; x < width; x++) {
+		const uint32_t column_height = height / 2 + (x / 8) % 4;
+		if (x % 32 == 16) {
+			continue;
+		}
+
+		for (uint32_t y = 0; y < column_height; y++) {
+			grid.set_solid(x, y);
+		}
+	}
+
+	grid.origin = { -(float)width * 0.5f, -(float)height };
+
+	if (bake) {
+		const auto outlines = tile_collision::build_outlines(grid);
+		for (size_t i = 0; i < outlines.size(); i++) {
+			Entity entity = scene->create(std::format("Outline{}", i));
+			entity.add_component<Rigidbody2D>();
+			entity.add_component<ChainCollider2D>().points = outlines[i];
+		}
+	} else {
+		for (uint32_t y = 0; y < height; y++) {
+			for (uint32_t x = 0; x < width; x++) {
+				if (!grid.is_solid(x, y)) {
+					continue;
+				}
+
+				create_box(scene, std::format("Tile{}_{}", x, y),
+						grid.origin + glm::vec2(x + 0.5f, y + 0.5f),
+						{ 1.0f, 1.0f }, Rigidbody2D::BodyType::STATIC);
+			}
+		}
+	}
+
+	// drop some boxes on the terrain
+	for (uint32_t i = 0; i < width; i++) {
+		create_box(scene, std::format("Box{}", i),
+				{ grid.origin.x + i + 0.5f, 4.0f + (i % 3) * 1.5f },
+				{ 0.8f, 0.8f }, Rigidbody2D::BodyType::DYNAMIC);
+	}
+
+	return scene;
+}
+
+static uint64_t s_trigger_event_count = 0;
+
+static void on_trigger(uint64_t id) { s_trigger_event_count++; }
+
+uint64_t get_trigger_event_count() { return s_trigger_event_count; }
+
+Ref<Scene> build_triggers(uint32_t count) {
+	Ref<Scene> scene = create_ref<Scene>("triggers");
+
+	constexpr uint32_t columns = 40;
+	const uint32_t rows = (count + columns - 1) / columns;
+
+	create_container(scene, columns * 0.5f, rows * 2.0f + 20.0f);
+
+	// grid of static trigger boxes the circles rain on
+	for (uint32_t y = 0; y < 8; y++) {
+		for (uint32_t x = 0; x < columns / 2; x++) {
+			Entity entity = scene->create(std::format("Trigger{}_{}", x, y));
+
+			Transform& transform = entity.get_transform();
+			transform.local_position = {
+				x * 2.0f - columns * 0.5f + 1.0f, 2.0f + y * 1.5f, 0.0f
+			};
+
+			entity.add_component<Rigidbody2D>();
+
+			BoxCollider2D& collider = entity.add_component<BoxCollider2D>();
+			collider.is_trigger = true;
+			collider.trigger_function = on_trigger;
+		}
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+		create_circle(scene, std::format("Circle{}", i),
+				{ (i % columns) - columns * 0.5f + 0.5f,
+						16.0f + (i / columns) * 2.0f },
+				0.3f);
+	}
+
+	return scene;
+}
+
+Ref<Scene> build_mixed(uint32_t count) {
+	Ref<Scene> scene = create_ref<Scene>("mixed");
+
+	Entity camera = scene->create("Camera");
+	camera.add_component<CameraComponent>();
+	camera.add_component<PostProcessVolume>().vignette.enabled = true;
+
+	constexpr uint32_t group_size = 16;
+
+	Entity group;
+	for (uint32_t i = 0; i < count; i++) {
+		if (i % group_size == 0) {
+			group = scene->create(std::format("Group{}", i / group_size));
+			group.get_transform().local_position = {
+				(float)(i / group_size % 64), (float)(i / group_size / 64), 0.0f
+			};
+			continue;
+		}
+
+		Entity entity =
+				scene->create(std::format("Entity{}", i), group.get_uid());
+
+		Transform& transform = entity.get_transform();
+		transform.local_position = { (i % group_size) * 0.1f, 0.0f, 0.0f };
+		transform.local_rotation = { 0.0f, 0.0f, (float)(i % 360) };
+
+		SpriteRenderer& sprite = entity.add_component<SpriteRenderer>();
+		sprite.color = Color((i % 256) / 255.0f, 0.5f, 0.5f, 1.0f);
+		sprite.index = i % 8;
+
+		switch (i % 8) {
+			case 0:
+				entity.add_component<TextRenderer>().text =
+						std::format("Label {}", i);
+				break;
+			case 1:
+				entity.add_component<Rigidbody2D>();
+				entity.add_component<BoxCollider2D>();
+				break;
+			case 2:
+				entity.add_component<Rigidbody2D>();
+				entity.add_component<CircleCollider2D>();
+				break;
+			case 3:
+				entity.add_component<Rigidbody2D>();
+				entity.add_component<PolygonCollider2D>();
+				break;
+			case 4:
+				entity.add_component<Rigidbody2D>();
+				entity.add_component<CapsuleCollider2D>();
+				break;
+			case 5:
+				entity.add_component<Rigidbody2D>();
+				entity.add_component<ChainCollider2D>().points = {
+					{ -0.5f, -0.5f },
+					{ 0.5f, -0.5f },
+					{ 0.5f, 0.5f },
+					{ -0.5f, 0.5f },
+				};
+				break;
+			default:
+				break;
+		}
+	}
+
+	return scene;
+}
+
+Ref<Scene> build(const std::string& name) {
+	if (name == "pyramid") {
+		return build_pyramid();
+	}
+
+	if (name == "falling_circles") {
+		return build_falling_circles();
+	}
+
+	if (name == "tile_field") {
+		return build_tile_field();
+	}
+
+	if (name == "tile_field_baked") {
+		return build_tile_field(256, 32, true);
+	}
+
+	if (name == "triggers") {
+		return build_triggers();
+	}
+
+	if (name == "mixed") {
+		return build_mixed();
+	}
+
+	EVE_LOG_ERROR("Unknown builtin scene '{}'.", name);
+	return nullptr;
+}
+
+} //namespace scene_builders
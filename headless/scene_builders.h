@@ -0,0 +1,44 @@
+#ifndef SCENE_BUILDERS_H
+#define SCENE_BUILDERS_H
+
+#include "scene/scene.h"
+
+// Scenes built in code so that headless runs do not depend on project files.
+namespace scene_builders {
+
+// stacked dynamic boxes on a static ground
+Ref<Scene> build_pyramid(uint32_t base_size = 20);
+
+// circles dropped into a box
+Ref<Scene> build_falling_circles(uint32_t count = 2000);
+
+// one static body per tile with dynamic boxes dropped on them, with bake
+// set the tiles are merged into chain colliders like the editor does
+Ref<Scene> build_tile_field(
+		uint32_t width = 256, uint32_t height = 32, bool bake = false);
+
+// dynamic circles raining on a grid of trigger boxes
+Ref<Scene> build_triggers(uint32_t count = 1000);
+
+// number of trigger events reported since the start
+uint64_t get_trigger_event_count();
+
+// entities with every serializable component type in a shallow hierarchy,
+// used to measure scene loading rather than simulation
+Ref<Scene> build_mixed(uint32_t count = 20000);
+
+// physics scenes, run by bench_physics when no scene is given
+inline constexpr const char* BUILTIN_SCENES[] = {
+	"pyramid",
+	"falling_circles",
+	"tile_field",
+	"tile_field_baked",
+	"triggers",
+};
+
+// returns nullptr if there is no scene with the given name
+Ref<Scene> build(const std::string& name);
+
+} //namespace scene_builders
+
+#endif
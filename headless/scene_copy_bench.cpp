@@ -0,0 +1,86 @@
+#include "commands.h"
+
+#include "core/timer.h"
+#include "scene/entity.h"
+#include "scene_builders.h"
+
+// copies have to keep the entity handles and link the transforms to their
+// own parents
+inline static bool is_identical_copy(Ref<Scene> src, Ref<Scene> dst) {
+	bool identical = true;
+
+	src->view<IdComponent, Transform>().each(
+			[&](entt::entity entity_id, const IdComponent& id,
+					const Transform& transform) {
+				Entity copy = dst->find_by_id(id.id);
+				if (!copy || (entt::entity)copy != entity_id) {
+					identical = false;
+					return;
+				}
+
+				const Transform& copy_transform = copy.get_transform();
+				if (!transform.parent) {
+					identical &= copy_transform.parent == nullptr;
+					return;
+				}
+
+				Entity parent = copy.get_parent();
+				identical &= parent &&
+						copy_transform.parent == &parent.get_transform();
+			});
+
+	return identical &&
+			src->view<IdComponent>().size() == dst->view<IdComponent>().size();
+}
+
+int run_scene_copy_bench(const HeadlessArgs& args) {
+	const uint32_t iterations =
+			(uint32_t)std::max<int64_t>(args.get_int("iterations", 10), 1);
+
+	Ref<Scene> scene;
+	if (args.has("scene")) {
+		scene = load_headless_scene(args);
+	} else {
+		scene = scene_builders::build_mixed(
+				(uint32_t)std::max<int64_t>(args.get_int("entities", 50000), 1));
+	}
+
+	if (!scene) {
+		return 1;
+	}
+
+	EVE_LOG_INFO("Running scene copy bench on '{}'.", scene->get_name());
+
+	std::vector<float> copy_times;
+	copy_times.reserve(iterations);
+
+	bool identical = true;
+
+	for (uint32_t i = 0; i < iterations; i++) {
+		Timer timer;
+		Ref<Scene> copy = Scene::copy(scene);
+		copy_times.push_back(timer.get_elapsed_milliseconds());
+
+		if (i == 0) {
+			identical = is_identical_copy(scene, copy);
+		}
+	}
+
+	if (!identical) {
+		EVE_LOG_ERROR("Copied scene does not match the source scene.");
+	}
+
+	const Json result = {
+		{ "command", "bench_scene_copy" },
+		{ "config", BUILD_CONFIG },
+		{ "scene", scene->get_name() },
+		{ "entity_count", scene->view<IdComponent>().size() },
+		{ "iterations", iterations },
+		{ "copy_ms", get_timing_stats(copy_times) },
+		{ "identical", identical },
+	};
+
+	write_headless_result(args, result);
+
+	return identical ? 0 : 1;
+}
@@ -0,0 +1,121 @@
+#include "commands.h"
+
+#include "core/timer.h"
+#include "memory_tracker.h"
+#include "project/project.h"
+#include "scene/components.h"
+#include "scene_builders.h"
+
+// returns null if the scene could not be loaded
+inline static Json run_format_bench(const std::string& format,
+		const std::string& path, uint32_t iterations) {
+	std::vector<float> load_times;
+	load_times.reserve(iterations);
+
+	// part of the load that stays on the main thread with load_scene_async
+	std::vector<float> commit_times;
+	commit_times.reserve(iterations);
+
+	size_t peak_bytes = 0;
+	size_t retained_bytes = 0;
+	size_t entity_count = 0;
+
+	for (uint32_t i = 0; i < iterations; i++) {
+		Ref<Scene> scene = create_ref<Scene>();
+
+		const size_t baseline_bytes = memory_tracker::get_allocated_bytes();
+		memory_tracker::reset_peak();
+
+		Timer timer;
+
+		Ref<SceneLoadData> data = Scene::prepare_load(path);
+		if (!data) {
+			return nullptr;
+		}
+		Scene::wait_for_assets(*data);
+
+		Timer commit_timer;
+		if (!Scene::commit_load(scene, *data)) {
+			return nullptr;
+		}
+		commit_times.push_back(commit_timer.get_elapsed_milliseconds());
+
+		data.reset();
+
+		load_times.push_back(timer.get_elapsed_milliseconds());
+
+		peak_bytes = std::max(
+				peak_bytes, memory_tracker::get_peak_bytes() - baseline_bytes);
+		retained_bytes =
+				memory_tracker::get_allocated_bytes() - baseline_bytes;
+		entity_count = scene->view<IdComponent>().size();
+	}
+
+	return {
+		{ "format", format },
+		{ "path", path },
+		{ "file_bytes", fs::file_size(Project::get_asset_path(path)) },
+		{ "entity_count", entity_count },
+		{ "load_ms", get_timing_stats(load_times) },
+		{ "commit_ms", get_timing_stats(commit_times) },
+		{ "peak_heap_bytes", peak_bytes },
+		{ "retained_heap_bytes", retained_bytes },
+	};
+}
+
+int run_scene_load_bench(const HeadlessArgs& args) {
+	const uint32_t iterations =
+			(uint32_t)std::max<int64_t>(args.get_int("iterations", 5), 1);
+
+	Ref<Scene> scene;
+	if (args.has("scene")) {
+		scene = load_headless_scene(args);
+	} else {
+		scene = scene_builders::build_mixed(
+				(uint32_t)std::max<int64_t>(args.get_int("entities", 20000), 1));
+	}
+
+	if (!scene) {
+		return 1;
+	}
+
+	const std::string json_path = "res://scene_load_bench.escn";
+	const std::string binary_path = "res://scene_load_bench.escb";
+
+	Scene::serialize(scene, json_path);
+	Scene::serialize_binary(scene, binary_path);
+
+	// drop the source scene so it does not count towards the measurements
+	const std::string scene_name = scene->get_name();
+	scene.reset();
+
+	EVE_LOG_INFO("Running scene load bench on '{}'.", scene_name);
+
+	const Json json_result = run_format_bench("json", json_path, iterations);
+	const Json binary_result =
+			run_format_bench("binary", binary_path, iterations);
+
+	if (json_result.is_null() || binary_result.is_null()) {
+		EVE_LOG_ERROR("Unable to load the serialized bench scenes.");
+		return 1;
+	}
+
+	const float binary_mean_ms = binary_result["load_ms"]["mean"].get<float>();
+
+	const Json result = {
+		{ "command", "bench_scene_load" },
+		{ "config", BUILD_CONFIG },
+		{ "scene", scene_name },
+		{ "iterations", iterations },
+		{ "results", Json::array({ json_result, binary_result }) },
+		{ "speedup",
+				binary_mean_ms > 0.0f
+						? json_result["load_ms"]["mean"].get<float>() /
+								binary_mean_ms
+						: 0.0f },
+	};
+
+	write_headless_result(args, result);
+
+	return 0;
+}
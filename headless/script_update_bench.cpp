@@ -0,0 +1,94 @@
+#include "commands.h"
+
+#include "core/timer.h"
+#include "scene/components.h"
+#include "scene/entity.h"
+#include "scripting/script_engine.h"
+
+int run_script_update_bench(const HeadlessArgs& args) {
+	if (!ScriptEngine::is_initialized()) {
+		EVE_LOG_ERROR("Script update bench requires --project and --scripts.");
+		return 1;
+	}
+
+	const std::string class_name = args.get_string("class", "");
+	if (!ScriptEngine::does_entity_class_exists(class_name)) {
+		EVE_LOG_ERROR("Unable to find entity class '{}' given with --class.",
+				class_name);
+		return 1;
+	}
+
+	const uint32_t entity_count =
+			(uint32_t)std::max<int64_t>(args.get_int("entities", 10000), 1);
+	const uint32_t frames =
+			(uint32_t)std::max<int64_t>(args.get_int("frames", 300), 1);
+	const uint32_t warmup =
+			(uint32_t)std::max<int64_t>(args.get_int("warmup", 30), 0);
+
+	EVE_LOG_INFO("Running script update bench with {} '{}' entities.",
+			entity_count, class_name);
+
+	Ref<Scene> scene = create_ref<Scene>("script_update");
+	for (uint32_t i = 0; i < entity_count; i++) {
+		Entity entity = scene->create(std::format("Script{}", i));
+		entity.add_component<ScriptComponent>().class_name = class_name;
+	}
+
+	scene->start();
+
+	constexpr float dt = 1.0f / 60.0f;
+
+	// previous dispatch, one invoke per entity
+	const auto update_per_entity = [&]() {
+		for (auto entity_id : scene->view<ScriptComponent>()) {
+			ScriptEngine::invoke_on_update_entity(
+					{ entity_id, scene.get() }, dt);
+		}
+	};
+
+	const auto update_batched = [&]() { ScriptEngine::update_entities(dt); };
+
+	const auto measure = [&](const auto& update) {
+		for (uint32_t i = 0; i < warmup; i++) {
+			update();
+		}
+
+		std::vector<float> times;
+		times.reserve(frames);
+
+		for (uint32_t i = 0; i < frames; i++) {
+			Timer timer;
+			update();
+			times.push_back(timer.get_elapsed_milliseconds());
+		}
+
+		return times;
+	};
+
+	const std::vector<float> per_entity_times = measure(update_per_entity);
+	const std::vector<float> batched_times = measure(update_batched);
+
+	scene->stop();
+
+	const float per_entity_total = std::accumulate(
+			per_entity_times.begin(), per_entity_times.end(), 0.0f);
+	const float batched_total =
+			std::accumulate(batched_times.begin(), batched_times.end(), 0.0f);
+
+	const Json result = {
+		{ "command", "bench_script_update" },
+		{ "config", BUILD_CONFIG },
+		{ "class", class_name },
+		{ "entity_count", entity_count },
+		{ "frames", frames },
+		{ "per_entity_ms", get_timing_stats(per_entity_times) },
+		{ "batched_ms", get_timing_stats(batched_times) },
+		{ "speedup",
+				batched_total > 0.0f ? per_entity_total / batched_total
+									 : 0.0f },
+	};
+
+	write_headless_result(args, result);
+
+	return 0;
+}
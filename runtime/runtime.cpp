@@ -13,6 +13,10 @@
 #include "renderer/renderer.h"
 #endif
 
+#ifndef EVE_SCRIPT_EXECUTION_MODE
+#define EVE_SCRIPT_EXECUTION_MODE "JIT"
+#endif
+
 class RuntimeApplication : public Application {
 public:
 	inline RuntimeApplication(const ApplicationCreateInfo& info,
@@ -28,7 +32,18 @@ public:
 
 protected:
 	inline void _on_start() override {
-		ScriptEngine::init(true);
+		ScriptEngineSettings script_settings{};
+		script_settings.is_runtime = true;
+		script_settings.execution_mode =
+				deserialize_script_execution_mode(EVE_SCRIPT_EXECUTION_MODE);
+#ifndef EVE_DEBUG
+		// shipping builds should not wait for a debugger
+		script_settings.enable_debugging = false;
+#endif
+
+		ScriptEngine::init(script_settings);
+
+		SceneManager::set_use_cooked_scenes(true);
 
 		// load the first scene
 		EVE_ASSERT(
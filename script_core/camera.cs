@@ -12,12 +12,12 @@ namespace EveEngine
 		{
 			get
 			{
-				Interop.camera_component_camera_get_aspect_ratio(Entity.Id, out float aspectRatio);
+				Interop.camera_component_camera_get_aspect_ratio(ref Entity.handle, out float aspectRatio);
 				return aspectRatio;
 			}
 			set
 			{
-				Interop.camera_component_camera_set_aspect_ratio(Entity.Id, ref value);
+				Interop.camera_component_camera_set_aspect_ratio(ref Entity.handle, ref value);
 			}
 		}
 
@@ -44,12 +44,12 @@ namespace EveEngine
 		{
 			get
 			{
-				Interop.camera_component_camera_get_zoom_level(Entity.Id, out float zoomLevel);
+				Interop.camera_component_camera_get_zoom_level(ref Entity.handle, out float zoomLevel);
 				return zoomLevel;
 			}
 			set
 			{
-				Interop.camera_component_camera_set_zoom_level(Entity.Id, ref value);
+				Interop.camera_component_camera_set_zoom_level(ref Entity.handle, ref value);
 			}
 		}
 
@@ -60,12 +60,12 @@ namespace EveEngine
 		{
 			get
 			{
-				Interop.camera_component_camera_get_near_clip(Entity.Id, out float nearClip);
+				Interop.camera_component_camera_get_near_clip(ref Entity.handle, out float nearClip);
 				return nearClip;
 			}
 			set
 			{
-				Interop.camera_component_camera_set_near_clip(Entity.Id, ref value);
+				Interop.camera_component_camera_set_near_clip(ref Entity.handle, ref value);
 			}
 		}
 
@@ -76,12 +76,12 @@ namespace EveEngine
 		{
 			get
 			{
-				Interop.camera_component_camera_get_far_clip(Entity.Id, out float farClip);
+				Interop.camera_component_camera_get_far_clip(ref Entity.handle, out float farClip);
 				return farClip;
 			}
 			set
 			{
-				Interop.camera_component_camera_set_far_clip(Entity.Id, ref value);
+				Interop.camera_component_camera_set_far_clip(ref Entity.handle, ref value);
 			}
 		}
 	}
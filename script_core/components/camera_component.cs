@@ -24,10 +24,10 @@ namespace EveEngine
 		{
 			get
 			{
-				Interop.camera_component_get_is_primary(Entity.Id, out bool isPrimary);
+				Interop.camera_component_get_is_primary(ref Entity.handle, out bool isPrimary);
 				return isPrimary;
 			}
-			set => Interop.camera_component_set_is_primary(Entity.Id, ref value);
+			set => Interop.camera_component_set_is_primary(ref Entity.handle, ref value);
 		}
 
 		/// <summary>
@@ -37,10 +37,10 @@ namespace EveEngine
 		{
 			get
 			{
-				Interop.camera_component_get_is_fixed_aspect_ratio(Entity.Id, out bool isFixedAspectRatio);
+				Interop.camera_component_get_is_fixed_aspect_ratio(ref Entity.handle, out bool isFixedAspectRatio);
 				return isFixedAspectRatio;
 			}
-			set => Interop.camera_component_set_is_fixed_aspect_ratio(Entity.Id, ref value);
+			set => Interop.camera_component_set_is_fixed_aspect_ratio(ref Entity.handle, ref value);
 		}
 	}
 }
@@ -0,0 +1,121 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace EveEngine
+{
+	internal enum ComponentDataType : uint
+	{
+		Transform = 0,
+		SpriteRenderer,
+	}
+
+	/// <summary>
+	/// Local values of a transform laid out the same as in the engine.
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	public struct TransformData
+	{
+		public Vector3 LocalPosition;
+		public Vector3 LocalRotation;
+		public Vector3 LocalScale;
+	}
+
+	/// <summary>
+	/// Sprite renderer values laid out the same as in the engine.
+	/// </summary>
+	[StructLayout(LayoutKind.Explicit, Size = 48)]
+	public struct SpriteRendererData
+	{
+		[FieldOffset(0)] public ulong Texture;
+		[FieldOffset(8)] public Color Color;
+		[FieldOffset(24)] public Vector2 TexTiling;
+		[FieldOffset(32)] public bool IsAtlas;
+		[FieldOffset(36)] public Vector2 BlockSize;
+		[FieldOffset(44)] public uint Index;
+	}
+
+	/// <summary>
+	/// Points straight into the component storage of the engine, so reading
+	/// and writing the component does not go through an engine call per
+	/// field. The pointer is fetched again only after components of its type
+	/// were added or removed anywhere, since their storage may have moved.
+	/// </summary>
+	/// <example>
+	///  ComponentRef&lt;TransformData&gt; transform = Transform.Data;
+	///  ...
+	///  ref TransformData data = ref transform.Value;
+	///  data.LocalPosition += velocity * dt;
+	///  data.LocalRotation.z += angularVelocity * dt;
+	/// </example>
+	public unsafe struct ComponentRef<T> where T : unmanaged
+	{
+		// each data type maps to a single storage
+		private static uint* s_generation;
+
+		private EntityHandle entity;
+		private readonly ComponentDataType type;
+
+		private T* data;
+		private uint generation;
+
+		internal ComponentRef(EntityHandle entity, ComponentDataType type)
+		{
+			this.entity = entity;
+			this.type = type;
+
+			if (s_generation == null)
+			{
+				s_generation = Interop.component_data_get_generation(type);
+			}
+
+			data = null;
+			generation = 0;
+
+			Refresh();
+		}
+
+		/// <summary>
+		/// Whether the entity still has the component.
+		/// </summary>
+		public bool IsValid
+		{
+			get
+			{
+				if (generation != *s_generation)
+				{
+					Refresh();
+				}
+
+				return data != null;
+			}
+		}
+
+		/// <summary>
+		/// Reference to the component data, it must not be kept after
+		/// entities or components are created or destroyed.
+		/// </summary>
+		public ref T Value
+		{
+			get
+			{
+				if (generation != *s_generation)
+				{
+					Refresh();
+				}
+
+				if (data == null)
+				{
+					throw new InvalidOperationException($"Entity {entity.Id} does not have the component.");
+				}
+
+				return ref *data;
+			}
+		}
+
+		private void Refresh()
+		{
+			generation = *s_generation;
+			data = (T*)Interop.component_data_get(ref entity, type);
+		}
+	}
+}
@@ -11,7 +11,7 @@ namespace EveEngine
 		/// </summary>
 		public string ClassName
 		{
-			get => Interop.script_component_get_class_name(Entity.Id);
+			get => Interop.script_component_get_class_name(ref Entity.handle);
 		}
 	}
 }
@@ -2,52 +2,57 @@ namespace EveEngine
 {
 	public class SpriteRenderer : Component
 	{
+		/// <summary>
+		/// Direct access to the sprite values without an engine call per field.
+		/// </summary>
+		public ComponentRef<SpriteRendererData> Data => new(Entity.handle, ComponentDataType.SpriteRenderer);
+
 		public ulong Texture
 		{
-			get => Interop.sprite_renderer_component_get_texture(Entity.Id);
-			set => Interop.sprite_renderer_component_set_texture(Entity.Id, value);
+			get => Interop.sprite_renderer_component_get_texture(ref Entity.handle);
+			set => Interop.sprite_renderer_component_set_texture(ref Entity.handle, value);
 		}
 
 		public Color Color
 		{
 			get
 			{
-				Interop.sprite_renderer_component_get_color(Entity.Id, out Color color);
+				Interop.sprite_renderer_component_get_color(ref Entity.handle, out Color color);
 				return color;
 			}
-			set => Interop.sprite_renderer_component_set_color(Entity.Id, ref value);
+			set => Interop.sprite_renderer_component_set_color(ref Entity.handle, ref value);
 		}
 
 		public Vector2 TexTiling
 		{
 			get
 			{
-				Interop.sprite_renderer_component_get_tex_tiling(Entity.Id, out Vector2 texTiling);
+				Interop.sprite_renderer_component_get_tex_tiling(ref Entity.handle, out Vector2 texTiling);
 				return texTiling;
 			}
-			set => Interop.sprite_renderer_component_set_tex_tiling(Entity.Id, ref value);
+			set => Interop.sprite_renderer_component_set_tex_tiling(ref Entity.handle, ref value);
 		}
 
 		public bool IsAtlas
 		{
-			get => Interop.sprite_renderer_component_get_is_atlas(Entity.Id);
-			set => Interop.sprite_renderer_component_set_is_atlas(Entity.Id, value);
+			get => Interop.sprite_renderer_component_get_is_atlas(ref Entity.handle);
+			set => Interop.sprite_renderer_component_set_is_atlas(ref Entity.handle, value);
 		}
 
 		public Vector2 BlockSize
 		{
 			get
 			{
-				Interop.sprite_renderer_component_get_block_size(Entity.Id, out Vector2 blockSize);
+				Interop.sprite_renderer_component_get_block_size(ref Entity.handle, out Vector2 blockSize);
 				return blockSize;
 			}
-			set => Interop.sprite_renderer_component_set_block_size(Entity.Id, ref value);
+			set => Interop.sprite_renderer_component_set_block_size(ref Entity.handle, ref value);
 		}
 
 		public uint Index
 		{
-			get => Interop.sprite_renderer_component_get_index(Entity.Id);
-			set => Interop.sprite_renderer_component_set_index(Entity.Id, value);
+			get => Interop.sprite_renderer_component_get_index(ref Entity.handle);
+			set => Interop.sprite_renderer_component_set_index(ref Entity.handle, value);
 		}
 	}
 }
@@ -21,6 +21,12 @@ namespace EveEngine
 			}
 		}
 
+		/// <summary>
+		/// Direct access to the local values, prefer it over the properties
+		/// below when several of them are used every frame.
+		/// </summary>
+		public ComponentRef<TransformData> Data => new(Entity.handle, ComponentDataType.Transform);
+
 		/// <summary>
 		/// Gets or sets the position of the transform.
 		/// </summary>
@@ -28,10 +34,10 @@ namespace EveEngine
 		{
 			get
 			{
-				Interop.transform_component_get_local_position(Entity.Id, out Vector3 position);
+				Interop.transform_component_get_local_position(ref Entity.handle, out Vector3 position);
 				return position;
 			}
-			set => Interop.transform_component_set_local_position(Entity.Id, ref value);
+			set => Interop.transform_component_set_local_position(ref Entity.handle, ref value);
 		}
 
 		/// <summary>
@@ -41,10 +47,10 @@ namespace EveEngine
 		{
 			get
 			{
-				Interop.transform_component_get_local_rotation(Entity.Id, out Vector3 rotation);
+				Interop.transform_component_get_local_rotation(ref Entity.handle, out Vector3 rotation);
 				return rotation;
 			}
-			set => Interop.transform_component_set_local_rotation(Entity.Id, ref value);
+			set => Interop.transform_component_set_local_rotation(ref Entity.handle, ref value);
 		}
 
 		/// <summary>
@@ -54,10 +60,10 @@ namespace EveEngine
 		{
 			get
 			{
-				Interop.transform_component_get_local_scale(Entity.Id, out Vector3 scale);
+				Interop.transform_component_get_local_scale(ref Entity.handle, out Vector3 scale);
 				return scale;
 			}
-			set => Interop.transform_component_set_local_scale(Entity.Id, ref value);
+			set => Interop.transform_component_set_local_scale(ref Entity.handle, ref value);
 		}
 
 		/// <summary>
@@ -67,7 +73,7 @@ namespace EveEngine
 		{
 			get
 			{
-				Interop.transform_component_get_position(Entity.Id, out Vector3 position);
+				Interop.transform_component_get_position(ref Entity.handle, out Vector3 position);
 				return position;
 			}
 		}
@@ -79,7 +85,7 @@ namespace EveEngine
 		{
 			get
 			{
-				Interop.transform_component_get_rotation(Entity.Id, out Vector3 rotation);
+				Interop.transform_component_get_rotation(ref Entity.handle, out Vector3 rotation);
 				return rotation;
 			}
 		}
@@ -91,7 +97,7 @@ namespace EveEngine
 		{
 			get
 			{
-				Interop.transform_component_get_scale(Entity.Id, out Vector3 scale);
+				Interop.transform_component_get_scale(ref Entity.handle, out Vector3 scale);
 				return scale;
 			}
 		}
@@ -105,7 +111,7 @@ namespace EveEngine
 		{
 			get
 			{
-				Interop.transform_component_get_forward(Entity.Id, out Vector3 forward);
+				Interop.transform_component_get_forward(ref Entity.handle, out Vector3 forward);
 				return forward;
 			}
 		}
@@ -118,7 +124,7 @@ namespace EveEngine
 		{
 			get
 			{
-				Interop.transform_component_get_right(Entity.Id, out Vector3 right);
+				Interop.transform_component_get_right(ref Entity.handle, out Vector3 right);
 				return right;
 			}
 		}
@@ -131,7 +137,7 @@ namespace EveEngine
 		{
 			get
 			{
-				Interop.transform_component_get_up(Entity.Id, out Vector3 up);
+				Interop.transform_component_get_up(ref Entity.handle, out Vector3 up);
 				return up;
 			}
 		}
@@ -142,7 +148,7 @@ namespace EveEngine
 		/// <param name="translation">Value to translate for.</param>
 		public void Translate(Vector3 translation)
 		{
-			Interop.transform_component_translate(Entity.Id, ref translation);
+			Interop.transform_component_translate(ref Entity.handle, ref translation);
 		}
 
 		/// <summary>
@@ -152,7 +158,7 @@ namespace EveEngine
 		/// <param name="axis">Axis to rotate on.</param>
 		public void Rotate(float angle, Vector3 axis)
 		{
-			Interop.transform_component_rotate(Entity.Id, angle, ref axis);
+			Interop.transform_component_rotate(ref Entity.handle, angle, ref axis);
 		}
 	}
 }
@@ -2,19 +2,26 @@ namespace EveEngine
 {
 	public class Entity
 	{
-		public ulong Id { get; private set; }
+		// passed by reference to the engine calls which cache the handle
+		internal EntityHandle handle;
+
+		public ulong Id
+		{
+			get => handle.Id;
+			private set => handle = new EntityHandle(value);
+		}
 
 		public Entity Parent
 		{
 			get
 			{
-				return new Entity(Interop.entity_get_parent(Id));
+				return new Entity(Interop.entity_get_parent(ref handle));
 			}
 		}
 
 		public string Name
 		{
-			get => Interop.entity_get_name(Id);
+			get => Interop.entity_get_name(ref handle);
 		}
 
 		public Transform Transform { get; private set; }
@@ -35,6 +42,14 @@ namespace EveEngine
 
 		protected virtual void OnDestroy() { }
 
+		internal void InvokeOnUpdate(float dt)
+		{
+			OnUpdate(dt);
+		}
+
+		/// <summary>
+		/// Destroys the entity and its children at the end of the frame.
+		/// </summary>
 		public void Destroy()
 		{
 			Interop.entity_destroy(Id);
@@ -42,9 +57,19 @@ namespace EveEngine
 			Id = 0;
 		}
 
+		/// <summary>
+		/// Returns an entity created with Prefab.Spawn to the pool of its
+		/// prefab at the end of the frame, OnDestroy is called and the
+		/// entity keeps its id to be reused. Other entities are destroyed.
+		/// </summary>
+		public void Release()
+		{
+			Interop.entity_release(Id);
+		}
+
 		public bool HasComponent<T>() where T : Component, new()
 		{
-			return Interop.entity_has_component(Id, typeof(T));
+			return Interop.entity_has_component(ref handle, typeof(T));
 		}
 
 		public T GetComponent<T>() where T : Component, new()
@@ -66,7 +91,7 @@ namespace EveEngine
 				throw new DuplicateComponentException(string.Format("Entity already has component of: {0}", componentType.FullName));
 			}
 
-			Interop.entity_add_component(Id, componentType);
+			Interop.entity_add_component(ref handle, componentType);
 			return GetComponent<T>();
 		}
 
@@ -0,0 +1,24 @@
+using System.Runtime.InteropServices;
+
+namespace EveEngine
+{
+	/// <summary>
+	/// Id of the entity together with its native handle, the handle is
+	/// filled by the engine on the first call and checked on the next ones
+	/// so that they skip the id lookup.
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	internal struct EntityHandle
+	{
+		private const uint InvalidHandle = uint.MaxValue;
+
+		public ulong Id;
+		public uint Handle;
+
+		public EntityHandle(ulong id)
+		{
+			Id = id;
+			Handle = InvalidHandle;
+		}
+	}
+}
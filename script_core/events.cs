@@ -0,0 +1,254 @@
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+
+namespace EveEngine
+{
+	public enum EventType : uint
+	{
+		CollisionBegin = 0,
+		CollisionEnd,
+		TriggerBegin,
+		TriggerEnd,
+		KeyPressed,
+		KeyReleased,
+		MousePressed,
+		MouseReleased,
+		Custom,
+
+		/// <summary>
+		/// Entity was destroyed or released to its pool, its handlers are
+		/// removed after this event.
+		/// </summary>
+		EntityDestroyed,
+	}
+
+	/// <summary>
+	/// Event queued by the engine or sent by a script.
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	public struct Event
+	{
+		public EventType Type;
+
+		/// <summary>
+		/// Key or mouse code of input events, id of custom events.
+		/// </summary>
+		public int Code;
+
+		/// <summary>
+		/// Id of the entity the event is sent to, zero for input events.
+		/// </summary>
+		public ulong EntityId;
+
+		/// <summary>
+		/// Id of the other entity of contact events, payload of custom
+		/// events.
+		/// </summary>
+		public ulong Data;
+
+		public KeyCode Key => (KeyCode)Code;
+
+		public MouseCode Button => (MouseCode)Code;
+
+		public ulong OtherId => Data;
+	}
+
+	public delegate void EventCallback(in Event e);
+
+	/// <summary>
+	/// Delivers collisions, triggers, input edges and custom events to the
+	/// scripts. The engine queues its events while the frame runs and they
+	/// are handled at once before the next script update, handlers are
+	/// called on the main thread in the order the events happened.
+	/// </summary>
+	/// <example>
+	///  protected override void OnCreate()
+	///  {
+	///  	Events.Subscribe(EventType.TriggerBegin, this, OnTriggerBegin);
+	///  }
+	///
+	///  private void OnTriggerBegin(in Event e)
+	///  {
+	///  	Debug.LogInfo("{0} entered the trigger", e.OtherId);
+	///  }
+	/// </example>
+	public static class Events
+	{
+		private static readonly int s_typeCount = Enum.GetValues(typeof(EventType)).Length;
+
+		private static readonly EventCallback[] s_handlers = new EventCallback[s_typeCount];
+		private static readonly Dictionary<ulong, EventCallback>[] s_entityHandlers = CreateEntityHandlers();
+
+		// custom events sent by the scripts never leave managed code
+		private static readonly List<Event> s_sent = new List<Event>();
+		private static readonly List<Event> s_sending = new List<Event>();
+
+		private static Event[] s_buffer = new Event[256];
+
+		private static Dictionary<ulong, EventCallback>[] CreateEntityHandlers()
+		{
+			var handlers = new Dictionary<ulong, EventCallback>[s_typeCount];
+			for (int i = 0; i < handlers.Length; i++)
+			{
+				handlers[i] = new Dictionary<ulong, EventCallback>();
+			}
+
+			return handlers;
+		}
+
+		/// <summary>
+		/// Calls the handler for every event of the type.
+		/// </summary>
+		public static void Subscribe(EventType type, EventCallback handler)
+		{
+			s_handlers[(int)type] += handler;
+		}
+
+		/// <summary>
+		/// Calls the handler for the events of the type sent to the entity.
+		/// </summary>
+		public static void Subscribe(EventType type, Entity entity, EventCallback handler)
+		{
+			Dictionary<ulong, EventCallback> handlers = s_entityHandlers[(int)type];
+
+			handlers.TryGetValue(entity.Id, out EventCallback current);
+			handlers[entity.Id] = current + handler;
+		}
+
+		public static void Unsubscribe(EventType type, EventCallback handler)
+		{
+			s_handlers[(int)type] -= handler;
+		}
+
+		public static void Unsubscribe(EventType type, Entity entity, EventCallback handler)
+		{
+			Dictionary<ulong, EventCallback> handlers = s_entityHandlers[(int)type];
+			if (!handlers.TryGetValue(entity.Id, out EventCallback current))
+			{
+				return;
+			}
+
+			current -= handler;
+			if (current == null)
+			{
+				handlers.Remove(entity.Id);
+			}
+			else
+			{
+				handlers[entity.Id] = current;
+			}
+		}
+
+		/// <summary>
+		/// Removes every handler subscribed for the entity, this happens on
+		/// its own once the entity is destroyed.
+		/// </summary>
+		public static void UnsubscribeAll(Entity entity)
+		{
+			RemoveEntityHandlers(entity.Id);
+		}
+
+		/// <summary>
+		/// Queues a custom event, it is handled with the events of the next
+		/// frame.
+		/// </summary>
+		/// <param name="code">Id of the event</param>
+		/// <param name="entity">Entity to send the event to, InvalidEntity to only reach the handlers of every entity</param>
+		/// <param name="data">Payload of the event</param>
+		public static void Send(int code, Entity entity, ulong data = 0)
+		{
+			lock (s_sent)
+			{
+				s_sent.Add(new Event
+				{
+					Type = EventType.Custom,
+					Code = code,
+					EntityId = entity.Id,
+					Data = data,
+				});
+			}
+		}
+
+		internal static void Dispatch()
+		{
+			// events sent by the handlers are handled next frame
+			lock (s_sent)
+			{
+				s_sending.AddRange(s_sent);
+				s_sent.Clear();
+			}
+
+			while (true)
+			{
+				int count = Interop.events_drain(s_buffer);
+				for (int i = 0; i < count; i++)
+				{
+					Invoke(in s_buffer[i]);
+				}
+
+				if (count < s_buffer.Length)
+				{
+					break;
+				}
+
+				// the buffer was too small for a frame, the next ones will not be
+				Array.Resize(ref s_buffer, s_buffer.Length * 2);
+			}
+
+			foreach (Event e in s_sending)
+			{
+				Invoke(in e);
+			}
+
+			s_sending.Clear();
+		}
+
+		internal static void Reset()
+		{
+			Array.Clear(s_handlers, 0, s_handlers.Length);
+			foreach (Dictionary<ulong, EventCallback> handlers in s_entityHandlers)
+			{
+				handlers.Clear();
+			}
+
+			lock (s_sent)
+			{
+				s_sent.Clear();
+			}
+
+			s_sending.Clear();
+		}
+
+		private static void Invoke(in Event e)
+		{
+			// one failing handler should not stop the rest of the events
+			try
+			{
+				if (e.EntityId != 0 && s_entityHandlers[(int)e.Type].TryGetValue(e.EntityId, out EventCallback entityHandler))
+				{
+					entityHandler(in e);
+				}
+
+				s_handlers[(int)e.Type]?.Invoke(in e);
+			}
+			catch (Exception exception)
+			{
+				Interop.debug_log_exception(exception.Message);
+			}
+
+			if (e.Type == EventType.EntityDestroyed)
+			{
+				RemoveEntityHandlers(e.EntityId);
+			}
+		}
+
+		private static void RemoveEntityHandlers(ulong entityId)
+		{
+			foreach (Dictionary<ulong, EventCallback> handlers in s_entityHandlers)
+			{
+				handlers.Remove(entityId);
+			}
+		}
+	}
+}
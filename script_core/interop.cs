@@ -45,6 +45,9 @@ namespace EveEngine
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
 		internal extern static void debug_log_fatal(string message);
 
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static void debug_log_exception(string message);
+
 		#endregion
 		#region Entity
 
@@ -55,16 +58,19 @@ namespace EveEngine
 		internal extern static string entity_destroy(ulong entityId);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static ulong entity_get_parent(ulong entityId);
+		internal extern static void entity_release(ulong entityId);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static ulong entity_get_parent(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static string entity_get_name(ulong entityId);
+		internal extern static string entity_get_name(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static bool entity_has_component(ulong entityId, Type component_type);
+		internal extern static bool entity_has_component(ref EntityHandle entity, Type component_type);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void entity_add_component(ulong entityId, Type component_type);
+		internal extern static void entity_add_component(ref EntityHandle entity, Type component_type);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
 		internal extern static ulong entity_find_by_name(string name);
@@ -79,345 +85,531 @@ namespace EveEngine
 		#region TransformComponent
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void transform_component_get_local_position(ulong entityId, out Vector3 position);
+		internal extern static void transform_component_get_local_position(ref EntityHandle entity, out Vector3 position);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void transform_component_set_local_position(ulong entityId, ref Vector3 position);
+		internal extern static void transform_component_set_local_position(ref EntityHandle entity, ref Vector3 position);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void transform_component_get_local_rotation(ulong entityId, out Vector3 rotation);
+		internal extern static void transform_component_get_local_rotation(ref EntityHandle entity, out Vector3 rotation);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void transform_component_set_local_rotation(ulong entityId, ref Vector3 rotation);
+		internal extern static void transform_component_set_local_rotation(ref EntityHandle entity, ref Vector3 rotation);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void transform_component_get_local_scale(ulong entityId, out Vector3 scale);
+		internal extern static void transform_component_get_local_scale(ref EntityHandle entity, out Vector3 scale);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void transform_component_set_local_scale(ulong entityId, ref Vector3 scale);
+		internal extern static void transform_component_set_local_scale(ref EntityHandle entity, ref Vector3 scale);
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void transform_component_get_position(ulong entityId, out Vector3 position);
+		internal extern static void transform_component_get_position(ref EntityHandle entity, out Vector3 position);
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void transform_component_get_rotation(ulong entityId, out Vector3 rotation);
+		internal extern static void transform_component_get_rotation(ref EntityHandle entity, out Vector3 rotation);
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void transform_component_get_scale(ulong entityId, out Vector3 scale);
+		internal extern static void transform_component_get_scale(ref EntityHandle entity, out Vector3 scale);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void transform_component_get_forward(ulong entityId, out Vector3 forward);
+		internal extern static void transform_component_get_forward(ref EntityHandle entity, out Vector3 forward);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void transform_component_get_right(ulong entityId, out Vector3 right);
+		internal extern static void transform_component_get_right(ref EntityHandle entity, out Vector3 right);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void transform_component_get_up(ulong entityId, out Vector3 up);
+		internal extern static void transform_component_get_up(ref EntityHandle entity, out Vector3 up);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void transform_component_translate(ulong entityId, ref Vector3 translation);
+		internal extern static void transform_component_translate(ref EntityHandle entity, ref Vector3 translation);
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void transform_component_rotate(ulong entityId, float angle, ref Vector3 axis);
+		internal extern static void transform_component_rotate(ref EntityHandle entity, float angle, ref Vector3 axis);
 
 		#endregion
 		#region CameraComponent
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void camera_component_camera_get_aspect_ratio(ulong entityId, out float aspectRatio);
+		internal extern static void camera_component_camera_get_aspect_ratio(ref EntityHandle entity, out float aspectRatio);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void camera_component_camera_set_aspect_ratio(ulong entityId, ref float aspectRatio);
+		internal extern static void camera_component_camera_set_aspect_ratio(ref EntityHandle entity, ref float aspectRatio);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void camera_component_camera_get_zoom_level(ulong entityId, out float zoomLevel);
+		internal extern static void camera_component_camera_get_zoom_level(ref EntityHandle entity, out float zoomLevel);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void camera_component_camera_set_zoom_level(ulong entityId, ref float zoomLevel);
+		internal extern static void camera_component_camera_set_zoom_level(ref EntityHandle entity, ref float zoomLevel);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void camera_component_camera_get_near_clip(ulong entityId, out float nearClip);
+		internal extern static void camera_component_camera_get_near_clip(ref EntityHandle entity, out float nearClip);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void camera_component_camera_set_near_clip(ulong entityId, ref float nearClip);
+		internal extern static void camera_component_camera_set_near_clip(ref EntityHandle entity, ref float nearClip);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void camera_component_camera_get_far_clip(ulong entityId, out float farClip);
+		internal extern static void camera_component_camera_get_far_clip(ref EntityHandle entity, out float farClip);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void camera_component_camera_set_far_clip(ulong entityId, ref float farClip);
+		internal extern static void camera_component_camera_set_far_clip(ref EntityHandle entity, ref float farClip);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void camera_component_get_is_primary(ulong entityId, out bool isPrimary);
+		internal extern static void camera_component_get_is_primary(ref EntityHandle entity, out bool isPrimary);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void camera_component_set_is_primary(ulong entityId, ref bool isPrimary);
+		internal extern static void camera_component_set_is_primary(ref EntityHandle entity, ref bool isPrimary);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void camera_component_get_is_fixed_aspect_ratio(ulong entityId, out bool isFixedAspectRatio);
+		internal extern static void camera_component_get_is_fixed_aspect_ratio(ref EntityHandle entity, out bool isFixedAspectRatio);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void camera_component_set_is_fixed_aspect_ratio(ulong entityId, ref bool isFixedAspectRatio);
+		internal extern static void camera_component_set_is_fixed_aspect_ratio(ref EntityHandle entity, ref bool isFixedAspectRatio);
 
 		#endregion
 		#region ScriptComponent
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static string script_component_get_class_name(ulong entityId);
+		internal extern static string script_component_get_class_name(ref EntityHandle entity);
 
 		#endregion
 		#region SpriteRendererComponent
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static ulong sprite_renderer_component_get_texture(ulong entityId);
+		internal extern static ulong sprite_renderer_component_get_texture(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void sprite_renderer_component_set_texture(ulong entityId, ulong handle);
+		internal extern static void sprite_renderer_component_set_texture(ref EntityHandle entity, ulong handle);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void sprite_renderer_component_get_color(ulong entityId, out Color color);
+		internal extern static void sprite_renderer_component_get_color(ref EntityHandle entity, out Color color);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void sprite_renderer_component_set_color(ulong entityId, ref Color color);
+		internal extern static void sprite_renderer_component_set_color(ref EntityHandle entity, ref Color color);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void sprite_renderer_component_get_tex_tiling(ulong entityId, out Vector2 texTiling);
+		internal extern static void sprite_renderer_component_get_tex_tiling(ref EntityHandle entity, out Vector2 texTiling);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void sprite_renderer_component_set_tex_tiling(ulong entityId, ref Vector2 texTiling);
+		internal extern static void sprite_renderer_component_set_tex_tiling(ref EntityHandle entity, ref Vector2 texTiling);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static bool sprite_renderer_component_get_is_atlas(ulong entityId);
+		internal extern static bool sprite_renderer_component_get_is_atlas(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void sprite_renderer_component_set_is_atlas(ulong entityId, bool isAtlas);
+		internal extern static void sprite_renderer_component_set_is_atlas(ref EntityHandle entity, bool isAtlas);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void sprite_renderer_component_get_block_size(ulong entityId, out Vector2 blockSize);
+		internal extern static void sprite_renderer_component_get_block_size(ref EntityHandle entity, out Vector2 blockSize);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void sprite_renderer_component_set_block_size(ulong entityId, ref Vector2 blockSize);
+		internal extern static void sprite_renderer_component_set_block_size(ref EntityHandle entity, ref Vector2 blockSize);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static uint sprite_renderer_component_get_index(ulong entityId);
+		internal extern static uint sprite_renderer_component_get_index(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void sprite_renderer_component_set_index(ulong entityId, uint index);
+		internal extern static void sprite_renderer_component_set_index(ref EntityHandle entity, uint index);
 
 		#endregion
 		#region TextRendererComponent
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static string text_renderer_component_get_text(ulong entityId);
+		internal extern static string text_renderer_component_get_text(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void text_renderer_component_set_text(ulong entityId, string text);
+		internal extern static void text_renderer_component_set_text(ref EntityHandle entity, string text);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static ulong text_renderer_component_get_font(ulong entityId);
+		internal extern static ulong text_renderer_component_get_font(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void text_renderer_component_set_font(ulong entityId, ulong fontHandle);
+		internal extern static void text_renderer_component_set_font(ref EntityHandle entity, ulong fontHandle);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void text_renderer_component_get_fg_color(ulong entityId, out Color color);
+		internal extern static void text_renderer_component_get_fg_color(ref EntityHandle entity, out Color color);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void text_renderer_component_set_fg_color(ulong entityId, ref Color color);
+		internal extern static void text_renderer_component_set_fg_color(ref EntityHandle entity, ref Color color);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void text_renderer_component_get_bg_color(ulong entityId, out Color color);
+		internal extern static void text_renderer_component_get_bg_color(ref EntityHandle entity, out Color color);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void text_renderer_component_set_bg_color(ulong entityId, ref Color color);
+		internal extern static void text_renderer_component_set_bg_color(ref EntityHandle entity, ref Color color);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static float text_renderer_component_get_kerning(ulong entityId);
+		internal extern static float text_renderer_component_get_kerning(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void text_renderer_component_set_kerning(ulong entityId, float kerning);
+		internal extern static void text_renderer_component_set_kerning(ref EntityHandle entity, float kerning);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static float text_renderer_component_get_line_spacing(ulong entityId);
+		internal extern static float text_renderer_component_get_line_spacing(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void text_renderer_component_set_line_spacing(ulong entityId, float lineSpacing);
+		internal extern static void text_renderer_component_set_line_spacing(ref EntityHandle entity, float lineSpacing);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static bool text_renderer_component_get_is_screen_space(ulong entityId);
+		internal extern static bool text_renderer_component_get_is_screen_space(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void text_renderer_component_set_is_screen_space(ulong entityId, bool isScreenSpace);
+		internal extern static void text_renderer_component_set_is_screen_space(ref EntityHandle entity, bool isScreenSpace);
 
 		#endregion
 		#region Rigidbody2DComponent
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern Rigidbody2D.BodyType rigidbody2d_component_get_type(ulong entityId);
+		internal static extern Rigidbody2D.BodyType rigidbody2d_component_get_type(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void rigidbody2d_component_set_type(ulong entityId, Rigidbody2D.BodyType type);
+		internal static extern void rigidbody2d_component_set_type(ref EntityHandle entity, Rigidbody2D.BodyType type);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern bool rigidbody2d_component_get_fixed_rotation(ulong entityId);
+		internal static extern bool rigidbody2d_component_get_fixed_rotation(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void rigidbody2d_component_get_velocity(ulong entityId, out Vector2 velocity);
+		internal static extern void rigidbody2d_component_get_velocity(ref EntityHandle entity, out Vector2 velocity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern float rigidbody2d_component_get_angular_velocity(ulong entityId);
+		internal static extern float rigidbody2d_component_get_angular_velocity(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void rigidbody2d_component_set_fixed_rotation(ulong entityId, bool fixedRotation);
+		internal static extern void rigidbody2d_component_set_fixed_rotation(ref EntityHandle entity, bool fixedRotation);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void rigidbody2d_component_add_force(ulong entityId,
+		internal static extern void rigidbody2d_component_add_force(ref EntityHandle entity,
 			Rigidbody2D.ForceMode mode,
 			ref Vector2 force,
 			ref Vector2 offset);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void rigidbody2d_component_add_angular_impulse(ulong entityId, float angularImpulse);
+		internal static extern void rigidbody2d_component_add_angular_impulse(ref EntityHandle entity, float angularImpulse);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void rigidbody2d_component_add_torque(ulong entityId, float torque);
+		internal static extern void rigidbody2d_component_add_torque(ref EntityHandle entity, float torque);
 
 		#endregion
 		#region BoxCollider2DComponent
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void box_collider2d_component_get_offset(ulong entityId, out Vector2 offset);
+		internal static extern void box_collider2d_component_get_offset(ref EntityHandle entity, out Vector2 offset);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void box_collider2d_component_set_offset(ulong entityId, ref Vector2 offset);
+		internal static extern void box_collider2d_component_set_offset(ref EntityHandle entity, ref Vector2 offset);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void box_collider2d_component_get_size(ulong entityId, out Vector2 size);
+		internal static extern void box_collider2d_component_get_size(ref EntityHandle entity, out Vector2 size);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void box_collider2d_component_set_size(ulong entityId, ref Vector2 size);
+		internal static extern void box_collider2d_component_set_size(ref EntityHandle entity, ref Vector2 size);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern bool box_collider2d_component_get_is_trigger(ulong entityId);
+		internal static extern bool box_collider2d_component_get_is_trigger(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void box_collider2d_component_set_is_trigger(ulong entityId, bool isTrigger);
+		internal static extern void box_collider2d_component_set_is_trigger(ref EntityHandle entity, bool isTrigger);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void box_collider2d_component_set_on_trigger(ulong entityId, IntPtr onTriggerFunction);
+		internal static extern void box_collider2d_component_set_on_trigger(ref EntityHandle entity, IntPtr onTriggerFunction);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern float box_collider2d_component_get_density(ulong entityId);
+		internal static extern float box_collider2d_component_get_density(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void box_collider2d_component_set_density(ulong entityId, float density);
+		internal static extern void box_collider2d_component_set_density(ref EntityHandle entity, float density);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern float box_collider2d_component_get_friction(ulong entityId);
+		internal static extern float box_collider2d_component_get_friction(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void box_collider2d_component_set_friction(ulong entityId, float friction);
+		internal static extern void box_collider2d_component_set_friction(ref EntityHandle entity, float friction);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern float box_collider2d_component_get_restitution(ulong entityId);
+		internal static extern float box_collider2d_component_get_restitution(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void box_collider2d_component_set_restitution(ulong entityId, float restitution);
+		internal static extern void box_collider2d_component_set_restitution(ref EntityHandle entity, float restitution);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern float box_collider2d_component_get_restitution_threshold(ulong entityId);
+		internal static extern float box_collider2d_component_get_restitution_threshold(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void box_collider2d_component_set_restitution_threshold(ulong entityId, float restitutionThreshold);
+		internal static extern void box_collider2d_component_set_restitution_threshold(ref EntityHandle entity, float restitutionThreshold);
 
 		#endregion
 		#region CircleCollider2DComponent
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void circle_collider2d_component_get_offset(ulong entityId, out Vector2 offset);
+		internal static extern void circle_collider2d_component_get_offset(ref EntityHandle entity, out Vector2 offset);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void circle_collider2d_component_set_offset(ref EntityHandle entity, ref Vector2 offset);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern float circle_collider2d_component_get_radius(ref EntityHandle entity);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void circle_collider2d_component_set_radius(ref EntityHandle entity, float radius);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern bool circle_collider2d_component_get_is_trigger(ref EntityHandle entity);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void circle_collider2d_component_set_is_trigger(ref EntityHandle entity, bool isTrigger);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void circle_collider2d_component_set_on_trigger(ref EntityHandle entity, IntPtr onTriggerFunction);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern float circle_collider2d_component_get_density(ref EntityHandle entity);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void circle_collider2d_component_set_density(ref EntityHandle entity, float density);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern float circle_collider2d_component_get_friction(ref EntityHandle entity);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void circle_collider2d_component_set_friction(ref EntityHandle entity, float friction);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern float circle_collider2d_component_get_restitution(ref EntityHandle entity);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void circle_collider2d_component_set_restitution(ref EntityHandle entity, float restitution);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern float circle_collider2d_component_get_restitution_threshold(ref EntityHandle entity);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void circle_collider2d_component_set_restitution_threshold(ref EntityHandle entity, float restitutionThreshold);
+
+		#endregion
+		#region PolygonCollider2DComponent
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void polygon_collider2d_component_get_offset(ref EntityHandle entity, out Vector2 offset);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void polygon_collider2d_component_set_offset(ref EntityHandle entity, ref Vector2 offset);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern bool polygon_collider2d_component_get_is_trigger(ref EntityHandle entity);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void polygon_collider2d_component_set_is_trigger(ref EntityHandle entity, bool isTrigger);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void polygon_collider2d_component_set_on_trigger(ref EntityHandle entity, IntPtr onTriggerFunction);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern float polygon_collider2d_component_get_density(ref EntityHandle entity);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void polygon_collider2d_component_set_density(ref EntityHandle entity, float density);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern float polygon_collider2d_component_get_friction(ref EntityHandle entity);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void polygon_collider2d_component_set_friction(ref EntityHandle entity, float friction);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern float polygon_collider2d_component_get_restitution(ref EntityHandle entity);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void polygon_collider2d_component_set_restitution(ref EntityHandle entity, float restitution);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern float polygon_collider2d_component_get_restitution_threshold(ref EntityHandle entity);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void polygon_collider2d_component_set_restitution_threshold(ref EntityHandle entity, float restitutionThreshold);
+
+		#endregion
+		#region CapsuleCollider2DComponent
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void capsule_collider2d_component_get_offset(ref EntityHandle entity, out Vector2 offset);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void circle_collider2d_component_set_offset(ulong entityId, ref Vector2 offset);
+		internal static extern void capsule_collider2d_component_set_offset(ref EntityHandle entity, ref Vector2 offset);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern float circle_collider2d_component_get_radius(ulong entityId);
+		internal static extern float capsule_collider2d_component_get_radius(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void circle_collider2d_component_set_radius(ulong entityId, float radius);
+		internal static extern void capsule_collider2d_component_set_radius(ref EntityHandle entity, float radius);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern bool circle_collider2d_component_get_is_trigger(ulong entityId);
+		internal static extern float capsule_collider2d_component_get_height(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void circle_collider2d_component_set_is_trigger(ulong entityId, bool isTrigger);
+		internal static extern void capsule_collider2d_component_set_height(ref EntityHandle entity, float height);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void circle_collider2d_component_set_on_trigger(ulong entityId, IntPtr onTriggerFunction);
+		internal static extern bool capsule_collider2d_component_get_is_trigger(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern float circle_collider2d_component_get_density(ulong entityId);
+		internal static extern void capsule_collider2d_component_set_is_trigger(ref EntityHandle entity, bool isTrigger);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void circle_collider2d_component_set_density(ulong entityId, float density);
+		internal static extern void capsule_collider2d_component_set_on_trigger(ref EntityHandle entity, IntPtr onTriggerFunction);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern float circle_collider2d_component_get_friction(ulong entityId);
+		internal static extern float capsule_collider2d_component_get_density(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void circle_collider2d_component_set_friction(ulong entityId, float friction);
+		internal static extern void capsule_collider2d_component_set_density(ref EntityHandle entity, float density);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern float circle_collider2d_component_get_restitution(ulong entityId);
+		internal static extern float capsule_collider2d_component_get_friction(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void circle_collider2d_component_set_restitution(ulong entityId, float restitution);
+		internal static extern void capsule_collider2d_component_set_friction(ref EntityHandle entity, float friction);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern float circle_collider2d_component_get_restitution_threshold(ulong entityId);
+		internal static extern float capsule_collider2d_component_get_restitution(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal static extern void circle_collider2d_component_set_restitution_threshold(ulong entityId, float restitutionThreshold);
+		internal static extern void capsule_collider2d_component_set_restitution(ref EntityHandle entity, float restitution);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern float capsule_collider2d_component_get_restitution_threshold(ref EntityHandle entity);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void capsule_collider2d_component_set_restitution_threshold(ref EntityHandle entity, float restitutionThreshold);
+
+		#endregion
+		#region ChainCollider2DComponent
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern float chain_collider2d_component_get_friction(ref EntityHandle entity);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void chain_collider2d_component_set_friction(ref EntityHandle entity, float friction);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern float chain_collider2d_component_get_restitution(ref EntityHandle entity);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void chain_collider2d_component_set_restitution(ref EntityHandle entity, float restitution);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern float chain_collider2d_component_get_restitution_threshold(ref EntityHandle entity);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal static extern void chain_collider2d_component_set_restitution_threshold(ref EntityHandle entity, float restitutionThreshold);
 
 		#endregion
 		#region PostProcessVolume
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static bool post_process_volume_component_get_is_global(ulong entityId);
+		internal extern static bool post_process_volume_component_get_is_global(ref EntityHandle entity);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void post_process_volume_component_set_is_global(ulong entityId, bool value);
+		internal extern static void post_process_volume_component_set_is_global(ref EntityHandle entity, bool value);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void post_process_volume_component_get_gray_scale(ulong entityId, out GrayScaleSettings settings);
+		internal extern static void post_process_volume_component_get_gray_scale(ref EntityHandle entity, out GrayScaleSettings settings);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void post_process_volume_component_set_gray_scale(ulong entityId, ref GrayScaleSettings settings);
+		internal extern static void post_process_volume_component_set_gray_scale(ref EntityHandle entity, ref GrayScaleSettings settings);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void post_process_volume_component_get_chromatic_aberration(ulong entityId, out ChromaticAberrationSettings settings);
+		internal extern static void post_process_volume_component_get_chromatic_aberration(ref EntityHandle entity, out ChromaticAberrationSettings settings);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void post_process_volume_component_set_chromatic_aberration(ulong entityId, ref ChromaticAberrationSettings settings);
+		internal extern static void post_process_volume_component_set_chromatic_aberration(ref EntityHandle entity, ref ChromaticAberrationSettings settings);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void post_process_volume_component_get_blur(ulong entityId, out BlurSettings settings);
+		internal extern static void post_process_volume_component_get_blur(ref EntityHandle entity, out BlurSettings settings);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void post_process_volume_component_set_blur(ulong entityId, ref BlurSettings settings);
+		internal extern static void post_process_volume_component_set_blur(ref EntityHandle entity, ref BlurSettings settings);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void post_process_volume_component_get_sharpen(ulong entityId, out SharpenSettings settings);
+		internal extern static void post_process_volume_component_get_sharpen(ref EntityHandle entity, out SharpenSettings settings);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void post_process_volume_component_set_sharpen(ulong entityId, ref SharpenSettings settings);
+		internal extern static void post_process_volume_component_set_sharpen(ref EntityHandle entity, ref SharpenSettings settings);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void post_process_volume_component_get_vignette(ulong entityId, out VignetteSettings settings);
+		internal extern static void post_process_volume_component_get_vignette(ref EntityHandle entity, out VignetteSettings settings);
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void post_process_volume_component_set_vignette(ulong entityId, ref VignetteSettings settings);
+		internal extern static void post_process_volume_component_set_vignette(ref EntityHandle entity, ref VignetteSettings settings);
 
 		#endregion
 		#region SceneManager
 
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
-		internal extern static void scene_manager_load_scene(string path);
+		internal extern static ulong scene_manager_load_scene(string path);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static float scene_manager_get_load_progress(ulong loadId);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static SceneLoadState scene_manager_get_load_state(ulong loadId);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static void scene_manager_release_load(ulong loadId);
+
+		#endregion
+		#region ComponentData
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static unsafe void* component_data_get(ref EntityHandle entity, ComponentDataType type);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static unsafe uint* component_data_get_generation(ComponentDataType type);
+
+		#endregion
+		#region Prefab
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static ulong prefab_load(string path);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static ulong prefab_instantiate(ulong handle, ulong parentId, ref Vector3 position);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static int prefab_instantiate_batch(ulong handle, ulong parentId, Vector3[] positions, ulong[] entities);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static ulong prefab_spawn(ulong handle, ulong parentId, ref Vector3 position);
+
+		#endregion
+		#region Jobs
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static void jobs_execute(int jobCount, int[] entityCounts, int batchSize);
+
+		#endregion
+		#region Events
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static int events_drain(Event[] events);
+
+		#endregion
+		#region Physics2D
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static bool physics2d_raycast(ref Vector2 origin, ref Vector2 direction, float distance, out RaycastHit2D hit);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static int physics2d_raycast_all(ref Vector2 origin, ref Vector2 direction, float distance, RaycastHit2D[] hits);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static int physics2d_raycast_batch(RaycastQuery2D[] queries, RaycastHit2D[] hits);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static int physics2d_overlap_box(ref Vector2 center, ref Vector2 halfSize, float angle, ulong[] entities);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static int physics2d_overlap_circle(ref Vector2 center, float radius, ulong[] entities);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static bool physics2d_box_cast(ref Vector2 center, ref Vector2 halfSize, float angle, ref Vector2 direction, float distance, out RaycastHit2D hit);
+
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static bool physics2d_circle_cast(ref Vector2 center, float radius, ref Vector2 direction, float distance, out RaycastHit2D hit);
 
 		#endregion
 		#region Input
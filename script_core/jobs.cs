@@ -0,0 +1,271 @@
+using System;
+using System.Collections.Generic;
+
+namespace EveEngine
+{
+	/// <summary>
+	/// Work done for every entity of a set on the job worker threads. The
+	/// components a job reads and writes are declared in its constructor,
+	/// jobs with conflicting access run one after the other in the order
+	/// they were scheduled while the others run at the same time.
+	/// </summary>
+	/// <remarks>
+	/// Execute runs on worker threads for many entities at once. It may use
+	/// the components it declared but must not create or destroy entities or
+	/// components, load scenes, or change managed state other jobs use.
+	/// </remarks>
+	/// <example>
+	///  class SeekJob : EntityJob
+	///  {
+	///  	public Vector3 Target;
+	///
+	///  	public SeekJob()
+	///  	{
+	///  		Writes&lt;Transform&gt;();
+	///  	}
+	///
+	///  	public override void Execute(Entity entity)
+	///  	{
+	///  		ref TransformData data = ref entity.Transform.Data.Value;
+	///  		data.LocalPosition += (Target - data.LocalPosition) * 0.1f;
+	///  	}
+	///  }
+	/// </example>
+	public abstract class EntityJob
+	{
+		internal ulong readMask;
+		internal ulong writeMask;
+
+		/// <summary>
+		/// Declares that Execute reads components of type T.
+		/// </summary>
+		protected void Reads<T>() where T : Component
+		{
+			readMask |= ComponentMask<T>.Bit;
+		}
+
+		/// <summary>
+		/// Declares that Execute writes components of type T.
+		/// </summary>
+		protected void Writes<T>() where T : Component
+		{
+			writeMask |= ComponentMask<T>.Bit;
+		}
+
+		/// <summary>
+		/// Called on a worker thread for every entity the job was scheduled
+		/// with.
+		/// </summary>
+		/// <param name="entity">Entity to process</param>
+		public abstract void Execute(Entity entity);
+
+		internal bool ConflictsWith(EntityJob other)
+		{
+			return (writeMask & (other.readMask | other.writeMask)) != 0 ||
+				(readMask & other.writeMask) != 0;
+		}
+	}
+
+	/// <summary>
+	/// Scheduled job, used to wait for the job to finish.
+	/// </summary>
+	public readonly struct JobHandle
+	{
+		internal readonly long id;
+
+		internal JobHandle(long id)
+		{
+			this.id = id;
+		}
+
+		/// <summary>
+		/// Whether the job has run already.
+		/// </summary>
+		public bool IsCompleted => id <= Jobs.completedId;
+
+		/// <summary>
+		/// Runs the job and the jobs scheduled before it if they have not
+		/// run yet.
+		/// </summary>
+		public void Complete()
+		{
+			Jobs.Complete(this);
+		}
+	}
+
+	/// <summary>
+	/// Schedules entity jobs. Scheduled jobs run when they are completed or,
+	/// at the latest, after the scripts are updated and before physics.
+	/// </summary>
+	public static class Jobs
+	{
+		private struct ScheduledJob
+		{
+			public EntityJob Job;
+			public Entity[] Entities;
+			public int Count;
+		}
+
+		/// <summary>
+		/// Number of entities a worker takes at once.
+		/// </summary>
+		public static int BatchSize = 64;
+
+		private static readonly List<ScheduledJob> s_scheduled = new List<ScheduledJob>();
+		private static readonly List<ScheduledJob> s_wave = new List<ScheduledJob>();
+		private static int[] s_entityCounts = new int[8];
+
+		private static long s_lastId;
+		internal static long completedId;
+
+		[ThreadStatic]
+		private static bool s_isInJob;
+
+		public static JobHandle Schedule(EntityJob job, Entity[] entities)
+		{
+			return Schedule(job, entities, entities.Length);
+		}
+
+		/// <summary>
+		/// Queues the job for the first count entities. The entities must not
+		/// be destroyed before the job completes.
+		/// </summary>
+		/// <param name="job">Job to run</param>
+		/// <param name="entities">Entities to run the job for</param>
+		/// <param name="count">Number of entities to use from the array</param>
+		/// <returns>Handle to complete the job with</returns>
+		public static JobHandle Schedule(EntityJob job, Entity[] entities, int count)
+		{
+			if (s_isInJob)
+			{
+				throw new InvalidOperationException("Jobs can not be scheduled from a job.");
+			}
+
+			s_scheduled.Add(new ScheduledJob
+			{
+				Job = job,
+				Entities = entities,
+				Count = Math.Min(count, entities.Length),
+			});
+
+			return new JobHandle(++s_lastId);
+		}
+
+		/// <summary>
+		/// Runs the job for the entities and returns once it is done.
+		/// </summary>
+		public static void Run(EntityJob job, Entity[] entities)
+		{
+			Complete(Schedule(job, entities));
+		}
+
+		/// <summary>
+		/// Runs the job and the jobs scheduled before it.
+		/// </summary>
+		public static void Complete(JobHandle handle)
+		{
+			while (completedId < handle.id && s_scheduled.Count > 0)
+			{
+				RunWave();
+			}
+		}
+
+		/// <summary>
+		/// Runs every scheduled job.
+		/// </summary>
+		public static void CompleteAll()
+		{
+			while (s_scheduled.Count > 0)
+			{
+				RunWave();
+			}
+		}
+
+		// runs the scheduled jobs up to the first one that conflicts with an
+		// earlier job of the wave
+		private static void RunWave()
+		{
+			s_wave.Clear();
+
+			foreach (ScheduledJob scheduled in s_scheduled)
+			{
+				bool conflicts = false;
+				foreach (ScheduledJob other in s_wave)
+				{
+					conflicts |= scheduled.Job.ConflictsWith(other.Job);
+				}
+
+				if (conflicts)
+				{
+					break;
+				}
+
+				s_wave.Add(scheduled);
+			}
+
+			if (s_entityCounts.Length < s_wave.Count)
+			{
+				Array.Resize(ref s_entityCounts, s_wave.Count * 2);
+			}
+
+			for (int i = 0; i < s_wave.Count; i++)
+			{
+				s_entityCounts[i] = s_wave[i].Count;
+			}
+
+			try
+			{
+				Interop.jobs_execute(s_wave.Count, s_entityCounts, BatchSize);
+			}
+			finally
+			{
+				s_scheduled.RemoveRange(0, s_wave.Count);
+				completedId += s_wave.Count;
+				s_wave.Clear();
+			}
+		}
+
+		internal static void ExecuteBatch(int job, int start, int end)
+		{
+			ScheduledJob scheduled = s_wave[job];
+
+			s_isInJob = true;
+
+			for (int i = start; i < end; i++)
+			{
+				// one failing entity should not stop the rest of the batch
+				try
+				{
+					scheduled.Job.Execute(scheduled.Entities[i]);
+				}
+				catch (Exception e)
+				{
+					Interop.debug_log_exception($"[JOB]: {e.Message}");
+				}
+			}
+
+			s_isInJob = false;
+		}
+	}
+
+	// one bit per component type for the access masks of the jobs
+	internal static class ComponentMask
+	{
+		private static int s_count;
+
+		internal static ulong Next()
+		{
+			if (s_count == 64)
+			{
+				throw new InvalidOperationException("Too many component types for job access masks.");
+			}
+
+			return 1UL << s_count++;
+		}
+	}
+
+	internal static class ComponentMask<T> where T : Component
+	{
+		internal static readonly ulong Bit = ComponentMask.Next();
+	}
+}
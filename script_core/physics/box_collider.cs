@@ -8,58 +8,58 @@ namespace EveEngine
 		{
 			get
 			{
-				Interop.box_collider2d_component_get_offset(Entity.Id, out Vector2 offset);
+				Interop.box_collider2d_component_get_offset(ref Entity.handle, out Vector2 offset);
 				return offset;
 			}
-			set => Interop.box_collider2d_component_set_offset(Entity.Id, ref value);
+			set => Interop.box_collider2d_component_set_offset(ref Entity.handle, ref value);
 		}
 
 		public Vector2 Size
 		{
 			get
 			{
-				Interop.box_collider2d_component_get_size(Entity.Id, out Vector2 size);
+				Interop.box_collider2d_component_get_size(ref Entity.handle, out Vector2 size);
 				return size;
 			}
-			set => Interop.box_collider2d_component_set_size(Entity.Id, ref value);
+			set => Interop.box_collider2d_component_set_size(ref Entity.handle, ref value);
 		}
 
 		public bool IsTrigger
 		{
-			get => Interop.box_collider2d_component_get_is_trigger(Entity.Id);
-			set => Interop.box_collider2d_component_set_is_trigger(Entity.Id, value);
+			get => Interop.box_collider2d_component_get_is_trigger(ref Entity.handle);
+			set => Interop.box_collider2d_component_set_is_trigger(ref Entity.handle, value);
 		}
 
 		public ColliderOnTriggerDelegate OnTrigger
 		{
 			set
 			{
-				Interop.box_collider2d_component_set_on_trigger(Entity.Id, Marshal.GetFunctionPointerForDelegate(value));
+				Interop.box_collider2d_component_set_on_trigger(ref Entity.handle, Marshal.GetFunctionPointerForDelegate(value));
 			}
 		}
 
 		public float Density
 		{
-			get => Interop.box_collider2d_component_get_density(Entity.Id);
-			set => Interop.box_collider2d_component_set_density(Entity.Id, value);
+			get => Interop.box_collider2d_component_get_density(ref Entity.handle);
+			set => Interop.box_collider2d_component_set_density(ref Entity.handle, value);
 		}
 
 		public float Friction
 		{
-			get => Interop.box_collider2d_component_get_friction(Entity.Id);
-			set => Interop.box_collider2d_component_set_friction(Entity.Id, value);
+			get => Interop.box_collider2d_component_get_friction(ref Entity.handle);
+			set => Interop.box_collider2d_component_set_friction(ref Entity.handle, value);
 		}
 
 		public float Restitution
 		{
-			get => Interop.box_collider2d_component_get_restitution(Entity.Id);
-			set => Interop.box_collider2d_component_set_restitution(Entity.Id, value);
+			get => Interop.box_collider2d_component_get_restitution(ref Entity.handle);
+			set => Interop.box_collider2d_component_set_restitution(ref Entity.handle, value);
 		}
 
 		public float RestitutionThreshold
 		{
-			get => Interop.box_collider2d_component_get_restitution_threshold(Entity.Id);
-			set => Interop.box_collider2d_component_set_restitution_threshold(Entity.Id, value);
+			get => Interop.box_collider2d_component_get_restitution_threshold(ref Entity.handle);
+			set => Interop.box_collider2d_component_set_restitution_threshold(ref Entity.handle, value);
 		}
 	}
 
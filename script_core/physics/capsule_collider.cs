@@ -0,0 +1,67 @@
+using System.Runtime.InteropServices;
+
+namespace EveEngine
+{
+	public class CapsuleCollider2D : Component
+	{
+		public Vector2 Offset
+		{
+			get
+			{
+				Interop.capsule_collider2d_component_get_offset(ref Entity.handle, out Vector2 offset);
+				return offset;
+			}
+			set => Interop.capsule_collider2d_component_set_offset(ref Entity.handle, ref value);
+		}
+
+		public float Radius
+		{
+			get => Interop.capsule_collider2d_component_get_radius(ref Entity.handle);
+			set => Interop.capsule_collider2d_component_set_radius(ref Entity.handle, value);
+		}
+
+		public float Height
+		{
+			get => Interop.capsule_collider2d_component_get_height(ref Entity.handle);
+			set => Interop.capsule_collider2d_component_set_height(ref Entity.handle, value);
+		}
+
+		public bool IsTrigger
+		{
+			get => Interop.capsule_collider2d_component_get_is_trigger(ref Entity.handle);
+			set => Interop.capsule_collider2d_component_set_is_trigger(ref Entity.handle, value);
+		}
+
+		public ColliderOnTriggerDelegate OnTrigger
+		{
+			set
+			{
+				Interop.capsule_collider2d_component_set_on_trigger(ref Entity.handle, Marshal.GetFunctionPointerForDelegate(value));
+			}
+		}
+
+		public float Density
+		{
+			get => Interop.capsule_collider2d_component_get_density(ref Entity.handle);
+			set => Interop.capsule_collider2d_component_set_density(ref Entity.handle, value);
+		}
+
+		public float Friction
+		{
+			get => Interop.capsule_collider2d_component_get_friction(ref Entity.handle);
+			set => Interop.capsule_collider2d_component_set_friction(ref Entity.handle, value);
+		}
+
+		public float Restitution
+		{
+			get => Interop.capsule_collider2d_component_get_restitution(ref Entity.handle);
+			set => Interop.capsule_collider2d_component_set_restitution(ref Entity.handle, value);
+		}
+
+		public float RestitutionThreshold
+		{
+			get => Interop.capsule_collider2d_component_get_restitution_threshold(ref Entity.handle);
+			set => Interop.capsule_collider2d_component_set_restitution_threshold(ref Entity.handle, value);
+		}
+	}
+}
@@ -0,0 +1,23 @@
+namespace EveEngine
+{
+	public class ChainCollider2D : Component
+	{
+		public float Friction
+		{
+			get => Interop.chain_collider2d_component_get_friction(ref Entity.handle);
+			set => Interop.chain_collider2d_component_set_friction(ref Entity.handle, value);
+		}
+
+		public float Restitution
+		{
+			get => Interop.chain_collider2d_component_get_restitution(ref Entity.handle);
+			set => Interop.chain_collider2d_component_set_restitution(ref Entity.handle, value);
+		}
+
+		public float RestitutionThreshold
+		{
+			get => Interop.chain_collider2d_component_get_restitution_threshold(ref Entity.handle);
+			set => Interop.chain_collider2d_component_set_restitution_threshold(ref Entity.handle, value);
+		}
+	}
+}
@@ -8,54 +8,54 @@ namespace EveEngine
 		{
 			get
 			{
-				Interop.circle_collider2d_component_get_offset(Entity.Id, out Vector2 offset);
+				Interop.circle_collider2d_component_get_offset(ref Entity.handle, out Vector2 offset);
 				return offset;
 			}
-			set => Interop.circle_collider2d_component_set_offset(Entity.Id, ref value);
+			set => Interop.circle_collider2d_component_set_offset(ref Entity.handle, ref value);
 		}
 
 		public float Radius
 		{
-			get => Interop.circle_collider2d_component_get_radius(Entity.Id);
-			set => Interop.circle_collider2d_component_set_radius(Entity.Id, value);
+			get => Interop.circle_collider2d_component_get_radius(ref Entity.handle);
+			set => Interop.circle_collider2d_component_set_radius(ref Entity.handle, value);
 		}
 
 		public bool IsTrigger
 		{
-			get => Interop.circle_collider2d_component_get_is_trigger(Entity.Id);
-			set => Interop.circle_collider2d_component_set_is_trigger(Entity.Id, value);
+			get => Interop.circle_collider2d_component_get_is_trigger(ref Entity.handle);
+			set => Interop.circle_collider2d_component_set_is_trigger(ref Entity.handle, value);
 		}
 
 		public ColliderOnTriggerDelegate OnTrigger
 		{
 			set
 			{
-				Interop.circle_collider2d_component_set_on_trigger(Entity.Id, Marshal.GetFunctionPointerForDelegate(value));
+				Interop.circle_collider2d_component_set_on_trigger(ref Entity.handle, Marshal.GetFunctionPointerForDelegate(value));
 			}
 		}
 
 		public float Density
 		{
-			get => Interop.circle_collider2d_component_get_density(Entity.Id);
-			set => Interop.circle_collider2d_component_set_density(Entity.Id, value);
+			get => Interop.circle_collider2d_component_get_density(ref Entity.handle);
+			set => Interop.circle_collider2d_component_set_density(ref Entity.handle, value);
 		}
 
 		public float Friction
 		{
-			get => Interop.circle_collider2d_component_get_friction(Entity.Id);
-			set => Interop.circle_collider2d_component_set_friction(Entity.Id, value);
+			get => Interop.circle_collider2d_component_get_friction(ref Entity.handle);
+			set => Interop.circle_collider2d_component_set_friction(ref Entity.handle, value);
 		}
 
 		public float Restitution
 		{
-			get => Interop.circle_collider2d_component_get_restitution(Entity.Id);
-			set => Interop.circle_collider2d_component_set_restitution(Entity.Id, value);
+			get => Interop.circle_collider2d_component_get_restitution(ref Entity.handle);
+			set => Interop.circle_collider2d_component_set_restitution(ref Entity.handle, value);
 		}
 
 		public float RestitutionThreshold
 		{
-			get => Interop.circle_collider2d_component_get_restitution_threshold(Entity.Id);
-			set => Interop.circle_collider2d_component_set_restitution_threshold(Entity.Id, value);
+			get => Interop.circle_collider2d_component_get_restitution_threshold(ref Entity.handle);
+			set => Interop.circle_collider2d_component_set_restitution_threshold(ref Entity.handle, value);
 		}
 	}
 }
@@ -0,0 +1,132 @@
+using System.Runtime.InteropServices;
+
+namespace EveEngine
+{
+	/// <summary>
+	/// Result of a physics query.
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	public struct RaycastHit2D
+	{
+		/// <summary>
+		/// Id of the hit entity, zero if nothing is hit.
+		/// </summary>
+		public ulong EntityId;
+
+		/// <summary>
+		/// World position of the hit.
+		/// </summary>
+		public Vector2 Point;
+
+		/// <summary>
+		/// Surface normal at the hit point.
+		/// </summary>
+		public Vector2 Normal;
+
+		/// <summary>
+		/// Distance along the query in [0, 1] range.
+		/// </summary>
+		public float Fraction;
+
+		public readonly bool HasHit => EntityId != 0;
+
+		public readonly Entity Entity => new(EntityId);
+	}
+
+	/// <summary>
+	/// Single ray of a batched raycast.
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	public struct RaycastQuery2D
+	{
+		public Vector2 Origin;
+		public Vector2 Direction;
+		public float Distance;
+
+		public RaycastQuery2D(Vector2 origin, Vector2 direction, float distance)
+		{
+			Origin = origin;
+			Direction = direction;
+			Distance = distance;
+		}
+	}
+
+	/// <summary>
+	/// A static class to query the 2D physics world of the running scene.
+	/// Methods returning multiple results write into caller owned arrays,
+	/// allocate them once and reuse them every frame.
+	/// </summary>
+	public static class Physics2D
+	{
+		/// <summary>
+		/// Casts a ray and returns the closest hit.
+		/// </summary>
+		public static bool Raycast(Vector2 origin, Vector2 direction, float distance, out RaycastHit2D hit)
+		{
+			return Interop.physics2d_raycast(ref origin, ref direction, distance, out hit);
+		}
+
+		/// <summary>
+		/// Casts a ray and writes every hit sorted by distance into results.
+		/// </summary>
+		/// <returns>Number of hits written.</returns>
+		public static int RaycastAll(Vector2 origin, Vector2 direction, float distance, RaycastHit2D[] results)
+		{
+			return Interop.physics2d_raycast_all(ref origin, ref direction, distance, results);
+		}
+
+		/// <summary>
+		/// Casts every ray in a single call and writes the closest hit of
+		/// queries[i] into results[i].
+		/// </summary>
+		/// <returns>Number of rays that hit something.</returns>
+		public static int RaycastBatch(RaycastQuery2D[] queries, RaycastHit2D[] results)
+		{
+			return Interop.physics2d_raycast_batch(queries, results);
+		}
+
+		/// <summary>
+		/// Writes ids of the entities overlapping with the box into results.
+		/// </summary>
+		/// <param name="center">Center of the box in world space.</param>
+		/// <param name="halfSize">Half of the width and height of the box.</param>
+		/// <param name="angle">Rotation of the box in degrees.</param>
+		/// <param name="results">Array the entity ids are written into.</param>
+		/// <returns>Number of entities written.</returns>
+		public static int OverlapBox(Vector2 center, Vector2 halfSize, float angle, ulong[] results)
+		{
+			return Interop.physics2d_overlap_box(ref center, ref halfSize, angle, results);
+		}
+
+		/// <summary>
+		/// Writes ids of the entities overlapping with the circle into results.
+		/// </summary>
+		/// <returns>Number of entities written.</returns>
+		public static int OverlapCircle(Vector2 center, float radius, ulong[] results)
+		{
+			return Interop.physics2d_overlap_circle(ref center, radius, results);
+		}
+
+		/// <summary>
+		/// Sweeps a box along the direction and returns the first hit.
+		/// </summary>
+		/// <param name="center">Center of the box in world space.</param>
+		/// <param name="halfSize">Half of the width and height of the box.</param>
+		/// <param name="angle">Rotation of the box in degrees.</param>
+		/// <param name="direction">Direction to sweep the box along.</param>
+		/// <param name="distance">Distance to sweep the box.</param>
+		/// <param name="hit">First hit along the sweep.</param>
+		public static bool BoxCast(Vector2 center, Vector2 halfSize, float angle, Vector2 direction, float distance, out RaycastHit2D hit)
+		{
+			return Interop.physics2d_box_cast(ref center, ref halfSize, angle, ref direction, distance, out hit);
+		}
+
+		/// <summary>
+		/// Sweeps a circle along the direction and returns the first hit.
+		/// </summary>
+		public static bool CircleCast(Vector2 center, float radius, Vector2 direction, float distance, out RaycastHit2D hit)
+		{
+			return Interop.physics2d_circle_cast(ref center, radius, ref direction, distance, out hit);
+		}
+	}
+}
@@ -0,0 +1,55 @@
+using System.Runtime.InteropServices;
+
+namespace EveEngine
+{
+	public class PolygonCollider2D : Component
+	{
+		public Vector2 Offset
+		{
+			get
+			{
+				Interop.polygon_collider2d_component_get_offset(ref Entity.handle, out Vector2 offset);
+				return offset;
+			}
+			set => Interop.polygon_collider2d_component_set_offset(ref Entity.handle, ref value);
+		}
+
+		public bool IsTrigger
+		{
+			get => Interop.polygon_collider2d_component_get_is_trigger(ref Entity.handle);
+			set => Interop.polygon_collider2d_component_set_is_trigger(ref Entity.handle, value);
+		}
+
+		public ColliderOnTriggerDelegate OnTrigger
+		{
+			set
+			{
+				Interop.polygon_collider2d_component_set_on_trigger(ref Entity.handle, Marshal.GetFunctionPointerForDelegate(value));
+			}
+		}
+
+		public float Density
+		{
+			get => Interop.polygon_collider2d_component_get_density(ref Entity.handle);
+			set => Interop.polygon_collider2d_component_set_density(ref Entity.handle, value);
+		}
+
+		public float Friction
+		{
+			get => Interop.polygon_collider2d_component_get_friction(ref Entity.handle);
+			set => Interop.polygon_collider2d_component_set_friction(ref Entity.handle, value);
+		}
+
+		public float Restitution
+		{
+			get => Interop.polygon_collider2d_component_get_restitution(ref Entity.handle);
+			set => Interop.polygon_collider2d_component_set_restitution(ref Entity.handle, value);
+		}
+
+		public float RestitutionThreshold
+		{
+			get => Interop.polygon_collider2d_component_get_restitution_threshold(ref Entity.handle);
+			set => Interop.polygon_collider2d_component_set_restitution_threshold(ref Entity.handle, value);
+		}
+	}
+}
@@ -19,28 +19,28 @@ namespace EveEngine
 
 		public BodyType Type
 		{
-			get => Interop.rigidbody2d_component_get_type(Entity.Id);
-			set => Interop.rigidbody2d_component_set_type(Entity.Id, value);
+			get => Interop.rigidbody2d_component_get_type(ref Entity.handle);
+			set => Interop.rigidbody2d_component_set_type(ref Entity.handle, value);
 		}
 
 		public bool FixedRotation
 		{
-			get => Interop.rigidbody2d_component_get_fixed_rotation(Entity.Id);
-			set => Interop.rigidbody2d_component_set_fixed_rotation(Entity.Id, value);
+			get => Interop.rigidbody2d_component_get_fixed_rotation(ref Entity.handle);
+			set => Interop.rigidbody2d_component_set_fixed_rotation(ref Entity.handle, value);
 		}
 
 		public Vector2 Velocity
 		{
 			get
 			{
-				Interop.rigidbody2d_component_get_velocity(Entity.Id, out Vector2 velocity);
+				Interop.rigidbody2d_component_get_velocity(ref Entity.handle, out Vector2 velocity);
 				return velocity;
 			}
 		}
 
 		public float AngularVelocity
 		{
-			get => Interop.rigidbody2d_component_get_angular_velocity(Entity.Id);
+			get => Interop.rigidbody2d_component_get_angular_velocity(ref Entity.handle);
 		}
 
 		public void ApplyForce(Vector2 force, ForceMode forceMode = ForceMode.Force)
@@ -50,17 +50,17 @@ namespace EveEngine
 
 		public void ApplyForce(Vector2 force, Vector2 offset, ForceMode forceMode = ForceMode.Force)
 		{
-			Interop.rigidbody2d_component_add_force(Entity.Id, forceMode, ref force, ref offset);
+			Interop.rigidbody2d_component_add_force(ref Entity.handle, forceMode, ref force, ref offset);
 		}
 
 		public void ApplyAngularImpulse(float angularImpulse)
 		{
-			Interop.rigidbody2d_component_add_angular_impulse(Entity.Id, angularImpulse);
+			Interop.rigidbody2d_component_add_angular_impulse(ref Entity.handle, angularImpulse);
 		}
 
 		public void ApplyTorque(float torque)
 		{
-			Interop.rigidbody2d_component_add_torque(Entity.Id, torque);
+			Interop.rigidbody2d_component_add_torque(ref Entity.handle, torque);
 		}
 	}
 }
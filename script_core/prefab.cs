@@ -0,0 +1,99 @@
+namespace EveEngine
+{
+	/// <summary>
+	/// Entity hierarchy baked into a single asset, instances are created
+	/// with one engine call no matter how many components they have.
+	/// </summary>
+	public class Prefab
+	{
+		public ulong Handle { get; private set; }
+
+		public Prefab(ulong handle)
+		{
+			Handle = handle;
+		}
+
+		/// <summary>
+		/// Loads the prefab into the active scene, loading an already loaded
+		/// prefab returns it as is.
+		/// </summary>
+		/// <param name="path">Path of the prefab in eve asset path format</param>
+		/// <returns>Loaded prefab or null if it could not be loaded</returns>
+		/// <example>
+		///  Prefab bullet = Prefab.Load("res://prefabs/bullet.eprf");
+		/// </example>
+		public static Prefab Load(string path)
+		{
+			ulong handle = Interop.prefab_load(path);
+			return handle != 0 ? new Prefab(handle) : null;
+		}
+
+		public Entity Instantiate(Vector3 position)
+		{
+			return Instantiate(Entity.InvalidEntity, position);
+		}
+
+		/// <summary>
+		/// Creates an instance of the prefab, entities get new ids and entity
+		/// fields pointing inside the prefab are pointed to the instance.
+		/// </summary>
+		/// <param name="parent">Parent of the root of the instance</param>
+		/// <param name="position">Local position of the root</param>
+		/// <returns>Root entity of the instance</returns>
+		public Entity Instantiate(Entity parent, Vector3 position)
+		{
+			ulong createdId = Interop.prefab_instantiate(Handle, parent.Id, ref position);
+			return new Entity(createdId);
+		}
+
+		public Entity Spawn(Vector3 position)
+		{
+			return Spawn(Entity.InvalidEntity, position);
+		}
+
+		/// <summary>
+		/// Same as Instantiate but reuses an instance given back with
+		/// Entity.Release if there is one. Reused instances get the
+		/// components and field values of the prefab back and OnCreate is
+		/// called again.
+		/// </summary>
+		/// <param name="parent">Parent of the root of the instance</param>
+		/// <param name="position">Local position of the root</param>
+		/// <returns>Root entity of the instance</returns>
+		/// <example>
+		///  Entity bullet = bulletPrefab.Spawn(Transform.Position);
+		///  ...
+		///  bullet.Release();
+		/// </example>
+		public Entity Spawn(Entity parent, Vector3 position)
+		{
+			ulong createdId = Interop.prefab_spawn(Handle, parent.Id, ref position);
+			return new Entity(createdId);
+		}
+
+		public Entity[] Instantiate(Vector3[] positions)
+		{
+			return Instantiate(Entity.InvalidEntity, positions);
+		}
+
+		/// <summary>
+		/// Creates an instance for every given position in a single call.
+		/// </summary>
+		/// <param name="parent">Parent of the roots of the instances</param>
+		/// <param name="positions">Local positions of the roots</param>
+		/// <returns>Root entities of the instances</returns>
+		public Entity[] Instantiate(Entity parent, Vector3[] positions)
+		{
+			ulong[] createdIds = new ulong[positions.Length];
+			int count = Interop.prefab_instantiate_batch(Handle, parent.Id, positions, createdIds);
+
+			Entity[] entities = new Entity[count];
+			for (int i = 0; i < count; i++)
+			{
+				entities[i] = new Entity(createdIds[i]);
+			}
+
+			return entities;
+		}
+	}
+}
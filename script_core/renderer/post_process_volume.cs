@@ -57,58 +57,58 @@ namespace EveEngine
 
 		public bool IsGlobal
 		{
-			get => Interop.post_process_volume_component_get_is_global(Entity.Id);
-			set => Interop.post_process_volume_component_set_is_global(Entity.Id, value);
+			get => Interop.post_process_volume_component_get_is_global(ref Entity.handle);
+			set => Interop.post_process_volume_component_set_is_global(ref Entity.handle, value);
 		}
 
 		public GrayScaleSettings GrayScale
 		{
 			get
 			{
-				Interop.post_process_volume_component_get_gray_scale(Entity.Id, out GrayScaleSettings settings);
+				Interop.post_process_volume_component_get_gray_scale(ref Entity.handle, out GrayScaleSettings settings);
 				return settings;
 			}
-			set => Interop.post_process_volume_component_set_gray_scale(Entity.Id, ref value);
+			set => Interop.post_process_volume_component_set_gray_scale(ref Entity.handle, ref value);
 		}
 
 		public ChromaticAberrationSettings ChromaticAberration
 		{
 			get
 			{
-				Interop.post_process_volume_component_get_chromatic_aberration(Entity.Id, out ChromaticAberrationSettings settings);
+				Interop.post_process_volume_component_get_chromatic_aberration(ref Entity.handle, out ChromaticAberrationSettings settings);
 				return settings;
 			}
-			set => Interop.post_process_volume_component_set_chromatic_aberration(Entity.Id, ref value);
+			set => Interop.post_process_volume_component_set_chromatic_aberration(ref Entity.handle, ref value);
 		}
 
 		public BlurSettings Blur
 		{
 			get
 			{
-				Interop.post_process_volume_component_get_blur(Entity.Id, out BlurSettings settings);
+				Interop.post_process_volume_component_get_blur(ref Entity.handle, out BlurSettings settings);
 				return settings;
 			}
-			set => Interop.post_process_volume_component_set_blur(Entity.Id, ref value);
+			set => Interop.post_process_volume_component_set_blur(ref Entity.handle, ref value);
 		}
 
 		public SharpenSettings Sharpen
 		{
 			get
 			{
-				Interop.post_process_volume_component_get_sharpen(Entity.Id, out SharpenSettings settings);
+				Interop.post_process_volume_component_get_sharpen(ref Entity.handle, out SharpenSettings settings);
 				return settings;
 			}
-			set => Interop.post_process_volume_component_set_sharpen(Entity.Id, ref value);
+			set => Interop.post_process_volume_component_set_sharpen(ref Entity.handle, ref value);
 		}
 
 		public VignetteSettings Vignette
 		{
 			get
 			{
-				Interop.post_process_volume_component_get_vignette(Entity.Id, out VignetteSettings settings);
+				Interop.post_process_volume_component_get_vignette(ref Entity.handle, out VignetteSettings settings);
 				return settings;
 			}
-			set => Interop.post_process_volume_component_set_vignette(Entity.Id, ref value);
+			set => Interop.post_process_volume_component_set_vignette(ref Entity.handle, ref value);
 		}
 	}
 }
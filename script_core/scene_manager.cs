@@ -1,20 +1,89 @@
 namespace EveEngine
 {
+	public enum SceneLoadState
+	{
+		Loading = 0,
+		Loaded,
+		Failed,
+	}
+
+	/// <summary>
+	/// Progress of a scene loaded in the background, e.g. to drive a loading
+	/// screen.
+	/// </summary>
+	public class SceneLoadHandle
+	{
+		private readonly ulong loadId;
+
+		// the engine forgets about the load once it is seen finished
+		private SceneLoadState finishedState = SceneLoadState.Loading;
+
+		internal SceneLoadHandle(ulong loadId)
+		{
+			this.loadId = loadId;
+
+			if (loadId == 0)
+			{
+				finishedState = SceneLoadState.Failed;
+			}
+		}
+
+		/// <summary>
+		/// Progress of the load in [0, 1] range.
+		/// </summary>
+		public float Progress
+		{
+			get
+			{
+				if (finishedState != SceneLoadState.Loading)
+				{
+					return finishedState == SceneLoadState.Loaded ? 1.0f : 0.0f;
+				}
+
+				return Interop.scene_manager_get_load_progress(loadId);
+			}
+		}
+
+		public SceneLoadState State
+		{
+			get
+			{
+				if (finishedState != SceneLoadState.Loading)
+				{
+					return finishedState;
+				}
+
+				SceneLoadState state = Interop.scene_manager_get_load_state(loadId);
+				if (state != SceneLoadState.Loading)
+				{
+					finishedState = state;
+					Interop.scene_manager_release_load(loadId);
+				}
+
+				return state;
+			}
+		}
+
+		public bool IsDone => State != SceneLoadState.Loading;
+	}
+
 	/// <summary>
 	/// A static class providing functionality to manage scenes in the game.
 	/// </summary>
 	public static class SceneManager
 	{
 		/// <summary>
-		/// Loads scene from given path.
+		/// Loads scene from given path in the background, the current scene
+		/// keeps running until the new one is ready to replace it.
 		/// </summary>
 		/// <param name="path">Path of the path in eve asset path format</param>
+		/// <returns>Handle to follow the progress of the load with</returns>
 		/// <example>
-		///  SceneManager.LoadScene("res://scenes/scene1.escn");
+		///  SceneLoadHandle load = SceneManager.LoadScene("res://scenes/scene1.escn");
 		/// </example>
-		public static void LoadScene(string path)
+		public static SceneLoadHandle LoadScene(string path)
 		{
-			Interop.scene_manager_load_scene(path);
+			return new SceneLoadHandle(Interop.scene_manager_load_scene(path));
 		}
 	}
 }
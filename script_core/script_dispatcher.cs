@@ -0,0 +1,68 @@
+using System;
+using System.Diagnostics;
+
+namespace EveEngine
+{
+	/// <summary>
+	/// Entry points the engine calls once per script class instead of once
+	/// per entity.
+	/// </summary>
+	internal static class ScriptDispatcher
+	{
+		private static readonly double s_millisecondsPerTick = 1000.0 / Stopwatch.Frequency;
+
+		internal static void UpdateEntities(Entity[] entities, int count, float dt, double[] timings)
+		{
+			// the engine only passes timings while the script profiler records
+			if (timings != null)
+			{
+				for (int i = 0; i < count; i++)
+				{
+					long start = Stopwatch.GetTimestamp();
+					UpdateEntity(entities[i], dt);
+					timings[i] = (Stopwatch.GetTimestamp() - start) * s_millisecondsPerTick;
+				}
+
+				return;
+			}
+
+			for (int i = 0; i < count; i++)
+			{
+				UpdateEntity(entities[i], dt);
+			}
+		}
+
+		private static void UpdateEntity(Entity entity, float dt)
+		{
+			// one failing script should not stop the rest of the batch
+			try
+			{
+				entity.InvokeOnUpdate(dt);
+			}
+			catch (Exception e)
+			{
+				Interop.debug_log_exception(e.Message);
+			}
+		}
+
+		internal static void DispatchEvents()
+		{
+			Events.Dispatch();
+		}
+
+		internal static void ResetEvents()
+		{
+			Events.Reset();
+		}
+
+		internal static void ExecuteJobBatch(int job, int start, int end)
+		{
+			Jobs.ExecuteBatch(job, start, end);
+		}
+
+		internal static void CompleteJobs()
+		{
+			Jobs.CompleteAll();
+		}
+	}
+}
@@ -0,0 +1,90 @@
+import os
+import subprocess
+
+from enum import Enum
+from pathlib import Path
+
+from .config import PROJECT_SOURCE_DIR
+
+
+class AotMode(Enum):
+    NORMAL = "AOT"
+    FULL = "FULL_AOT"
+    LLVM = "LLVM_AOT"
+
+
+# full AOT can not fall back to the jit, so the framework assemblies the
+# scripts use need images as well
+FRAMEWORK_ASSEMBLIES: list[str] = [
+    "mscorlib.dll",
+    "System.dll",
+    "System.Core.dll",
+]
+
+# type forwarders such as System.Runtime and netstandard which assemblies
+# built against reference assemblies are linked to, every one of them is
+# compiled since they are small and their use depends on the script build
+FACADES_DIRECTORY: str = "Facades"
+
+
+def get_aot_arg(mode: AotMode) -> str:
+    match mode:
+        case AotMode.FULL:
+            return "--aot=full"
+        case AotMode.LLVM:
+            return "--aot=llvmonly"
+        case _:
+            return "--aot"
+
+
+def get_assemblies(mode: AotMode) -> list[Path]:
+    bin_dir: Path = PROJECT_SOURCE_DIR.parent / "bin"
+    framework_dir: Path = bin_dir / "mono" / "lib" / "mono" / "4.5"
+
+    assemblies: list[Path] = [
+        bin_dir / "script_core.dll",
+        bin_dir / "sample" / "out" / "sample.dll",
+    ]
+
+    if mode is not AotMode.NORMAL:
+        assemblies.extend(framework_dir / name
+                          for name in FRAMEWORK_ASSEMBLIES)
+        assemblies.extend(
+            sorted((framework_dir / FACADES_DIRECTORY).glob("*.dll")))
+
+    return assemblies
+
+
+def compile_scripts_aot(mode: AotMode) -> None:
+    bin_dir: Path = PROJECT_SOURCE_DIR.parent / "bin"
+    framework_dir: Path = bin_dir / "mono" / "lib" / "mono" / "4.5"
+
+    # references are resolved from the same places the engine loads them
+    env: dict[str, str] = dict(os.environ)
+    env["MONO_PATH"] = os.pathsep.join([
+        str(framework_dir),
+        str(framework_dir / FACADES_DIRECTORY),
+        str(bin_dir)
+    ])
+
+    for assembly in get_assemblies(mode):
+        if not assembly.exists():
+            print(f"{assembly} not found, build it before compiling it AOT.")
+            exit(1)
+
+        # the image is written next to the assembly as {assembly}.so where
+        # the engine looks for it
+        args: list[str] = [
+            "mono",
+            get_aot_arg(mode),
+            "-O=all",
+            str(assembly)
+        ]
+
+        try:
+            subprocess.check_call(args=args, env=env)
+        except subprocess.CalledProcessError as e:
+            print(f"Error occurred while compiling {assembly.name}: {e}")
+            exit(1)
+
+    print(f"Scripts compiled for {mode.value} successfully.")
@@ -5,10 +5,12 @@ from .config import BUILD_FLAGS_BUILD_ENGINE, \
     BUILD_FLAGS_COMPILE_SHADERS, \
     BUILD_FLAGS_BUILD_SCRIPT_CORE, \
     BUILD_FLAGS_BUILD_SAMPLE, \
+    BUILD_FLAGS_AOT_SCRIPTS, \
     BUILD_FLAGS_ALL, \
     BuildConfig, \
     deserialize_build_config
 
+from .aot_compiler import AotMode, compile_scripts_aot
 from .cmake_builder import configure_cmake, build_engine
 from .dotnet_builder import build_sample, build_script_core
 from .shader_compiler import compile_shaders
@@ -34,6 +36,10 @@ USAGE:
 --script-core       builds script core
 --shaders           compiles shaders
 --sample            builds sample project
+--aot=[AOT | FULL_AOT | LLVM_AOT]
+
+                    compiles script core and the sample ahead of time for
+                    the runtime (FULL_AOT is the default), needs mono
 
 --help | -h         shows this message
 """)
@@ -52,6 +58,8 @@ def parse_flags() -> int:
         flags = flags | BUILD_FLAGS_BUILD_SAMPLE
     if "--all" in ARGS:
         flags = BUILD_FLAGS_ALL
+    if parse_aot_mode() is not None:
+        flags = flags | BUILD_FLAGS_AOT_SCRIPTS
 
     return flags
 
@@ -79,6 +87,22 @@ def parse_config() -> BuildConfig | None:
     return deserialized_config
 
 
+def parse_aot_mode() -> AotMode | None:
+    for arg in ARGS:
+        if arg == "--aot":
+            return AotMode.FULL
+
+        if arg.startswith("--aot="):
+            mode: str = arg.removeprefix("--aot=")
+            try:
+                return AotMode(mode)
+            except ValueError:
+                print(f"{mode} is not a valid AOT mode.")
+                exit(1)
+
+    return None
+
+
 def parse_args() -> None:
     if "--help" in ARGS or "-h" in ARGS:
         print_help_message()
@@ -119,3 +143,7 @@ def parse_args() -> None:
 
     if flags & BUILD_FLAGS_BUILD_SAMPLE:
         build_sample(config, clean_build)
+
+    # needs the assemblies built above
+    if flags & BUILD_FLAGS_AOT_SCRIPTS:
+        compile_scripts_aot(parse_aot_mode())
@@ -7,6 +7,9 @@ BUILD_FLAGS_BUILD_ENGINE: int = 1 << 0
 BUILD_FLAGS_BUILD_SCRIPT_CORE: int = 1 << 1
 BUILD_FLAGS_BUILD_SAMPLE: int = 1 << 2
 BUILD_FLAGS_COMPILE_SHADERS: int = 1 << 3
+# not part of --all, only runtime builds with an AOT script execution mode
+# use the images
+BUILD_FLAGS_AOT_SCRIPTS: int = 1 << 4
 BUILD_FLAGS_ALL: int = BUILD_FLAGS_BUILD_ENGINE \
     | BUILD_FLAGS_BUILD_SCRIPT_CORE \
     | BUILD_FLAGS_BUILD_SAMPLE \